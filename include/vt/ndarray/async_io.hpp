@@ -0,0 +1,155 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_ASYNC_IO_HPP_
+#define VT_NDARRAY_ASYNC_IO_HPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/pipeline.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace vt {
+
+struct io_options {
+    // Maximum number of reads and writes that are in flight at the same time
+    std::size_t queue_depth = 64;
+    // Threads of the fallback if io_uring is not available, 0 for the number
+    // of hardware threads
+    std::size_t thread_count = 4;
+    // Read elements that are aligned to io_block_size directly into the
+    // array, bypassing the page cache (O_DIRECT)
+    bool direct = true;
+    // Use the fallback even if io_uring is available
+    bool force_fallback = false;
+};
+
+
+struct io_stats {
+    // Number of loads and stores that have finished
+    std::size_t request_count = 0;
+    // Number of element bytes that have been loaded or stored
+    std::uint64_t byte_count = 0;
+    // Time during which at least one load or store was in progress
+    double seconds = 0.0;
+
+    // Bytes per second
+    double bandwidth() const noexcept;
+};
+
+
+// Files written by io_context::store start their elements at a multiple of
+// this size, so that they can be loaded with O_DIRECT.
+constexpr std::size_t io_block_size = 4096;
+
+
+namespace detail {
+
+struct io_operation;
+
+class uring_queue;
+
+template<typename T, std::size_t N>
+struct load_state;
+
+struct store_state;
+
+} // namespace detail
+
+
+// Loads and stores ndarrays in the binary format of read_binary and
+// write_binary, without blocking the calling thread. Uses io_uring on Linux,
+// and a thread pool otherwise.
+class io_context {
+public:
+    explicit io_context(const io_options& options = {});
+    io_context(const io_context&) = delete;
+
+    // Waits for all loads and stores
+    ~io_context();
+
+    io_context& operator=(const io_context&) = delete;
+
+    template<typename T, std::size_t N>
+    std::future<ndarray<T, N>> load(const std::string& path);
+    template<typename T, std::size_t N>
+    std::vector<std::future<ndarray<T, N>>> load(
+        const std::vector<std::string>& paths
+    );
+
+    // The elements of a must stay valid until the store has finished.
+    template<typename T, std::size_t N>
+    std::future<void> store(const std::string& path, ndview<const T, N> a);
+
+    void wait();
+
+    io_stats stats() const;
+    bool uses_io_uring() const noexcept;
+
+private:
+    io_options _options;
+    mutable std::mutex _mutex;
+    std::condition_variable _idle;
+    std::size_t _active_count;
+    std::chrono::steady_clock::time_point _busy_start;
+    io_stats _stats;
+    std::unique_ptr<detail::uring_queue> _uring;
+    std::unique_ptr<detail::thread_pool> _pool;
+
+    template<typename T, std::size_t N>
+    std::future<ndarray<T, N>> begin_load(
+        const std::string& path,
+        std::vector<detail::io_operation>& operations
+    );
+    template<typename T, std::size_t N>
+    void load_elements(
+        const std::shared_ptr<detail::load_state<T, N>>& state,
+        std::int64_t header_size
+    );
+    template<typename T, std::size_t N>
+    void finish_load(
+        detail::load_state<T, N>& state,
+        std::exception_ptr error
+    );
+
+    void finish_store(detail::store_state& state, std::exception_ptr error);
+
+    void begin_request();
+    void end_request(std::uint64_t byte_count);
+
+    void submit(std::vector<detail::io_operation>&& operations) noexcept;
+};
+
+} // namespace vt
+
+#include <vt/ndarray/impl/async_io.ipp>
+
+#endif // VT_NDARRAY_ASYNC_IO_HPP_
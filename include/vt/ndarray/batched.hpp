@@ -0,0 +1,109 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_BATCHED_HPP_
+#define VT_NDARRAY_BATCHED_HPP_
+
+#include <vt/ndarray/view.hpp>
+
+#include <cstddef>
+
+
+namespace vt {
+
+enum class batch_layout {
+    // Shape {batch, rows, cols}: the matrices are stored one after another.
+    leading,
+    // Shape {rows, cols, batch}: element (i, j) of all matrices is stored
+    // consecutively.
+    interleaved
+};
+
+
+template<typename T>
+void batched_mul(
+    detail::nondeduced_t<ndview<const T, 3>> A,
+    detail::nondeduced_t<ndview<const T, 3>> B,
+    ndview<T, 3> C,
+    batch_layout layout = batch_layout::leading,
+    std::size_t thread_count = 1
+);
+
+
+template<typename T>
+bool batched_cholesky(
+    ndview<T, 3> A,
+    batch_layout layout = batch_layout::leading,
+    std::size_t thread_count = 1
+);
+
+template<typename T>
+void batched_cholesky_solve(
+    detail::nondeduced_t<ndview<const T, 3>> L,
+    ndview<T, 3> B,
+    batch_layout layout = batch_layout::leading,
+    std::size_t thread_count = 1
+);
+
+
+template<typename T>
+bool batched_lu(
+    ndview<T, 3> A,
+    ndview<std::size_t, 2> pivots,
+    batch_layout layout = batch_layout::leading,
+    std::size_t thread_count = 1
+);
+
+template<typename T>
+void batched_lu_solve(
+    detail::nondeduced_t<ndview<const T, 3>> LU,
+    ndview<const std::size_t, 2> pivots,
+    ndview<T, 3> B,
+    batch_layout layout = batch_layout::leading,
+    std::size_t thread_count = 1
+);
+
+
+template<typename T>
+bool batched_inverse(
+    detail::nondeduced_t<ndview<const T, 3>> A,
+    ndview<T, 3> A_inv,
+    batch_layout layout = batch_layout::leading,
+    std::size_t thread_count = 1
+);
+
+
+template<typename T>
+void interleave(
+    detail::nondeduced_t<ndview<const T, 3>> src,
+    ndview<T, 3> dst
+) noexcept;
+
+template<typename T>
+void deinterleave(
+    detail::nondeduced_t<ndview<const T, 3>> src,
+    ndview<T, 3> dst
+) noexcept;
+
+} // namespace vt
+
+#include <vt/ndarray/impl/batched.ipp>
+
+#endif // VT_NDARRAY_BATCHED_HPP_
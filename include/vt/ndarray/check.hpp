@@ -0,0 +1,49 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_CHECK_HPP_
+#define VT_NDARRAY_CHECK_HPP_
+
+// Selects which preconditions of views and arrays are verified at run time:
+// 0 checks nothing, 1 checks index and slice ranges, and 2 additionally checks
+// reshapes and reports the offending index and shape. Must be the same in all
+// translation units of a program.
+#ifndef VT_NDARRAY_CHECK_LEVEL
+#   ifdef NDEBUG
+#       define VT_NDARRAY_CHECK_LEVEL 0
+#   else
+#       define VT_NDARRAY_CHECK_LEVEL 2
+#   endif
+#endif
+
+
+namespace vt {
+
+using check_handler = void (*)(const char* message) noexcept;
+
+check_handler set_check_handler(check_handler handler) noexcept;
+
+check_handler get_check_handler() noexcept;
+
+} // namespace vt
+
+#include <vt/ndarray/impl/check.ipp>
+
+#endif // VT_NDARRAY_CHECK_HPP_
@@ -0,0 +1,112 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_COMPRESSED_HPP_
+#define VT_NDARRAY_COMPRESSED_HPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+
+namespace vt {
+
+struct compression_options {
+    // Number of rows (indices in the first dimension) per chunk. When 0, a
+    // chunk size of roughly 64 KiB is chosen.
+    std::size_t chunk_rows = 0;
+    // Maximum number of decompressed chunks kept in memory.
+    std::size_t cache_chunks = 4;
+    // Maximum absolute error per element for floating-point data. When 0,
+    // floating-point data is compressed losslessly.
+    double error_bound = 0.0;
+};
+
+
+template<typename T, std::size_t N>
+class compressed_ndarray {
+    static_assert(std::is_arithmetic_v<T>);
+    static_assert(std::is_same_v<std::remove_cv_t<T>, T>);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr std::size_t dim_count = N;
+
+    compressed_ndarray() noexcept;
+    explicit compressed_ndarray(
+        ndview<const T, N> src,
+        const compression_options& options = compression_options{}
+    );
+
+    decltype(auto) operator[](std::size_t idx);
+
+    std::size_t element_count() const noexcept;
+
+    const std::array<std::size_t, N>& shape() const noexcept;
+    std::size_t shape(std::size_t dim) const noexcept;
+
+    std::size_t chunk_rows() const noexcept;
+    std::size_t chunk_count() const noexcept;
+
+    std::size_t compressed_size() const noexcept;
+
+    ndview<const T, N> chunk(std::size_t idx);
+
+    void decompress(ndview<T, N> dst) const;
+    ndarray<T, N> decompress() const;
+
+    void clear_cache() noexcept;
+
+private:
+    // Labels a cache entry that does not hold a decoded chunk
+    static constexpr std::size_t no_chunk =
+        std::numeric_limits<std::size_t>::max();
+
+    struct cache_entry {
+        std::size_t chunk;
+        std::size_t last_use;
+        ndarray<T, N> data;
+    };
+
+    std::array<std::size_t, N> _shape;
+    std::size_t _chunk_rows;
+    std::size_t _cache_capacity;
+    std::vector<unsigned char> _storage;
+    std::vector<std::size_t> _offsets;
+
+    std::vector<cache_entry> _cache;
+    std::size_t _use_counter;
+
+    std::array<std::size_t, N> chunk_shape(std::size_t idx) const noexcept;
+    void decompress_chunk(std::size_t idx, T* dst) const;
+};
+
+} // namespace vt
+
+#include <vt/ndarray/impl/compressed.ipp>
+
+#endif // VT_NDARRAY_COMPRESSED_HPP_
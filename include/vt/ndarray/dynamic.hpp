@@ -0,0 +1,243 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_DYNAMIC_HPP_
+#define VT_NDARRAY_DYNAMIC_HPP_
+
+#include <vt/ndarray/allocator.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+
+
+namespace vt {
+
+enum class dtype : unsigned char {
+    int8,
+    int16,
+    int32,
+    int64,
+    uint8,
+    uint16,
+    uint32,
+    uint64,
+    float32,
+    float64
+};
+
+
+template<typename T>
+struct dtype_tag {
+    using type = T;
+};
+
+
+namespace detail {
+
+template<typename T>
+constexpr dtype dtype_of_impl() noexcept;
+
+} // namespace detail
+
+
+template<typename T>
+inline constexpr dtype dtype_of = detail::dtype_of_impl<std::remove_cv_t<T>>();
+
+constexpr std::size_t dtype_size(dtype type) noexcept;
+
+template<typename F>
+decltype(auto) visit(dtype type, F&& f);
+
+
+class dynamic_shape {
+public:
+    static constexpr std::size_t inline_capacity = 4;
+
+    dynamic_shape() noexcept;
+    explicit dynamic_shape(std::size_t rank_);
+    dynamic_shape(std::initializer_list<std::size_t> shape_);
+    template<std::size_t N>
+    dynamic_shape(const std::array<std::size_t, N>& shape_);
+    dynamic_shape(const dynamic_shape& other);
+    dynamic_shape(dynamic_shape&& other) noexcept;
+
+    dynamic_shape& operator=(const dynamic_shape& other);
+    dynamic_shape& operator=(dynamic_shape&& other) noexcept;
+
+    std::size_t& operator[](std::size_t dim) noexcept;
+    std::size_t operator[](std::size_t dim) const noexcept;
+
+    std::size_t rank() const noexcept;
+    std::size_t element_count() const noexcept;
+
+    std::size_t* data() noexcept;
+    const std::size_t* data() const noexcept;
+
+    const std::size_t* begin() const noexcept;
+    const std::size_t* end() const noexcept;
+
+    template<std::size_t N>
+    std::array<std::size_t, N> to_array() const noexcept;
+
+private:
+    std::size_t _rank;
+    std::size_t _inline[inline_capacity];
+    std::unique_ptr<std::size_t[]> _heap;
+};
+
+
+bool operator==(const dynamic_shape& lhs, const dynamic_shape& rhs) noexcept;
+bool operator!=(const dynamic_shape& lhs, const dynamic_shape& rhs) noexcept;
+
+
+template<typename T>
+class dynamic_ndview {
+    static_assert(std::is_same_v<std::remove_const_t<T>, void>);
+
+public:
+    dynamic_ndview(vt::dtype type_, dynamic_shape shape_, T* data_) noexcept;
+    template<
+        typename U,
+        std::size_t N,
+        typename = std::enable_if_t<std::is_convertible_v<U*, T*>>
+    >
+    dynamic_ndview(ndview<U, N> view);
+
+    operator dynamic_ndview<const void>() const noexcept;
+
+    vt::dtype type() const noexcept;
+    std::size_t rank() const noexcept;
+
+    const dynamic_shape& shape() const noexcept;
+    std::size_t shape(std::size_t dim) const noexcept;
+
+    std::size_t element_count() const noexcept;
+    std::size_t byte_size() const noexcept;
+
+    T* data() const noexcept;
+
+    template<typename U, std::size_t N>
+    bool holds() const noexcept;
+
+    template<typename U, std::size_t N>
+    ndview<U, N> as() const noexcept;
+
+    template<typename U>
+    ndview<U, 1> flatten() const noexcept;
+
+private:
+    vt::dtype _type;
+    dynamic_shape _shape;
+    T* _data;
+};
+
+
+inline constexpr std::size_t max_visit_rank = 8;
+
+template<typename T, typename F>
+decltype(auto) visit(const dynamic_ndview<T>& view, F&& f);
+
+
+class dynamic_ndarray {
+public:
+    using allocator_type = ndarray_allocator<std::byte>;
+
+    dynamic_ndarray() noexcept;
+    dynamic_ndarray(
+        vt::dtype type_,
+        dynamic_shape shape_,
+        const allocator_type& alloc = allocator_type{}
+    );
+    template<typename T, std::size_t N>
+    explicit dynamic_ndarray(
+        ndview<T, N> view_,
+        const allocator_type& alloc = allocator_type{}
+    );
+    explicit dynamic_ndarray(
+        dynamic_ndview<const void> view_,
+        const allocator_type& alloc = allocator_type{}
+    );
+    dynamic_ndarray(const dynamic_ndarray& other);
+    dynamic_ndarray(dynamic_ndarray&& other) noexcept;
+
+    ~dynamic_ndarray();
+
+    dynamic_ndarray& operator=(const dynamic_ndarray& other);
+    dynamic_ndarray& operator=(dynamic_ndarray&& other) noexcept;
+
+    operator dynamic_ndview<void>() noexcept;
+    operator dynamic_ndview<const void>() const noexcept;
+
+    dynamic_ndview<void> view() noexcept;
+    dynamic_ndview<const void> view() const noexcept;
+    dynamic_ndview<const void> cview() const noexcept;
+
+    vt::dtype type() const noexcept;
+    std::size_t rank() const noexcept;
+
+    const dynamic_shape& shape() const noexcept;
+    std::size_t shape(std::size_t dim) const noexcept;
+
+    std::size_t element_count() const noexcept;
+    std::size_t byte_size() const noexcept;
+
+    void* data() noexcept;
+    const void* data() const noexcept;
+
+    allocator_type get_allocator() const noexcept;
+
+    template<typename U, std::size_t N>
+    bool holds() const noexcept;
+
+    template<typename U, std::size_t N>
+    ndview<U, N> as() noexcept;
+    template<typename U, std::size_t N>
+    ndview<const U, N> as() const noexcept;
+
+    template<typename U>
+    ndview<U, 1> flatten() noexcept;
+    template<typename U>
+    ndview<const U, 1> flatten() const noexcept;
+
+    void swap(dynamic_ndarray& other) noexcept;
+
+private:
+    allocator_type _alloc;
+    vt::dtype _type;
+    dynamic_shape _shape;
+    std::byte* _data;
+
+    void allocate();
+    void deallocate() noexcept;
+};
+
+
+void swap(dynamic_ndarray& a, dynamic_ndarray& b) noexcept;
+
+} // namespace vt
+
+#include <vt/ndarray/impl/dynamic.ipp>
+
+#endif // VT_NDARRAY_DYNAMIC_HPP_
@@ -0,0 +1,113 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_FFT_HPP_
+#define VT_NDARRAY_FFT_HPP_
+
+#include <vt/ndarray/allocator.hpp>
+#include <vt/ndarray/topology.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <complex>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+
+namespace vt {
+
+enum class fft_direction {
+    forward,
+    backward
+};
+
+
+// Plan for complex transforms of a fixed length, factored into radix 2, 3, 4
+// and 5 stages, with a generic stage for any other prime factor.
+template<typename T>
+class fft_plan {
+public:
+    explicit fft_plan(std::size_t n);
+
+    static std::shared_ptr<const fft_plan> get(std::size_t n);
+    static void clear_cache();
+
+    std::size_t size() const noexcept;
+
+    void execute(
+        std::complex<T>* data,
+        std::complex<T>* work,
+        std::size_t batch,
+        fft_direction direction
+    ) const noexcept;
+
+private:
+    struct stage {
+        std::size_t radix;
+        std::size_t length;
+        std::size_t twiddle_offset;
+    };
+
+    std::size_t _size;
+    std::vector<stage> _stages;
+    std::vector<std::complex<T>, ndarray_allocator<std::complex<T>>> _twiddles;
+    std::vector<std::complex<T>, ndarray_allocator<std::complex<T>>>
+        _inverse_twiddles;
+};
+
+
+template<typename T, std::size_t N>
+void fft(
+    detail::nondeduced_t<ndview<const std::complex<T>, N>> in,
+    ndview<std::complex<T>, N> out,
+    std::initializer_list<std::size_t> axes = {},
+    std::size_t thread_count = 1
+);
+
+template<typename T, std::size_t N>
+void ifft(
+    detail::nondeduced_t<ndview<const std::complex<T>, N>> in,
+    ndview<std::complex<T>, N> out,
+    std::initializer_list<std::size_t> axes = {},
+    std::size_t thread_count = 1
+);
+
+template<typename T, std::size_t N>
+void rfft(
+    detail::nondeduced_t<ndview<const T, N>> in,
+    ndview<std::complex<T>, N> out,
+    std::initializer_list<std::size_t> axes = {},
+    std::size_t thread_count = 1
+);
+
+template<typename T, std::size_t N>
+void irfft(
+    detail::nondeduced_t<ndview<const std::complex<T>, N>> in,
+    ndview<T, N> out,
+    std::initializer_list<std::size_t> axes = {},
+    std::size_t thread_count = 1
+);
+
+} // namespace vt
+
+#include <vt/ndarray/impl/fft.ipp>
+
+#endif // VT_NDARRAY_FFT_HPP_
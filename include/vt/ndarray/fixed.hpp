@@ -0,0 +1,131 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_FIXED_HPP_
+#define VT_NDARRAY_FIXED_HPP_
+
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+
+
+namespace vt {
+
+// N-dimensional array with a shape that is fixed at compile time and inline
+// storage, usable in constant expressions.
+template<typename T, std::size_t... Extents>
+class fixed_ndarray {
+    static_assert(std::is_same_v<std::remove_cv_t<T>, T>);
+    static_assert(sizeof...(Extents) > 0);
+    static_assert(((Extents > 0) && ...));
+
+public:
+    static constexpr std::size_t dim_count = sizeof...(Extents);
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = typename ndview<T, dim_count>::iterator;
+    using const_iterator = typename ndview<T, dim_count>::const_iterator;
+    using reverse_iterator = typename ndview<T, dim_count>::reverse_iterator;
+    using const_reverse_iterator =
+        typename ndview<T, dim_count>::const_reverse_iterator;
+
+    constexpr fixed_ndarray() noexcept(
+        std::is_nothrow_default_constructible_v<T>
+    );
+    template<
+        typename... U,
+        typename = std::enable_if_t<
+            sizeof...(U) == (Extents * ...) &&
+            (std::is_convertible_v<const U&, T> && ...)
+        >
+    >
+    constexpr fixed_ndarray(const U&... init);
+
+    static constexpr fixed_ndarray filled(const T& init);
+
+    constexpr decltype(auto) operator[](std::size_t idx) noexcept;
+    constexpr decltype(auto) operator[](std::size_t idx) const noexcept;
+
+    constexpr operator ndview<T, dim_count>() noexcept;
+    constexpr operator ndview<const T, dim_count>() const noexcept;
+
+    constexpr ndview<T, dim_count> view() noexcept;
+    constexpr ndview<const T, dim_count> view() const noexcept;
+    constexpr ndview<const T, dim_count> cview() const noexcept;
+
+    static constexpr std::size_t element_count() noexcept;
+
+    static constexpr std::array<std::size_t, dim_count> shape() noexcept;
+    static constexpr std::size_t shape(std::size_t dim) noexcept;
+
+    constexpr T* data() noexcept;
+    constexpr const T* data() const noexcept;
+
+    constexpr iterator begin() noexcept;
+    constexpr const_iterator begin() const noexcept;
+    constexpr const_iterator cbegin() const noexcept;
+
+    constexpr iterator end() noexcept;
+    constexpr const_iterator end() const noexcept;
+    constexpr const_iterator cend() const noexcept;
+
+    constexpr reverse_iterator rbegin() noexcept;
+    constexpr const_reverse_iterator rbegin() const noexcept;
+    constexpr const_reverse_iterator crbegin() const noexcept;
+
+    constexpr reverse_iterator rend() noexcept;
+    constexpr const_reverse_iterator rend() const noexcept;
+    constexpr const_reverse_iterator crend() const noexcept;
+
+private:
+    T _data[(Extents * ...)];
+};
+
+
+template<typename T, std::size_t... Extents>
+constexpr bool operator==(
+    const fixed_ndarray<T, Extents...>& a,
+    const fixed_ndarray<T, Extents...>& b
+);
+template<typename T, std::size_t... Extents>
+constexpr bool operator!=(
+    const fixed_ndarray<T, Extents...>& a,
+    const fixed_ndarray<T, Extents...>& b
+);
+
+template<typename T, std::size_t... Extents>
+std::ostream& operator<<(
+    std::ostream& os,
+    const fixed_ndarray<T, Extents...>& a
+);
+
+} // namespace vt
+
+#include <vt/ndarray/impl/fixed.ipp>
+
+#endif // VT_NDARRAY_FIXED_HPP_
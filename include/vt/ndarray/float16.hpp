@@ -0,0 +1,119 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_FLOAT16_HPP_
+#define VT_NDARRAY_FLOAT16_HPP_
+
+#include <vt/ndarray/view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+
+namespace vt {
+
+// IEEE 754 binary16: 1 sign bit, 5 exponent bits, 10 mantissa bits.
+class half {
+public:
+    half() noexcept = default;
+    half(float value) noexcept;
+
+    operator float() const noexcept;
+
+    static constexpr half from_bits(std::uint16_t bits_) noexcept;
+    constexpr std::uint16_t bits() const noexcept;
+
+private:
+    std::uint16_t _bits;
+};
+
+
+// Brain floating point: 1 sign bit, 8 exponent bits, 7 mantissa bits. It has
+// the range of float with reduced precision.
+class bfloat16 {
+public:
+    bfloat16() noexcept = default;
+    bfloat16(float value) noexcept;
+
+    operator float() const noexcept;
+
+    static constexpr bfloat16 from_bits(std::uint16_t bits_) noexcept;
+    constexpr std::uint16_t bits() const noexcept;
+
+private:
+    std::uint16_t _bits;
+};
+
+
+namespace detail {
+
+// Whether T is one of the 16-bit floating-point types, optionally const
+template<typename T>
+inline constexpr bool is_float16_v =
+    std::is_same_v<std::remove_const_t<T>, half> ||
+    std::is_same_v<std::remove_const_t<T>, bfloat16>;
+
+} // namespace detail
+
+
+template<std::size_t N>
+void convert(
+    detail::nondeduced_t<ndview<const float, N>> src,
+    ndview<half, N> dst
+) noexcept;
+template<std::size_t N>
+void convert(
+    detail::nondeduced_t<ndview<const half, N>> src,
+    ndview<float, N> dst
+) noexcept;
+template<std::size_t N>
+void convert(
+    detail::nondeduced_t<ndview<const float, N>> src,
+    ndview<bfloat16, N> dst
+) noexcept;
+template<std::size_t N>
+void convert(
+    detail::nondeduced_t<ndview<const bfloat16, N>> src,
+    ndview<float, N> dst
+) noexcept;
+
+template<
+    typename T,
+    std::size_t N,
+    typename = std::enable_if_t<detail::is_float16_v<T>>
+>
+float sum(ndview<T, N> x) noexcept;
+
+template<
+    typename T,
+    std::size_t N,
+    typename = std::enable_if_t<detail::is_float16_v<T>>
+>
+float dot(
+    ndview<T, N> x,
+    detail::nondeduced_t<ndview<const T, N>> y
+) noexcept;
+
+} // namespace vt
+
+#include <vt/ndarray/impl/float16.ipp>
+
+#endif // VT_NDARRAY_FLOAT16_HPP_
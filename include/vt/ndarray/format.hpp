@@ -0,0 +1,97 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_FORMAT_HPP_
+#define VT_NDARRAY_FORMAT_HPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+
+namespace vt {
+
+struct format_options {
+    // Significant digits of floating point numbers. Negative for the shortest
+    // representation that reads back to the same value.
+    int precision = -1;
+    // Arrays with more elements than this are summarized.
+    std::size_t threshold = 1000;
+    // Number of leading and trailing items of each dimension that are shown
+    // in a summarized array.
+    std::size_t edge_items = 3;
+};
+
+
+template<typename T, std::size_t N>
+void write_text(
+    std::ostream& os,
+    ndview<T, N> a,
+    const format_options& options = {}
+);
+template<typename T, std::size_t N, typename Allocator>
+void write_text(
+    std::ostream& os,
+    const ndarray<T, N, Allocator>& a,
+    const format_options& options = {}
+);
+
+template<typename T, std::size_t N>
+std::string to_string(ndview<T, N> a, const format_options& options = {});
+template<typename T, std::size_t N, typename Allocator>
+std::string to_string(
+    const ndarray<T, N, Allocator>& a,
+    const format_options& options = {}
+);
+
+
+template<typename T, std::size_t N>
+ndarray<T, N> parse_text(std::string_view text);
+
+template<typename T, std::size_t N>
+ndarray<T, N> read_text(std::istream& is);
+
+
+template<typename T, std::size_t N>
+void write_binary(
+    std::ostream& os,
+    ndview<T, N> a,
+    std::size_t alignment = 64
+);
+template<typename T, std::size_t N, typename Allocator>
+void write_binary(
+    std::ostream& os,
+    const ndarray<T, N, Allocator>& a,
+    std::size_t alignment = 64
+);
+
+template<typename T, std::size_t N>
+ndarray<T, N> read_binary(std::istream& is);
+
+} // namespace vt
+
+#include <vt/ndarray/impl/format.ipp>
+
+#endif // VT_NDARRAY_FORMAT_HPP_
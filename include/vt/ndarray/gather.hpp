@@ -0,0 +1,87 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_GATHER_HPP_
+#define VT_NDARRAY_GATHER_HPP_
+
+#include <vt/ndarray/view.hpp>
+
+#include <cstddef>
+
+
+namespace vt {
+
+// How scatter combines a source element with the destination element it is
+// written to.
+enum class scatter_op {
+    assign,
+    add,
+    min,
+    max
+};
+
+
+// dst[i] = src[indices[i]] for every index along the first dimension. For
+// N > 1, whole sub-arrays are copied.
+template<typename T, typename Index = std::size_t, std::size_t N>
+void gather(
+    detail::nondeduced_t<ndview<const T, N>> src,
+    detail::nondeduced_t<ndview<const Index, 1>> indices,
+    ndview<T, N> dst,
+    std::size_t thread_count = 1
+);
+
+// dst[indices[i]] = op(dst[indices[i]], src[i]) for every index along the
+// first dimension. For N > 1, whole sub-arrays are combined.
+template<typename T, typename Index = std::size_t, std::size_t N>
+void scatter(
+    detail::nondeduced_t<ndview<const T, N>> src,
+    detail::nondeduced_t<ndview<const Index, 1>> indices,
+    ndview<T, N> dst,
+    scatter_op op = scatter_op::assign,
+    std::size_t thread_count = 1
+);
+
+// Gathers along one axis: dst[..., i, ...] = src[..., indices[..., i, ...],
+// ...], where indices has the shape of dst.
+template<typename T, typename Index = std::size_t, std::size_t N>
+void take_along_axis(
+    detail::nondeduced_t<ndview<const T, N>> src,
+    detail::nondeduced_t<ndview<const Index, N>> indices,
+    ndview<T, N> dst,
+    std::size_t axis,
+    std::size_t thread_count = 1
+);
+
+// Copies the elements of src for which mask is true to the front of dst, in
+// order, and returns their count.
+template<typename T>
+std::size_t compress(
+    detail::nondeduced_t<ndview<const T, 1>> src,
+    ndview<const bool, 1> mask,
+    ndview<T, 1> dst,
+    std::size_t thread_count = 1
+);
+
+} // namespace vt
+
+#include <vt/ndarray/impl/gather.ipp>
+
+#endif // VT_NDARRAY_GATHER_HPP_
@@ -0,0 +1,92 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_HISTOGRAM_HPP_
+#define VT_NDARRAY_HISTOGRAM_HPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/topology.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <cstddef>
+
+
+namespace vt {
+
+// Consecutive bins [edges[i], edges[i + 1]). The last bin also contains its
+// upper edge.
+template<typename T>
+class histogram_bins {
+public:
+    histogram_bins(std::size_t bin_count, T low, T high);
+    explicit histogram_bins(ndview<const T, 1> edges_);
+
+    std::size_t bin_count() const noexcept;
+    ndview<const T, 1> edges() const noexcept;
+    bool is_uniform() const noexcept;
+
+    // Bin that contains value, or bin_count() if there is none
+    std::size_t bin(T value) const noexcept;
+
+private:
+    ndarray<T, 1> _edges;
+    bool _uniform;
+};
+
+
+template<typename T, std::size_t N>
+ndarray<std::size_t, 1> histogram(
+    ndview<const T, N> data,
+    const histogram_bins<T>& bins,
+    std::size_t thread_count = 1
+);
+
+template<typename T, typename W, std::size_t N>
+ndarray<W, 1> histogram(
+    ndview<const T, N> data,
+    ndview<const W, N> weights,
+    const histogram_bins<T>& bins,
+    std::size_t thread_count = 1
+);
+
+template<typename T, std::size_t N>
+ndarray<std::size_t, 2> histogram2d(
+    ndview<const T, N> x,
+    ndview<const T, N> y,
+    const histogram_bins<T>& x_bins,
+    const histogram_bins<T>& y_bins,
+    std::size_t thread_count = 1
+);
+
+template<typename T, typename W, std::size_t N>
+ndarray<W, 2> histogram2d(
+    ndview<const T, N> x,
+    ndview<const T, N> y,
+    ndview<const W, N> weights,
+    const histogram_bins<T>& x_bins,
+    const histogram_bins<T>& y_bins,
+    std::size_t thread_count = 1
+);
+
+} // namespace vt
+
+#include <vt/ndarray/impl/histogram.ipp>
+
+#endif // VT_NDARRAY_HISTOGRAM_HPP_
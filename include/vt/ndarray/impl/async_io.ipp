@@ -0,0 +1,1003 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_ASYNC_IO_IPP_
+#define VT_NDARRAY_IMPL_ASYNC_IO_IPP_
+
+#include <vt/ndarray/allocator.hpp>
+#include <vt/ndarray/format.hpp>
+#include <vt/ndarray/impl/config.ipp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if VT_NDARRAY_POSIX
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#   include <linux/io_uring.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#endif
+
+// IORING_OP_READ and IORING_OP_WRITE were added in the same release as
+// IORING_FEAT_RW_CUR_POS (Linux 5.6).
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS)
+#   define VT_NDARRAY_IO_URING 1
+#else
+#   define VT_NDARRAY_IO_URING 0
+#endif
+
+
+namespace vt {
+
+inline double io_stats::bandwidth() const noexcept {
+    return seconds > 0.0 ? static_cast<double>(byte_count) / seconds : 0.0;
+}
+
+
+namespace detail {
+
+// Read or write of size bytes at offset in a file. done is called with the
+// number of bytes transferred, which is less than size only at the end of
+// the file, or with a negative error number.
+struct io_operation {
+    int fd;
+    bool write;
+    unsigned char* buffer;
+    std::size_t size;
+    std::uint64_t offset;
+    std::function<void(std::int64_t)> done;
+};
+
+
+// Operations of a load or store that are in flight at the same time. The
+// first error is kept, and the last operation to finish reports the result.
+class io_group {
+public:
+    io_group() noexcept;
+
+    void expect(int count) noexcept;
+    // Returns true for the last operation of the group
+    bool finish(std::exception_ptr error) noexcept;
+
+    std::exception_ptr error() const noexcept;
+
+private:
+    std::atomic<int> _remaining;
+    std::atomic<bool> _failed;
+    std::exception_ptr _error;
+};
+
+
+inline io_group::io_group() noexcept :
+    _remaining{0},
+    _failed{false},
+    _error{}
+{
+}
+
+
+inline void io_group::expect(int count) noexcept {
+    _remaining.store(count, std::memory_order_relaxed);
+}
+
+
+inline bool io_group::finish(std::exception_ptr error) noexcept {
+    if (error && !_failed.exchange(true, std::memory_order_relaxed)) {
+        _error = std::move(error);
+    }
+
+    return _remaining.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+
+inline std::exception_ptr io_group::error() const noexcept {
+    return _error;
+}
+
+
+// File of a load or store, which is closed when the last operation on it has
+// finished
+struct io_file {
+    std::string path;
+    int fd;
+    io_group group;
+
+    explicit io_file(const std::string& path_);
+    io_file(const io_file&) = delete;
+
+    ~io_file();
+
+    io_file& operator=(const io_file&) = delete;
+};
+
+
+inline io_file::io_file(const std::string& path_) :
+    path{path_},
+    fd{-1},
+    group{}
+{
+}
+
+
+inline io_file::~io_file() {
+#if VT_NDARRAY_POSIX
+    if (fd >= 0) ::close(fd);
+#endif
+}
+
+
+template<typename T, std::size_t N>
+struct load_state : io_file {
+    std::promise<ndarray<T, N>> promise;
+    // First block of the file, and then the last partial block of the
+    // elements if they are read with O_DIRECT
+    ndarray<unsigned char, 1> block;
+    ndarray<T, N> result;
+
+    explicit load_state(const std::string& path_);
+};
+
+
+template<typename T, std::size_t N>
+load_state<T, N>::load_state(const std::string& path_) :
+    io_file{path_},
+    promise{},
+    block(
+        std::array<std::size_t, 1>{ io_block_size },
+        ndarray_allocator<unsigned char>{std::align_val_t{io_block_size}}
+    ),
+    result{}
+{
+}
+
+
+struct store_state : io_file {
+    std::promise<void> promise;
+    std::vector<unsigned char> header;
+    // Elements in little-endian byte order, on big-endian hosts only
+    std::vector<unsigned char> swapped;
+    std::size_t size;
+
+    explicit store_state(const std::string& path_);
+};
+
+
+inline store_state::store_state(const std::string& path_) :
+    io_file{path_},
+    promise{},
+    header{},
+    swapped{},
+    size{0}
+{
+}
+
+
+inline std::exception_ptr io_error(
+    std::int64_t result,
+    std::size_t expected,
+    const std::string& path
+) {
+    if (result < 0) {
+        return std::make_exception_ptr(std::system_error{
+            static_cast<int>(-result), std::generic_category(),
+            "vt::io_context: " + path
+        });
+    }
+    if (static_cast<std::uint64_t>(result) < expected) {
+        return std::make_exception_ptr(std::runtime_error{
+            "vt::io_context: " + path + ": unexpected end of file"
+        });
+    }
+
+    return nullptr;
+}
+
+
+#if VT_NDARRAY_POSIX
+
+// Synchronous implementation of an operation, for the fallback
+inline std::int64_t transfer(const io_operation& operation) noexcept {
+    std::size_t transferred = 0;
+    while (transferred < operation.size) {
+        const ::off_t offset =
+            static_cast<::off_t>(operation.offset + transferred);
+        const ::ssize_t n = operation.write
+            ? ::pwrite(operation.fd, operation.buffer + transferred,
+                operation.size - transferred, offset)
+            : ::pread(operation.fd, operation.buffer + transferred,
+                operation.size - transferred, offset);
+
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        if (n == 0) break;
+        transferred += static_cast<std::size_t>(n);
+    }
+
+    return static_cast<std::int64_t>(transferred);
+}
+
+
+// Switches a file to reads that bypass the page cache. Returns false if the
+// file system does not support it.
+inline bool enable_direct_io(int fd) noexcept {
+#if defined(O_DIRECT)
+    const int flags = ::fcntl(fd, F_GETFL);
+
+    return flags >= 0 && ::fcntl(fd, F_SETFL, flags | O_DIRECT) == 0;
+#else
+    static_cast<void>(fd);
+    return false;
+#endif
+}
+
+#endif // VT_NDARRAY_POSIX
+
+
+#if VT_NDARRAY_IO_URING
+
+// Submission and completion queues that are shared with the kernel, and a
+// thread that waits for completions. Operations beyond the queue depth wait
+// in a queue of their own until an earlier operation has finished.
+class uring_queue {
+public:
+    uring_queue(const uring_queue&) = delete;
+
+    ~uring_queue();
+
+    uring_queue& operator=(const uring_queue&) = delete;
+
+    // Returns nullptr if io_uring is not available, for example because the
+    // kernel is too old or a seccomp filter blocks it
+    static std::unique_ptr<uring_queue> create(std::size_t depth);
+
+    std::size_t submit(std::vector<io_operation>& operations) noexcept;
+
+private:
+    struct slot {
+        io_operation operation;
+        std::size_t transferred;
+    };
+
+    int _fd;
+    void* _rings;
+    std::size_t _rings_size;
+    io_uring_sqe* _sqes;
+    std::size_t _sqes_size;
+    std::atomic<std::uint32_t>* _sq_head;
+    std::atomic<std::uint32_t>* _sq_tail;
+    std::uint32_t _sq_mask;
+    std::uint32_t* _sq_array;
+    std::atomic<std::uint32_t>* _cq_head;
+    std::atomic<std::uint32_t>* _cq_tail;
+    std::uint32_t _cq_mask;
+    io_uring_cqe* _cqes;
+
+    std::mutex _mutex;
+    std::vector<slot> _slots;
+    std::vector<std::uint32_t> _free_slots;
+    std::deque<io_operation> _waiting;
+    std::thread _thread;
+
+    uring_queue(
+        int fd,
+        const io_uring_params& params,
+        void* rings,
+        std::size_t rings_size,
+        void* sqes,
+        std::size_t sqes_size,
+        std::size_t depth
+    );
+
+    template<typename U>
+    U* ring_field(std::uint32_t offset) const noexcept;
+
+    void push(
+        std::uint8_t opcode,
+        const io_operation& operation,
+        std::size_t transferred,
+        std::uint64_t user_data
+    ) noexcept;
+    void fill() noexcept;
+    void enter(bool wait) noexcept;
+    void run() noexcept;
+};
+
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t));
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+
+// Reads and writes are split so that their length fits in the 32-bit length
+// of a submission, and resubmitted if they are short.
+constexpr std::size_t uring_max_transfer = std::size_t{1} << 30;
+
+
+inline uring_queue::uring_queue(
+    int fd,
+    const io_uring_params& params,
+    void* rings,
+    std::size_t rings_size,
+    void* sqes,
+    std::size_t sqes_size,
+    std::size_t depth
+) :
+    _fd{fd},
+    _rings{rings},
+    _rings_size{rings_size},
+    _sqes{static_cast<io_uring_sqe*>(sqes)},
+    _sqes_size{sqes_size},
+    _sq_head{this->ring_field<std::atomic<std::uint32_t>>(params.sq_off.head)},
+    _sq_tail{this->ring_field<std::atomic<std::uint32_t>>(params.sq_off.tail)},
+    _sq_mask{*this->ring_field<std::uint32_t>(params.sq_off.ring_mask)},
+    _sq_array{this->ring_field<std::uint32_t>(params.sq_off.array)},
+    _cq_head{this->ring_field<std::atomic<std::uint32_t>>(params.cq_off.head)},
+    _cq_tail{this->ring_field<std::atomic<std::uint32_t>>(params.cq_off.tail)},
+    _cq_mask{*this->ring_field<std::uint32_t>(params.cq_off.ring_mask)},
+    _cqes{this->ring_field<io_uring_cqe>(params.cq_off.cqes)},
+    _mutex{},
+    _slots(depth),
+    _free_slots(depth),
+    _waiting{},
+    _thread{}
+{
+    for (std::size_t i = 0; i < depth; ++i) {
+        _free_slots[i] = static_cast<std::uint32_t>(depth - 1 - i);
+    }
+
+    _thread = std::thread{[this] { this->run(); }};
+}
+
+
+// All operations must have finished.
+inline uring_queue::~uring_queue() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        // Wakes up the thread, which stops at a completion without slot
+        this->push(IORING_OP_NOP, io_operation{-1, false, nullptr, 0, 0, {}},
+            0, 0);
+    }
+    this->enter(false);
+    _thread.join();
+
+    ::munmap(_sqes, _sqes_size);
+    ::munmap(_rings, _rings_size);
+    ::close(_fd);
+}
+
+
+inline std::unique_ptr<uring_queue> uring_queue::create(std::size_t depth) {
+    assert(depth > 0 && depth < (1u << 15));
+
+    // One more entry than the depth, for the submission that stops the thread
+    io_uring_params params{};
+    const int fd = static_cast<int>(::syscall(__NR_io_uring_setup,
+        static_cast<unsigned>(depth + 1), &params));
+    if (fd < 0) return nullptr;
+
+    const auto fail = [fd] {
+        ::close(fd);
+        return nullptr;
+    };
+
+    const std::uint32_t required =
+        IORING_FEAT_SINGLE_MMAP | IORING_FEAT_RW_CUR_POS;
+    if ((params.features & required) != required) return fail();
+
+    // The submission and completion rings share one mapping.
+    const std::size_t rings_size = std::max(
+        params.sq_off.array + params.sq_entries * sizeof(std::uint32_t),
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe)
+    );
+    void* rings = ::mmap(nullptr, rings_size, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (rings == MAP_FAILED) return fail();
+
+    const std::size_t sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        ::munmap(rings, rings_size);
+        return fail();
+    }
+
+    return std::unique_ptr<uring_queue>{new uring_queue{
+        fd, params, rings, rings_size, sqes, sqes_size, depth
+    }};
+}
+
+
+// Queues the operations in order and returns how many were queued, which
+// is less than all of them only if memory runs out
+inline std::size_t uring_queue::submit(
+    std::vector<io_operation>& operations
+) noexcept {
+    std::size_t queued = 0;
+    try {
+        std::lock_guard<std::mutex> lock{_mutex};
+        try {
+            for (; queued < operations.size(); ++queued) {
+                _waiting.push_back(std::move(operations[queued]));
+            }
+        } catch (...) {
+            // The operations that are queued are still started
+        }
+        this->fill();
+    } catch (...) {
+        return queued;
+    }
+
+    // Operations that are submitted by a completion are passed to the kernel
+    // together when the thread waits for the next completions.
+    if (queued > 0 && std::this_thread::get_id() != _thread.get_id()) {
+        this->enter(false);
+    }
+
+    return queued;
+}
+
+
+template<typename U>
+U* uring_queue::ring_field(std::uint32_t offset) const noexcept {
+    return static_cast<U*>(
+        static_cast<void*>(static_cast<unsigned char*>(_rings) + offset)
+    );
+}
+
+
+// Requires the lock.
+inline void uring_queue::push(
+    std::uint8_t opcode,
+    const io_operation& operation,
+    std::size_t transferred,
+    std::uint64_t user_data
+) noexcept {
+    const std::uint32_t tail = _sq_tail->load(std::memory_order_relaxed);
+    const std::uint32_t index = tail & _sq_mask;
+
+    io_uring_sqe& sqe = _sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = opcode;
+    sqe.fd = operation.fd;
+    sqe.addr = reinterpret_cast<std::uintptr_t>(
+        operation.buffer + transferred
+    );
+    sqe.len = static_cast<std::uint32_t>(
+        std::min(operation.size - transferred, uring_max_transfer)
+    );
+    sqe.off = operation.offset + transferred;
+    sqe.user_data = user_data;
+
+    _sq_array[index] = index;
+    _sq_tail->store(tail + 1, std::memory_order_release);
+}
+
+
+// Moves waiting operations to free slots. Requires the lock.
+inline void uring_queue::fill() noexcept {
+    while (!_waiting.empty() && !_free_slots.empty()) {
+        const std::uint32_t index = _free_slots.back();
+        _free_slots.pop_back();
+
+        _slots[index] = slot{std::move(_waiting.front()), 0};
+        _waiting.pop_front();
+
+        const io_operation& operation = _slots[index].operation;
+        this->push(operation.write ? IORING_OP_WRITE : IORING_OP_READ,
+            operation, 0, index + 1);
+    }
+}
+
+
+// Passes all new submissions to the kernel, and optionally waits for at
+// least one completion
+inline void uring_queue::enter(bool wait) noexcept {
+    for (;;) {
+        const std::uint32_t to_submit =
+            _sq_tail->load(std::memory_order_acquire) -
+            _sq_head->load(std::memory_order_acquire);
+
+        const long result = ::syscall(__NR_io_uring_enter, _fd, to_submit,
+            wait ? 1u : 0u, wait ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+        if (result >= 0 || errno != EINTR) return;
+    }
+}
+
+
+inline void uring_queue::run() noexcept {
+    std::vector<std::pair<std::function<void(std::int64_t)>, std::int64_t>>
+        finished;
+
+    for (bool stopping = false; !stopping;) {
+        this->enter(true);
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            std::uint32_t head = _cq_head->load(std::memory_order_relaxed);
+            const std::uint32_t tail =
+                _cq_tail->load(std::memory_order_acquire);
+            for (; head != tail; ++head) {
+                const io_uring_cqe& cqe = _cqes[head & _cq_mask];
+                if (cqe.user_data == 0) {
+                    stopping = true;
+                    continue;
+                }
+
+                const auto index =
+                    static_cast<std::uint32_t>(cqe.user_data - 1);
+                slot& s = _slots[index];
+                if (cqe.res > 0) {
+                    s.transferred += static_cast<std::size_t>(cqe.res);
+                    if (s.transferred < s.operation.size) {
+                        this->push(s.operation.write
+                            ? IORING_OP_WRITE : IORING_OP_READ,
+                            s.operation, s.transferred, cqe.user_data);
+                        continue;
+                    }
+                }
+
+                finished.emplace_back(std::move(s.operation.done),
+                    cqe.res < 0
+                        ? cqe.res
+                        : static_cast<std::int64_t>(s.transferred));
+                _free_slots.push_back(index);
+            }
+            _cq_head->store(head, std::memory_order_release);
+
+            this->fill();
+        }
+
+        for (auto& [done, result] : finished) {
+            done(result);
+        }
+        finished.clear();
+    }
+}
+
+#else
+
+class uring_queue {};
+
+#endif // VT_NDARRAY_IO_URING
+
+} // namespace detail
+
+
+inline io_context::io_context(const io_options& options) :
+    _options{options},
+    _mutex{},
+    _idle{},
+    _active_count{0},
+    _busy_start{},
+    _stats{},
+    _uring{},
+    _pool{}
+{
+    assert(options.queue_depth > 0);
+
+#if VT_NDARRAY_IO_URING
+    if (!options.force_fallback) {
+        _uring = detail::uring_queue::create(options.queue_depth);
+    }
+#endif
+    if (!_uring) {
+        _pool = std::make_unique<detail::thread_pool>(options.thread_count);
+    }
+}
+
+
+inline io_context::~io_context() {
+    this->wait();
+}
+
+
+template<typename T, std::size_t N>
+std::future<ndarray<T, N>> io_context::load(const std::string& path) {
+    std::vector<detail::io_operation> operations;
+    std::future<ndarray<T, N>> result =
+        this->begin_load<T, N>(path, operations);
+    this->submit(std::move(operations));
+
+    return result;
+}
+
+
+// The headers of all files are submitted at once.
+template<typename T, std::size_t N>
+std::vector<std::future<ndarray<T, N>>> io_context::load(
+    const std::vector<std::string>& paths
+) {
+    std::vector<std::future<ndarray<T, N>>> results;
+    results.reserve(paths.size());
+
+    std::vector<detail::io_operation> operations;
+    operations.reserve(paths.size());
+    for (const std::string& path : paths) {
+        results.push_back(this->begin_load<T, N>(path, operations));
+    }
+    this->submit(std::move(operations));
+
+    return results;
+}
+
+
+// The header and the elements are written at the same time.
+template<typename T, std::size_t N>
+std::future<void> io_context::store(
+    const std::string& path,
+    ndview<const T, N> a
+) {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    auto state = std::make_shared<detail::store_state>(path);
+    std::future<void> result = state->promise.get_future();
+
+#if VT_NDARRAY_POSIX
+    state->fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+        0666);
+    if (state->fd < 0) {
+        state->promise.set_exception(detail::io_error(-errno, 0, path));
+        return result;
+    }
+
+    state->header = detail::make_binary_header<T, N>(a.shape(), io_block_size);
+    state->size = a.element_count() * sizeof(T);
+
+    // Only read by the write operations
+    unsigned char* elements = const_cast<unsigned char*>(
+        static_cast<const unsigned char*>(static_cast<const void*>(a.data()))
+    );
+    if (sizeof(T) > 1 && !detail::is_little_endian()) {
+        state->swapped.assign(elements, elements + state->size);
+        for (std::size_t i = 0; i < state->size; i += sizeof(T)) {
+            std::reverse(&state->swapped[i], &state->swapped[i] + sizeof(T));
+        }
+        elements = state->swapped.data();
+    }
+
+    this->begin_request();
+
+    std::vector<detail::io_operation> operations;
+    operations.push_back({
+        state->fd, true, state->header.data(), state->header.size(), 0,
+        [this, state](std::int64_t n) {
+            this->finish_store(*state,
+                detail::io_error(n, state->header.size(), state->path));
+        }
+    });
+    if (state->size > 0) {
+        operations.push_back({
+            state->fd, true, elements, state->size, state->header.size(),
+            [this, state](std::int64_t n) {
+                this->finish_store(*state,
+                    detail::io_error(n, state->size, state->path));
+            }
+        });
+    }
+    state->group.expect(static_cast<int>(operations.size()));
+    this->submit(std::move(operations));
+#else
+    state->size = a.element_count() * sizeof(T);
+    state->group.expect(1);
+    this->begin_request();
+    _pool->submit([this, state, a] {
+        std::exception_ptr error;
+        try {
+            std::ofstream os{state->path, std::ios::binary};
+            write_binary<T, N>(os, a, io_block_size);
+            if (!os.flush()) {
+                throw std::runtime_error{
+                    "vt::io_context: " + state->path + ": cannot write"
+                };
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+        this->finish_store(*state, error);
+    });
+#endif
+
+    return result;
+}
+
+
+inline void io_context::wait() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _idle.wait(lock, [this] { return _active_count == 0; });
+}
+
+
+inline io_stats io_context::stats() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    io_stats result = _stats;
+    if (_active_count > 0) {
+        result.seconds += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - _busy_start
+        ).count();
+    }
+
+    return result;
+}
+
+
+inline bool io_context::uses_io_uring() const noexcept {
+    return _uring != nullptr;
+}
+
+
+// The header is read on its own first, so that the elements can be read
+// into an array of the right shape.
+template<typename T, std::size_t N>
+std::future<ndarray<T, N>> io_context::begin_load(
+    const std::string& path,
+    std::vector<detail::io_operation>& operations
+) {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    auto state = std::make_shared<detail::load_state<T, N>>(path);
+    std::future<ndarray<T, N>> result = state->promise.get_future();
+
+#if VT_NDARRAY_POSIX
+    state->fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (state->fd < 0) {
+        state->promise.set_exception(detail::io_error(-errno, 0, path));
+        return result;
+    }
+
+    this->begin_request();
+    operations.push_back({
+        state->fd, false, state->block.data(), io_block_size, 0,
+        [this, state](std::int64_t n) {
+            this->load_elements(state, n);
+        }
+    });
+#else
+    static_cast<void>(operations);
+    state->group.expect(1);
+    this->begin_request();
+    _pool->submit([this, state] {
+        std::exception_ptr error;
+        try {
+            std::ifstream is{state->path, std::ios::binary};
+            if (!is) {
+                throw std::runtime_error{
+                    "vt::io_context: " + state->path + ": cannot open"
+                };
+            }
+            state->result = read_binary<T, N>(is);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        this->finish_load(*state, error);
+    });
+#endif
+
+    return result;
+}
+
+
+// Whole blocks of elements are read directly into the array if the file
+// system allows it, and the rest through the block buffer.
+template<typename T, std::size_t N>
+void io_context::load_elements(
+    const std::shared_ptr<detail::load_state<T, N>>& state,
+    std::int64_t header_size
+) {
+    std::vector<detail::io_operation> operations;
+
+    try {
+        const std::size_t header_end = detail::binary_fixed_header_size + 8 * N;
+        if (std::exception_ptr error =
+                detail::io_error(header_size, header_end, state->path)) {
+            std::rethrow_exception(error);
+        }
+
+        const std::string caller = "vt::io_context: " + state->path;
+        const std::uint64_t data_offset =
+            detail::check_binary_header<T, N>(state->block.data(),
+                caller.c_str());
+        const std::array<std::size_t, N> shape =
+            detail::load_binary_shape<T, N>(
+                state->block.data() + detail::binary_fixed_header_size,
+                caller.c_str()
+            );
+
+        state->result = ndarray<T, N>{shape, ndarray_allocator<T>{
+            std::align_val_t{std::max(io_block_size, alignof(T))}
+        }};
+
+        const std::size_t size = state->result.element_count() * sizeof(T);
+        unsigned char* elements = static_cast<unsigned char*>(
+            static_cast<void*>(state->result.data())
+        );
+
+#if VT_NDARRAY_POSIX
+        const bool direct = _options.direct && size >= io_block_size &&
+            data_offset % io_block_size == 0 &&
+            detail::enable_direct_io(state->fd);
+#else
+        const bool direct = false;
+#endif
+        const std::size_t direct_size =
+            direct ? size / io_block_size * io_block_size : 0;
+        const std::size_t rest = size - direct_size;
+
+        if (direct_size > 0) {
+            operations.push_back({
+                state->fd, false, elements, direct_size, data_offset,
+                [this, state, direct_size](std::int64_t n) {
+                    this->finish_load(*state,
+                        detail::io_error(n, direct_size, state->path));
+                }
+            });
+        }
+        if (rest > 0) {
+            operations.push_back({
+                state->fd, false,
+                direct ? state->block.data() : elements + direct_size,
+                direct ? io_block_size : rest,
+                data_offset + direct_size,
+                [this, state, direct, elements, direct_size, rest](
+                    std::int64_t n
+                ) {
+                    std::exception_ptr error =
+                        detail::io_error(n, rest, state->path);
+                    if (!error && direct) {
+                        std::memcpy(elements + direct_size,
+                            state->block.data(), rest);
+                    }
+                    this->finish_load(*state, std::move(error));
+                }
+            });
+        }
+        if (operations.empty()) {
+            state->group.expect(1);
+            this->finish_load(*state, nullptr);
+            return;
+        }
+
+        state->group.expect(static_cast<int>(operations.size()));
+        this->submit(std::move(operations));
+    } catch (...) {
+        state->group.expect(1);
+        this->finish_load(*state, std::current_exception());
+    }
+}
+
+
+template<typename T, std::size_t N>
+void io_context::finish_load(
+    detail::load_state<T, N>& state,
+    std::exception_ptr error
+) {
+    if (!state.group.finish(std::move(error))) return;
+
+    std::uint64_t byte_count = 0;
+    if (state.group.error()) {
+        state.promise.set_exception(state.group.error());
+    } else {
+        if (sizeof(T) > 1 && !detail::is_little_endian()) {
+            detail::swap_bytes(state.result.data(),
+                state.result.element_count());
+        }
+        byte_count = state.result.element_count() * sizeof(T);
+        state.promise.set_value(std::move(state.result));
+    }
+
+    this->end_request(byte_count);
+}
+
+
+inline void io_context::finish_store(
+    detail::store_state& state,
+    std::exception_ptr error
+) {
+    if (!state.group.finish(std::move(error))) return;
+
+    std::uint64_t byte_count = 0;
+    if (state.group.error()) {
+        state.promise.set_exception(state.group.error());
+    } else {
+        byte_count = state.size;
+        state.promise.set_value();
+    }
+
+    this->end_request(byte_count);
+}
+
+
+inline void io_context::begin_request() {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    if (_active_count++ == 0) {
+        _busy_start = std::chrono::steady_clock::now();
+    }
+}
+
+
+inline void io_context::end_request(std::uint64_t byte_count) {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    ++_stats.request_count;
+    _stats.byte_count += byte_count;
+    if (--_active_count == 0) {
+        _stats.seconds += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - _busy_start
+        ).count();
+        _idle.notify_all();
+    }
+}
+
+
+// Operations that cannot be queued for lack of memory complete with ENOMEM,
+// so that every operation completes exactly once.
+inline void io_context::submit(
+    std::vector<detail::io_operation>&& operations
+) noexcept {
+    std::size_t submitted = 0;
+
+#if VT_NDARRAY_IO_URING
+    if (_uring) {
+        submitted = _uring->submit(operations);
+    }
+#endif
+
+#if VT_NDARRAY_POSIX
+    if (_pool) {
+        try {
+            // Copied, so that the operation is left intact if submit throws
+            for (; submitted < operations.size(); ++submitted) {
+                _pool->submit([operation = operations[submitted]] {
+                    operation.done(detail::transfer(operation));
+                });
+            }
+        } catch (...) {
+            // The remaining operations fail below
+        }
+    }
+#endif
+
+    for (std::size_t i = submitted; i < operations.size(); ++i) {
+        operations[i].done(-ENOMEM);
+    }
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_ASYNC_IO_IPP_
@@ -0,0 +1,833 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_BATCHED_IPP_
+#define VT_NDARRAY_IMPL_BATCHED_IPP_
+
+#include <vt/ndarray/impl/parallel.ipp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace vt {
+
+namespace detail {
+
+// Number of matrices that the kernels below process together. Each kernel
+// loops over these lanes innermost, so that it vectorizes across the batch
+// regardless of the (small) matrix size.
+constexpr std::size_t batch_lanes = 16;
+
+
+struct batch_dims {
+    std::size_t batch;
+    std::size_t rows;
+    std::size_t cols;
+};
+
+
+template<typename T>
+batch_dims get_batch_dims(ndview<T, 3> a, batch_layout layout) noexcept {
+    const std::array<std::size_t, 3>& shape = a.shape();
+
+    if (layout == batch_layout::leading) {
+        return {shape[0], shape[1], shape[2]};
+    } else {
+        return {shape[2], shape[0], shape[1]};
+    }
+}
+
+
+// Packs up to batch_lanes consecutive matrices of a batch into a local
+// buffer in the interleaved layout, with a lane stride of batch_lanes. For
+// interleaved data this copies contiguous runs of lanes; using it in place
+// instead would put the elements of a matrix a batch size apart, which
+// aliases in the cache for large batches.
+template<typename U>
+class lane_block {
+public:
+    using value_type = std::remove_const_t<U>;
+
+    lane_block(
+        U* data,
+        std::size_t batch,
+        std::size_t element_count,
+        batch_layout layout
+    );
+
+    void bind(std::size_t first, std::size_t count) noexcept;
+    void load(std::size_t first, std::size_t count) noexcept;
+    void store() const noexcept;
+
+    value_type* data() noexcept;
+
+private:
+    U* _data;
+    std::size_t _batch;
+    std::size_t _element_count;
+    batch_layout _layout;
+    std::size_t _first;
+    std::size_t _count;
+    std::vector<value_type> _buffer;
+};
+
+
+template<typename U>
+lane_block<U>::lane_block(
+    U* data,
+    std::size_t batch,
+    std::size_t element_count,
+    batch_layout layout
+) :
+    _data{data},
+    _batch{batch},
+    _element_count{element_count},
+    _layout{layout},
+    _first{0},
+    _count{0},
+    _buffer(element_count * batch_lanes)
+{
+}
+
+
+template<typename U>
+void lane_block<U>::bind(std::size_t first, std::size_t count) noexcept {
+    assert(count <= batch_lanes);
+
+    _first = first;
+    _count = count;
+}
+
+
+template<typename U>
+void lane_block<U>::load(std::size_t first, std::size_t count) noexcept {
+    this->bind(first, count);
+
+    if (_layout == batch_layout::leading) {
+        for (std::size_t l = 0; l < count; ++l) {
+            const U* src = _data + (first + l) * _element_count;
+            for (std::size_t e = 0; e < _element_count; ++e) {
+                _buffer[e * batch_lanes + l] = src[e];
+            }
+        }
+    } else {
+        for (std::size_t e = 0; e < _element_count; ++e) {
+            std::copy_n(
+                _data + e * _batch + first,
+                count,
+                _buffer.data() + e * batch_lanes
+            );
+        }
+    }
+}
+
+
+template<typename U>
+void lane_block<U>::store() const noexcept {
+    static_assert(!std::is_const_v<U>);
+
+    if (_layout == batch_layout::leading) {
+        for (std::size_t l = 0; l < _count; ++l) {
+            U* dst = _data + (_first + l) * _element_count;
+            for (std::size_t e = 0; e < _element_count; ++e) {
+                dst[e] = _buffer[e * batch_lanes + l];
+            }
+        }
+    } else {
+        for (std::size_t e = 0; e < _element_count; ++e) {
+            std::copy_n(
+                _buffer.data() + e * batch_lanes,
+                _count,
+                _data + e * _batch + _first
+            );
+        }
+    }
+}
+
+
+template<typename U>
+typename lane_block<U>::value_type* lane_block<U>::data() noexcept {
+    return _buffer.data();
+}
+
+
+// Number of ranges of matrices that for_each_lane_range uses
+inline std::size_t lane_range_count(
+    std::size_t batch,
+    std::size_t thread_count
+) noexcept {
+    const std::size_t chunk_count = (batch + batch_lanes - 1) / batch_lanes;
+
+    return std::min(resolve_thread_count(thread_count), chunk_count);
+}
+
+
+// Calls f(range, first, last) concurrently for range_count ranges of
+// matrices that are a multiple of batch_lanes in size.
+template<typename F>
+void for_each_lane_range(std::size_t batch, std::size_t range_count, F&& f) {
+    const std::size_t chunk_count = (batch + batch_lanes - 1) / batch_lanes;
+
+    parallel_invoke(range_count, [&](std::size_t range) {
+        const std::size_t first_chunk = chunk_count * range / range_count;
+        const std::size_t last_chunk = chunk_count * (range + 1) / range_count;
+        f(
+            range,
+            first_chunk * batch_lanes,
+            std::min(last_chunk * batch_lanes, batch)
+        );
+    });
+}
+
+
+// One lane block for each range of for_each_lane_range, allocated up front
+// so that the worker threads do not allocate
+template<typename U>
+std::vector<lane_block<U>> make_lane_blocks(
+    std::size_t range_count,
+    U* data,
+    std::size_t batch,
+    std::size_t element_count,
+    batch_layout layout
+) {
+    return std::vector<lane_block<U>>(
+        range_count, lane_block<U>{data, batch, element_count, layout}
+    );
+}
+
+
+// In the kernels below, element (i, j) of lane l of a matrix with `cols`
+// columns is stored at a[(i * cols + j) * batch_lanes + l].
+
+// C = A B, with A m x k, B k x n and C m x n
+template<typename T>
+void gemm_lanes(
+    const T* a,
+    const T* b,
+    T* c,
+    std::size_t m, std::size_t k, std::size_t n,
+    std::size_t lanes
+) noexcept {
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            T* cij = c + (i * n + j) * batch_lanes;
+            std::fill(cij, cij + lanes, T{});
+
+            for (std::size_t p = 0; p < k; ++p) {
+                const T* aip = a + (i * k + p) * batch_lanes;
+                const T* bpj = b + (p * n + j) * batch_lanes;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    cij[l] += aip[l] * bpj[l];
+                }
+            }
+        }
+    }
+}
+
+
+// Overwrites the lower triangle of the n x n matrix A with its Cholesky
+// factor L and zeroes the strict upper triangle. Returns false if any of the
+// matrices is not positive definite.
+template<typename T>
+bool cholesky_lanes(T* a, std::size_t n, std::size_t lanes) noexcept {
+    bool failed = false;
+
+    for (std::size_t j = 0; j < n; ++j) {
+        T* ajj = a + (j * n + j) * batch_lanes;
+        for (std::size_t l = 0; l < lanes; ++l) {
+            failed |= !(ajj[l] > T{0});
+            ajj[l] = std::sqrt(ajj[l]);
+        }
+
+        for (std::size_t i = j + 1; i < n; ++i) {
+            T* aij = a + (i * n + j) * batch_lanes;
+            for (std::size_t l = 0; l < lanes; ++l) {
+                aij[l] /= ajj[l];
+            }
+        }
+
+        for (std::size_t i = j + 1; i < n; ++i) {
+            const T* aij = a + (i * n + j) * batch_lanes;
+            for (std::size_t p = j + 1; p <= i; ++p) {
+                T* aip = a + (i * n + p) * batch_lanes;
+                const T* apj = a + (p * n + j) * batch_lanes;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    aip[l] -= aij[l] * apj[l];
+                }
+            }
+
+            T* aji = a + (j * n + i) * batch_lanes;
+            std::fill(aji, aji + lanes, T{});
+        }
+    }
+
+    return !failed;
+}
+
+
+// Solves L L^T X = B in place, with B n x r
+template<typename T>
+void cholesky_solve_lanes(
+    const T* a,
+    T* b,
+    std::size_t n, std::size_t r,
+    std::size_t lanes
+) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t p = 0; p < i; ++p) {
+            const T* aip = a + (i * n + p) * batch_lanes;
+            for (std::size_t c = 0; c < r; ++c) {
+                T* bic = b + (i * r + c) * batch_lanes;
+                const T* bpc = b + (p * r + c) * batch_lanes;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    bic[l] -= aip[l] * bpc[l];
+                }
+            }
+        }
+
+        const T* aii = a + (i * n + i) * batch_lanes;
+        for (std::size_t c = 0; c < r; ++c) {
+            T* bic = b + (i * r + c) * batch_lanes;
+            for (std::size_t l = 0; l < lanes; ++l) {
+                bic[l] /= aii[l];
+            }
+        }
+    }
+
+    for (std::size_t i = n; i-- > 0;) {
+        for (std::size_t p = i + 1; p < n; ++p) {
+            const T* api = a + (p * n + i) * batch_lanes;
+            for (std::size_t c = 0; c < r; ++c) {
+                T* bic = b + (i * r + c) * batch_lanes;
+                const T* bpc = b + (p * r + c) * batch_lanes;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    bic[l] -= api[l] * bpc[l];
+                }
+            }
+        }
+
+        const T* aii = a + (i * n + i) * batch_lanes;
+        for (std::size_t c = 0; c < r; ++c) {
+            T* bic = b + (i * r + c) * batch_lanes;
+            for (std::size_t l = 0; l < lanes; ++l) {
+                bic[l] /= aii[l];
+            }
+        }
+    }
+}
+
+
+// LU factorization with partial pivoting: P A = L U, with unit lower
+// triangular L and upper triangular U stored in A. Row k was exchanged with
+// row pivots[k] in step k, like LAPACK's getrf. Returns false if any of the
+// matrices is singular.
+template<typename T>
+bool lu_lanes(
+    T* a,
+    std::size_t* pivots,
+    std::size_t n,
+    std::size_t lanes
+) noexcept {
+    bool failed = false;
+
+    for (std::size_t k = 0; k < n; ++k) {
+        std::array<T, batch_lanes> best;
+        std::size_t* pk = pivots + k * batch_lanes;
+
+        const T* akk = a + (k * n + k) * batch_lanes;
+        for (std::size_t l = 0; l < lanes; ++l) {
+            best[l] = std::abs(akk[l]);
+            pk[l] = k;
+        }
+        for (std::size_t i = k + 1; i < n; ++i) {
+            const T* aik = a + (i * n + k) * batch_lanes;
+            for (std::size_t l = 0; l < lanes; ++l) {
+                const T value = std::abs(aik[l]);
+                pk[l] = value > best[l] ? i : pk[l];
+                best[l] = value > best[l] ? value : best[l];
+            }
+        }
+
+        // The pivot rows differ per lane, so the exchange is done per lane
+        for (std::size_t l = 0; l < lanes; ++l) {
+            failed |= !(best[l] > T{0});
+
+            const std::size_t p = pk[l];
+            if (p == k) continue;
+            for (std::size_t j = 0; j < n; ++j) {
+                std::swap(
+                    a[(k * n + j) * batch_lanes + l],
+                    a[(p * n + j) * batch_lanes + l]
+                );
+            }
+        }
+
+        for (std::size_t i = k + 1; i < n; ++i) {
+            T* aik = a + (i * n + k) * batch_lanes;
+            for (std::size_t l = 0; l < lanes; ++l) {
+                aik[l] /= akk[l];
+            }
+
+            for (std::size_t j = k + 1; j < n; ++j) {
+                T* aij = a + (i * n + j) * batch_lanes;
+                const T* akj = a + (k * n + j) * batch_lanes;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    aij[l] -= aik[l] * akj[l];
+                }
+            }
+        }
+    }
+
+    return !failed;
+}
+
+
+// Solves A X = B in place using the factorization of lu_lanes, with B n x r
+template<typename T>
+void lu_solve_lanes(
+    const T* a,
+    const std::size_t* pivots,
+    T* b,
+    std::size_t n, std::size_t r,
+    std::size_t lanes
+) noexcept {
+    for (std::size_t k = 0; k < n; ++k) {
+        const std::size_t* pk = pivots + k * batch_lanes;
+        for (std::size_t l = 0; l < lanes; ++l) {
+            const std::size_t p = pk[l];
+            if (p == k) continue;
+            for (std::size_t c = 0; c < r; ++c) {
+                std::swap(
+                    b[(k * r + c) * batch_lanes + l],
+                    b[(p * r + c) * batch_lanes + l]
+                );
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t p = 0; p < i; ++p) {
+            const T* aip = a + (i * n + p) * batch_lanes;
+            for (std::size_t c = 0; c < r; ++c) {
+                T* bic = b + (i * r + c) * batch_lanes;
+                const T* bpc = b + (p * r + c) * batch_lanes;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    bic[l] -= aip[l] * bpc[l];
+                }
+            }
+        }
+    }
+
+    for (std::size_t i = n; i-- > 0;) {
+        for (std::size_t p = i + 1; p < n; ++p) {
+            const T* aip = a + (i * n + p) * batch_lanes;
+            for (std::size_t c = 0; c < r; ++c) {
+                T* bic = b + (i * r + c) * batch_lanes;
+                const T* bpc = b + (p * r + c) * batch_lanes;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    bic[l] -= aip[l] * bpc[l];
+                }
+            }
+        }
+
+        const T* aii = a + (i * n + i) * batch_lanes;
+        for (std::size_t c = 0; c < r; ++c) {
+            T* bic = b + (i * r + c) * batch_lanes;
+            for (std::size_t l = 0; l < lanes; ++l) {
+                bic[l] /= aii[l];
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+
+template<typename T>
+void batched_mul(
+    detail::nondeduced_t<ndview<const T, 3>> A,
+    detail::nondeduced_t<ndview<const T, 3>> B,
+    ndview<T, 3> C,
+    batch_layout layout,
+    std::size_t thread_count
+) {
+    const detail::batch_dims a = detail::get_batch_dims(A, layout);
+    const detail::batch_dims b = detail::get_batch_dims(B, layout);
+    const detail::batch_dims c = detail::get_batch_dims(C, layout);
+    assert(a.batch == c.batch && b.batch == c.batch);
+    assert(a.cols == b.rows);
+    assert(a.rows == c.rows && b.cols == c.cols);
+
+    const std::size_t range_count =
+        detail::lane_range_count(c.batch, thread_count);
+    auto a_blocks = detail::make_lane_blocks<const T>(
+        range_count, A.data(), a.batch, a.rows * a.cols, layout
+    );
+    auto b_blocks = detail::make_lane_blocks<const T>(
+        range_count, B.data(), b.batch, b.rows * b.cols, layout
+    );
+    auto c_blocks = detail::make_lane_blocks<T>(
+        range_count, C.data(), c.batch, c.rows * c.cols, layout
+    );
+
+    detail::for_each_lane_range(
+        c.batch,
+        range_count,
+        [&](std::size_t range, std::size_t first, std::size_t last) {
+            auto& a_block = a_blocks[range];
+            auto& b_block = b_blocks[range];
+            auto& c_block = c_blocks[range];
+
+            for (std::size_t l = first; l < last; l += detail::batch_lanes) {
+                const std::size_t count =
+                    std::min(detail::batch_lanes, last - l);
+                a_block.load(l, count);
+                b_block.load(l, count);
+                c_block.bind(l, count);
+
+                detail::gemm_lanes(
+                    a_block.data(), b_block.data(), c_block.data(),
+                    a.rows, a.cols, b.cols,
+                    count
+                );
+
+                c_block.store();
+            }
+        }
+    );
+}
+
+
+template<typename T>
+bool batched_cholesky(
+    ndview<T, 3> A,
+    batch_layout layout,
+    std::size_t thread_count
+) {
+    const detail::batch_dims a = detail::get_batch_dims(A, layout);
+    assert(a.rows == a.cols);
+
+    const std::size_t range_count =
+        detail::lane_range_count(a.batch, thread_count);
+    auto a_blocks = detail::make_lane_blocks<T>(
+        range_count, A.data(), a.batch, a.rows * a.cols, layout
+    );
+
+    std::atomic<bool> succeeded{true};
+    detail::for_each_lane_range(
+        a.batch,
+        range_count,
+        [&](std::size_t range, std::size_t first, std::size_t last) {
+            auto& a_block = a_blocks[range];
+
+            for (std::size_t l = first; l < last; l += detail::batch_lanes) {
+                const std::size_t count =
+                    std::min(detail::batch_lanes, last - l);
+                a_block.load(l, count);
+
+                if (!detail::cholesky_lanes(a_block.data(), a.rows, count)) {
+                    succeeded.store(false, std::memory_order_relaxed);
+                }
+
+                a_block.store();
+            }
+        }
+    );
+
+    return succeeded.load(std::memory_order_relaxed);
+}
+
+
+template<typename T>
+void batched_cholesky_solve(
+    detail::nondeduced_t<ndview<const T, 3>> L,
+    ndview<T, 3> B,
+    batch_layout layout,
+    std::size_t thread_count
+) {
+    const detail::batch_dims l_dims = detail::get_batch_dims(L, layout);
+    const detail::batch_dims b = detail::get_batch_dims(B, layout);
+    assert(l_dims.batch == b.batch);
+    assert(l_dims.rows == l_dims.cols && l_dims.rows == b.rows);
+
+    const std::size_t range_count =
+        detail::lane_range_count(b.batch, thread_count);
+    auto l_blocks = detail::make_lane_blocks<const T>(
+        range_count, L.data(), b.batch, l_dims.rows * l_dims.cols, layout
+    );
+    auto b_blocks = detail::make_lane_blocks<T>(
+        range_count, B.data(), b.batch, b.rows * b.cols, layout
+    );
+
+    detail::for_each_lane_range(
+        b.batch,
+        range_count,
+        [&](std::size_t range, std::size_t first, std::size_t last) {
+            auto& l_block = l_blocks[range];
+            auto& b_block = b_blocks[range];
+
+            for (std::size_t l = first; l < last; l += detail::batch_lanes) {
+                const std::size_t count =
+                    std::min(detail::batch_lanes, last - l);
+                l_block.load(l, count);
+                b_block.load(l, count);
+
+                detail::cholesky_solve_lanes(
+                    l_block.data(), b_block.data(), b.rows, b.cols, count
+                );
+
+                b_block.store();
+            }
+        }
+    );
+}
+
+
+template<typename T>
+bool batched_lu(
+    ndview<T, 3> A,
+    ndview<std::size_t, 2> pivots,
+    batch_layout layout,
+    std::size_t thread_count
+) {
+    const detail::batch_dims a = detail::get_batch_dims(A, layout);
+    assert(a.rows == a.cols);
+    assert(
+        pivots.shape() == (layout == batch_layout::leading ?
+            std::array<std::size_t, 2>{ a.batch, a.rows } :
+            std::array<std::size_t, 2>{ a.rows, a.batch })
+    );
+
+    const std::size_t range_count =
+        detail::lane_range_count(a.batch, thread_count);
+    auto a_blocks = detail::make_lane_blocks<T>(
+        range_count, A.data(), a.batch, a.rows * a.cols, layout
+    );
+    auto p_blocks = detail::make_lane_blocks<std::size_t>(
+        range_count, pivots.data(), a.batch, a.rows, layout
+    );
+
+    std::atomic<bool> succeeded{true};
+    detail::for_each_lane_range(
+        a.batch,
+        range_count,
+        [&](std::size_t range, std::size_t first, std::size_t last) {
+            auto& a_block = a_blocks[range];
+            auto& p_block = p_blocks[range];
+
+            for (std::size_t l = first; l < last; l += detail::batch_lanes) {
+                const std::size_t count =
+                    std::min(detail::batch_lanes, last - l);
+                a_block.load(l, count);
+                p_block.bind(l, count);
+
+                if (!detail::lu_lanes(
+                    a_block.data(), p_block.data(), a.rows, count
+                )) {
+                    succeeded.store(false, std::memory_order_relaxed);
+                }
+
+                a_block.store();
+                p_block.store();
+            }
+        }
+    );
+
+    return succeeded.load(std::memory_order_relaxed);
+}
+
+
+template<typename T>
+void batched_lu_solve(
+    detail::nondeduced_t<ndview<const T, 3>> LU,
+    ndview<const std::size_t, 2> pivots,
+    ndview<T, 3> B,
+    batch_layout layout,
+    std::size_t thread_count
+) {
+    const detail::batch_dims a = detail::get_batch_dims(LU, layout);
+    const detail::batch_dims b = detail::get_batch_dims(B, layout);
+    assert(a.batch == b.batch);
+    assert(a.rows == a.cols && a.rows == b.rows);
+    assert(pivots.element_count() == a.batch * a.rows);
+
+    const std::size_t range_count =
+        detail::lane_range_count(b.batch, thread_count);
+    auto a_blocks = detail::make_lane_blocks<const T>(
+        range_count, LU.data(), a.batch, a.rows * a.cols, layout
+    );
+    auto p_blocks = detail::make_lane_blocks<const std::size_t>(
+        range_count, pivots.data(), a.batch, a.rows, layout
+    );
+    auto b_blocks = detail::make_lane_blocks<T>(
+        range_count, B.data(), b.batch, b.rows * b.cols, layout
+    );
+
+    detail::for_each_lane_range(
+        b.batch,
+        range_count,
+        [&](std::size_t range, std::size_t first, std::size_t last) {
+            auto& a_block = a_blocks[range];
+            auto& p_block = p_blocks[range];
+            auto& b_block = b_blocks[range];
+
+            for (std::size_t l = first; l < last; l += detail::batch_lanes) {
+                const std::size_t count =
+                    std::min(detail::batch_lanes, last - l);
+                a_block.load(l, count);
+                p_block.load(l, count);
+                b_block.load(l, count);
+
+                detail::lu_solve_lanes(
+                    a_block.data(), p_block.data(), b_block.data(),
+                    b.rows, b.cols,
+                    count
+                );
+
+                b_block.store();
+            }
+        }
+    );
+}
+
+
+template<typename T>
+bool batched_inverse(
+    detail::nondeduced_t<ndview<const T, 3>> A,
+    ndview<T, 3> A_inv,
+    batch_layout layout,
+    std::size_t thread_count
+) {
+    const detail::batch_dims a = detail::get_batch_dims(A, layout);
+    assert(A.shape() == A_inv.shape());
+    assert(a.rows == a.cols);
+
+    const std::size_t n = a.rows;
+
+    const std::size_t range_count =
+        detail::lane_range_count(a.batch, thread_count);
+    auto a_blocks = detail::make_lane_blocks<const T>(
+        range_count, A.data(), a.batch, n * n, layout
+    );
+    auto inv_blocks = detail::make_lane_blocks<T>(
+        range_count, A_inv.data(), a.batch, n * n, layout
+    );
+    std::vector<std::size_t> pivot_buffer(
+        range_count * n * detail::batch_lanes
+    );
+
+    std::atomic<bool> succeeded{true};
+    detail::for_each_lane_range(
+        a.batch,
+        range_count,
+        [&](std::size_t range, std::size_t first, std::size_t last) {
+            auto& a_block = a_blocks[range];
+            auto& inv_block = inv_blocks[range];
+            std::size_t* pivots =
+                pivot_buffer.data() + range * n * detail::batch_lanes;
+
+            for (std::size_t l = first; l < last; l += detail::batch_lanes) {
+                const std::size_t count =
+                    std::min(detail::batch_lanes, last - l);
+                // The packed copy of A is factored in place
+                a_block.load(l, count);
+                inv_block.bind(l, count);
+
+                T* inv = inv_block.data();
+                for (std::size_t i = 0; i < n; ++i) {
+                    for (std::size_t j = 0; j < n; ++j) {
+                        std::fill_n(
+                            inv + (i * n + j) * detail::batch_lanes,
+                            count,
+                            static_cast<T>(i == j)
+                        );
+                    }
+                }
+
+                if (!detail::lu_lanes(
+                    a_block.data(), pivots, n, count
+                )) {
+                    succeeded.store(false, std::memory_order_relaxed);
+                }
+
+                detail::lu_solve_lanes(
+                    a_block.data(), pivots, inv, n, n, count
+                );
+
+                inv_block.store();
+            }
+        }
+    );
+
+    return succeeded.load(std::memory_order_relaxed);
+}
+
+
+template<typename T>
+void interleave(
+    detail::nondeduced_t<ndview<const T, 3>> src,
+    ndview<T, 3> dst
+) noexcept {
+    const std::size_t batch = src.shape(0);
+    const std::size_t count = src.shape(1) * src.shape(2);
+    assert(dst.shape(0) == src.shape(1));
+    assert(dst.shape(1) == src.shape(2));
+    assert(dst.shape(2) == batch);
+
+    const T* in = src.data();
+    T* out = dst.data();
+    for (std::size_t b = 0; b < batch; ++b) {
+        for (std::size_t e = 0; e < count; ++e) {
+            out[e * batch + b] = in[b * count + e];
+        }
+    }
+}
+
+
+template<typename T>
+void deinterleave(
+    detail::nondeduced_t<ndview<const T, 3>> src,
+    ndview<T, 3> dst
+) noexcept {
+    const std::size_t batch = src.shape(2);
+    const std::size_t count = src.shape(0) * src.shape(1);
+    assert(dst.shape(0) == batch);
+    assert(dst.shape(1) == src.shape(0));
+    assert(dst.shape(2) == src.shape(1));
+
+    const T* in = src.data();
+    T* out = dst.data();
+    for (std::size_t b = 0; b < batch; ++b) {
+        for (std::size_t e = 0; e < count; ++e) {
+            out[b * count + e] = in[e * batch + b];
+        }
+    }
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_BATCHED_IPP_
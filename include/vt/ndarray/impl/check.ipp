@@ -0,0 +1,276 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_CHECK_IPP_
+#define VT_NDARRAY_IMPL_CHECK_IPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__GNUC__)
+#   define VT_NDARRAY_COLD __attribute__((cold, noinline))
+#   define VT_NDARRAY_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#elif defined(_MSC_VER)
+#   define VT_NDARRAY_COLD __declspec(noinline)
+#   define VT_NDARRAY_UNLIKELY(x) (x)
+#else
+#   define VT_NDARRAY_COLD
+#   define VT_NDARRAY_UNLIKELY(x) (x)
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+#   define VT_NDARRAY_ASAN
+#elif defined(__has_feature)
+#   if __has_feature(address_sanitizer)
+#       define VT_NDARRAY_ASAN
+#   endif
+#endif
+
+#ifdef VT_NDARRAY_ASAN
+#   include <sanitizer/asan_interface.h>
+#endif
+
+
+namespace vt {
+
+namespace detail {
+
+inline std::atomic<check_handler> installed_check_handler{nullptr};
+
+
+// Builds a failure message without allocating, since checks may fail while
+// the heap is corrupted or exhausted. Overlong messages are truncated.
+class check_message {
+public:
+    check_message& operator<<(const char* text) noexcept {
+        const std::size_t length =
+            std::min(std::strlen(text), capacity - _length);
+        std::memcpy(_data + _length, text, length);
+        _length += length;
+        _data[_length] = '\0';
+
+        return *this;
+    }
+
+    check_message& operator<<(std::size_t value) noexcept {
+        const std::to_chars_result result =
+            std::to_chars(_data + _length, _data + capacity, value);
+        if (result.ec == std::errc{}) {
+            _length = static_cast<std::size_t>(result.ptr - _data);
+        }
+        _data[_length] = '\0';
+
+        return *this;
+    }
+
+    void append_shape(
+        const std::size_t* shape,
+        std::size_t dim_count
+    ) noexcept {
+        *this << "[";
+        for (std::size_t i = 0; i < dim_count; ++i) {
+            if (i > 0) *this << ", ";
+            *this << shape[i];
+        }
+        *this << "]";
+    }
+
+    const char* c_str() const noexcept {
+        return _data;
+    }
+
+private:
+    static constexpr std::size_t capacity = 255;
+
+    char _data[capacity + 1] = {};
+    std::size_t _length = 0;
+};
+
+
+[[noreturn]] inline void check_failed(const char* message) noexcept {
+    const check_handler handler = installed_check_handler.load();
+    if (handler != nullptr) {
+        handler(message);
+    } else {
+        std::fprintf(stderr, "%s\n", message);
+        std::fflush(stderr);
+    }
+
+    std::abort();
+}
+
+
+[[noreturn]] VT_NDARRAY_COLD inline void index_check_failed(
+    const char* what,
+    std::size_t idx,
+    const std::size_t* shape,
+    std::size_t dim_count
+) noexcept {
+    check_message message;
+    message << what << " (index " << idx << ", shape ";
+    message.append_shape(shape, dim_count);
+    message << ")";
+    check_failed(message.c_str());
+}
+
+
+[[noreturn]] VT_NDARRAY_COLD inline void slice_check_failed(
+    const char* what,
+    std::size_t offset,
+    std::size_t count,
+    const std::size_t* shape,
+    std::size_t dim_count
+) noexcept {
+    check_message message;
+    message << what << " (offset " << offset << ", count " << count
+        << ", shape ";
+    message.append_shape(shape, dim_count);
+    message << ")";
+    check_failed(message.c_str());
+}
+
+
+[[noreturn]] VT_NDARRAY_COLD inline void reshape_check_failed(
+    const char* what,
+    std::size_t element_count,
+    const std::size_t* new_shape,
+    std::size_t dim_count
+) noexcept {
+    check_message message;
+    message << what << " (" << element_count << " elements, new shape ";
+    message.append_shape(new_shape, dim_count);
+    message << ")";
+    check_failed(message.c_str());
+}
+
+
+// The checks below are constexpr, so that a failing check in a constant
+// expression is reported by the compiler. Only the comparison is inlined; the
+// message is formatted out of line.
+template<std::size_t N>
+constexpr void check_index(
+    const char* what,
+    std::size_t idx,
+    const std::array<std::size_t, N>& shape
+) noexcept {
+#if VT_NDARRAY_CHECK_LEVEL >= 2
+    if (VT_NDARRAY_UNLIKELY(idx >= shape[0])) {
+        index_check_failed(what, idx, shape.data(), N);
+    }
+#elif VT_NDARRAY_CHECK_LEVEL >= 1
+    if (VT_NDARRAY_UNLIKELY(idx >= shape[0])) check_failed(what);
+#else
+    (void)what;
+    (void)idx;
+    (void)shape;
+#endif
+}
+
+
+template<std::size_t N>
+constexpr void check_slice(
+    const char* what,
+    std::size_t offset,
+    std::size_t count,
+    const std::array<std::size_t, N>& shape
+) noexcept {
+#if VT_NDARRAY_CHECK_LEVEL >= 1
+    // Written so that a large count cannot wrap around
+    if (VT_NDARRAY_UNLIKELY(offset > shape[0] || count > shape[0] - offset)) {
+#   if VT_NDARRAY_CHECK_LEVEL >= 2
+        slice_check_failed(what, offset, count, shape.data(), N);
+#   else
+        check_failed(what);
+#   endif
+    }
+#else
+    (void)what;
+    (void)offset;
+    (void)count;
+    (void)shape;
+#endif
+}
+
+
+template<std::size_t M>
+constexpr void check_reshape(
+    const char* what,
+    std::size_t element_count,
+    const std::array<std::size_t, M>& new_shape
+) noexcept {
+#if VT_NDARRAY_CHECK_LEVEL >= 2
+    std::size_t new_count = 1;
+    for (std::size_t i = 0; i < M; ++i) {
+        new_count *= new_shape[i];
+    }
+
+    if (VT_NDARRAY_UNLIKELY(new_count != element_count)) {
+        reshape_check_failed(what, element_count, new_shape.data(), M);
+    }
+#else
+    (void)what;
+    (void)element_count;
+    (void)new_shape;
+#endif
+}
+
+
+// Marks memory that the library holds on to, but that no array currently
+// owns, as unaddressable, so that AddressSanitizer reports stale accesses.
+inline void poison_memory(const void* p, std::size_t size) noexcept {
+#ifdef VT_NDARRAY_ASAN
+    ASAN_POISON_MEMORY_REGION(p, size);
+#else
+    (void)p;
+    (void)size;
+#endif
+}
+
+
+inline void unpoison_memory(const void* p, std::size_t size) noexcept {
+#ifdef VT_NDARRAY_ASAN
+    ASAN_UNPOISON_MEMORY_REGION(p, size);
+#else
+    (void)p;
+    (void)size;
+#endif
+}
+
+} // namespace detail
+
+
+inline check_handler set_check_handler(check_handler handler) noexcept {
+    return detail::installed_check_handler.exchange(handler);
+}
+
+
+inline check_handler get_check_handler() noexcept {
+    return detail::installed_check_handler.load();
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_CHECK_IPP_
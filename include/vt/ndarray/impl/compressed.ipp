@@ -0,0 +1,609 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_COMPRESSED_IPP_
+#define VT_NDARRAY_IMPL_COMPRESSED_IPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+
+namespace vt {
+
+namespace detail {
+
+// Chunk mode flags, stored in the first byte of every compressed chunk.
+inline constexpr unsigned char chunk_lz = 0x1;
+inline constexpr unsigned char chunk_quantized = 0x2;
+
+
+// Groups the n-th byte of all elements together. The high bytes of
+// neighboring values tend to be equal, which gives the LZ stage long runs to
+// work with.
+inline void shuffle_bytes(
+    const unsigned char* src,
+    std::size_t count,
+    std::size_t size,
+    unsigned char* dst
+) noexcept {
+    for (std::size_t b = 0; b < size; ++b) {
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[b * count + i] = src[i * size + b];
+        }
+    }
+}
+
+
+inline void unshuffle_bytes(
+    const unsigned char* src,
+    std::size_t count,
+    std::size_t size,
+    unsigned char* dst
+) noexcept {
+    for (std::size_t b = 0; b < size; ++b) {
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i * size + b] = src[b * count + i];
+        }
+    }
+}
+
+
+inline constexpr std::size_t lz_min_match = 4;
+inline constexpr std::size_t lz_max_offset = 65535;
+inline constexpr unsigned lz_hash_bits = 12;
+
+
+inline std::uint32_t lz_read32(const unsigned char* p) noexcept {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+
+inline std::size_t lz_hash(std::uint32_t v) noexcept {
+    return (v * 2654435761u) >> (32 - lz_hash_bits);
+}
+
+
+inline void lz_write_length(
+    std::vector<unsigned char>& out,
+    std::size_t len
+) {
+    for (; len >= 255; len -= 255) {
+        out.push_back(255);
+    }
+    out.push_back(static_cast<unsigned char>(len));
+}
+
+
+inline void lz_write_sequence(
+    std::vector<unsigned char>& out,
+    const unsigned char* literals,
+    std::size_t literal_count,
+    std::size_t offset,
+    std::size_t match_length
+) {
+    // The last sequence has literals only, with a match code of 0
+    assert(match_length == 0 || match_length >= lz_min_match);
+    const std::size_t match_code =
+        match_length == 0 ? 0 : match_length - lz_min_match;
+
+    out.push_back(static_cast<unsigned char>(
+        (std::min<std::size_t>(literal_count, 15) << 4) |
+        std::min<std::size_t>(match_code, 15)
+    ));
+    if (literal_count >= 15) lz_write_length(out, literal_count - 15);
+    out.insert(out.end(), literals, literals + literal_count);
+
+    if (match_length == 0) return;
+
+    out.push_back(static_cast<unsigned char>(offset & 0xff));
+    out.push_back(static_cast<unsigned char>(offset >> 8));
+    if (match_code >= 15) lz_write_length(out, match_code - 15);
+}
+
+
+// Byte-oriented LZ77 compressor using the LZ4 sequence layout: a token with
+// literal and match lengths, the literals, and a 16-bit match offset. Matches
+// are found through a single-entry hash table, which favors speed over ratio.
+inline void lz_compress(
+    const unsigned char* src,
+    std::size_t n,
+    std::vector<unsigned char>& out
+) {
+    std::vector<std::size_t> table(std::size_t{1} << lz_hash_bits, 0);
+
+    std::size_t anchor = 0;
+    std::size_t pos = 0;
+    while (pos + lz_min_match <= n) {
+        const std::uint32_t seq = lz_read32(src + pos);
+        const std::size_t h = lz_hash(seq);
+        const std::size_t candidate = table[h];
+        table[h] = pos;
+
+        if (
+            candidate < pos &&
+            pos - candidate <= lz_max_offset &&
+            lz_read32(src + candidate) == seq
+        ) {
+            std::size_t len = lz_min_match;
+            while (pos + len < n && src[candidate + len] == src[pos + len]) {
+                ++len;
+            }
+
+            lz_write_sequence(
+                out,
+                src + anchor,
+                pos - anchor,
+                pos - candidate,
+                len
+            );
+
+            pos += len;
+            anchor = pos;
+        } else {
+            ++pos;
+        }
+    }
+
+    // The last sequence only has literals, signaled by the end of the input.
+    lz_write_sequence(out, src + anchor, n - anchor, 0, 0);
+}
+
+
+inline std::size_t lz_read_length(
+    const unsigned char*& ip,
+    const unsigned char* end
+) noexcept {
+    std::size_t len = 0;
+    unsigned char b;
+    do {
+        assert(ip < end);
+        b = *ip++;
+        len += b;
+    } while (b == 255 && ip < end);
+
+    return len;
+}
+
+
+inline void lz_decompress(
+    const unsigned char* ip,
+    const unsigned char* end,
+    unsigned char* dst,
+    std::size_t n
+) noexcept {
+    unsigned char* op = dst;
+    unsigned char* const op_end = dst + n;
+
+    while (ip < end) {
+        const unsigned token = *ip++;
+
+        std::size_t literal_count = token >> 4;
+        if (literal_count == 15) literal_count += lz_read_length(ip, end);
+
+        assert(static_cast<std::size_t>(end - ip) >= literal_count);
+        assert(static_cast<std::size_t>(op_end - op) >= literal_count);
+        std::memcpy(op, ip, literal_count);
+        ip += literal_count;
+        op += literal_count;
+
+        if (ip == end) break;
+
+        const std::size_t offset =
+            static_cast<std::size_t>(ip[0]) |
+            static_cast<std::size_t>(ip[1]) << 8;
+        ip += 2;
+
+        std::size_t match_length = token & 15;
+        if (match_length == 15) match_length += lz_read_length(ip, end);
+        match_length += lz_min_match;
+
+        assert(offset > 0 && offset <= static_cast<std::size_t>(op - dst));
+        assert(static_cast<std::size_t>(op_end - op) >= match_length);
+
+        // Matches may overlap with the output being written, so copy byte by
+        // byte.
+        const unsigned char* match = op - offset;
+        for (std::size_t i = 0; i < match_length; ++i) {
+            op[i] = match[i];
+        }
+        op += match_length;
+    }
+
+    assert(op == op_end);
+    (void)op_end;
+}
+
+
+template<typename T>
+bool quantize(
+    const T* src,
+    std::size_t count,
+    double error_bound,
+    std::int64_t* dst
+) noexcept {
+    const double step = 2.0 * error_bound;
+    // Keep clear of the int64 range, so that deltas can't overflow either.
+    const double limit = 4.0e18;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const double x = static_cast<double>(src[i]);
+        if (!std::isfinite(x) || std::abs(x / step) > limit) return false;
+
+        const std::int64_t q = std::llround(x / step);
+        const T r = static_cast<T>(static_cast<double>(q) * step);
+        if (std::abs(static_cast<double>(r) - x) > error_bound) return false;
+
+        dst[i] = q;
+    }
+
+    return true;
+}
+
+
+template<typename T>
+void encode_chunk(
+    const T* src,
+    std::size_t count,
+    double error_bound,
+    std::vector<unsigned char>& out
+) {
+    unsigned char mode = 0;
+    std::vector<unsigned char> bytes;
+    std::size_t size = sizeof(T);
+
+    if constexpr (std::is_floating_point_v<T>) {
+        std::vector<std::int64_t> q(count);
+        if (error_bound > 0.0 && quantize(src, count, error_bound, q.data())) {
+            mode |= chunk_quantized;
+            size = sizeof(std::int64_t);
+
+            // Delta encoding turns smooth data into small integers with many
+            // zero high bytes.
+            std::uint64_t prev = 0;
+            for (auto& qi : q) {
+                const auto cur = static_cast<std::uint64_t>(qi);
+                qi = static_cast<std::int64_t>(cur - prev);
+                prev = cur;
+            }
+
+            bytes.resize(count * size);
+            if (count > 0) std::memcpy(bytes.data(), q.data(), bytes.size());
+        } else {
+            bytes.resize(count * size);
+            if (count > 0) std::memcpy(bytes.data(), src, bytes.size());
+        }
+    } else {
+        using U = std::make_unsigned_t<T>;
+
+        std::vector<U> delta(count);
+        U prev = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto cur = static_cast<U>(src[i]);
+            delta[i] = static_cast<U>(cur - prev);
+            prev = cur;
+        }
+
+        bytes.resize(count * size);
+        if (count > 0) std::memcpy(bytes.data(), delta.data(), bytes.size());
+    }
+
+    std::vector<unsigned char> shuffled(bytes.size());
+    shuffle_bytes(bytes.data(), count, size, shuffled.data());
+
+    const std::size_t header_pos = out.size();
+    out.push_back(0);
+
+    lz_compress(shuffled.data(), shuffled.size(), out);
+    if (out.size() - header_pos - 1 < shuffled.size()) {
+        mode |= chunk_lz;
+    } else {
+        // Incompressible data is stored as is.
+        out.resize(header_pos + 1);
+        out.insert(out.end(), shuffled.begin(), shuffled.end());
+    }
+
+    out[header_pos] = mode;
+}
+
+
+template<typename T>
+void decode_chunk(
+    const unsigned char* first,
+    const unsigned char* last,
+    std::size_t count,
+    double error_bound,
+    T* dst
+) {
+    assert(first < last);
+
+    const unsigned char mode = *first++;
+    const std::size_t size =
+        (mode & chunk_quantized) ? sizeof(std::int64_t) : sizeof(T);
+
+    std::vector<unsigned char> shuffled(count * size);
+    if (mode & chunk_lz) {
+        lz_decompress(first, last, shuffled.data(), shuffled.size());
+    } else {
+        assert(static_cast<std::size_t>(last - first) == shuffled.size());
+        std::copy(first, last, shuffled.begin());
+    }
+
+    std::vector<unsigned char> bytes(shuffled.size());
+    unshuffle_bytes(shuffled.data(), count, size, bytes.data());
+
+    if constexpr (std::is_floating_point_v<T>) {
+        if (mode & chunk_quantized) {
+            const double step = 2.0 * error_bound;
+
+            std::uint64_t q = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                std::uint64_t delta;
+                std::memcpy(&delta, bytes.data() + i * size, size);
+                q += delta;
+                dst[i] = static_cast<T>(
+                    static_cast<double>(static_cast<std::int64_t>(q)) * step
+                );
+            }
+        } else if (count > 0) {
+            std::memcpy(dst, bytes.data(), bytes.size());
+        }
+    } else {
+        (void)error_bound;
+        using U = std::make_unsigned_t<T>;
+
+        U prev = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            U delta;
+            std::memcpy(&delta, bytes.data() + i * size, size);
+            prev = static_cast<U>(prev + delta);
+            dst[i] = static_cast<T>(prev);
+        }
+    }
+}
+
+} // namespace detail
+
+
+template<typename T, std::size_t N>
+compressed_ndarray<T, N>::compressed_ndarray() noexcept :
+    _shape{},
+    _chunk_rows{1},
+    _cache_capacity{1},
+    _use_counter{0}
+{
+}
+
+
+template<typename T, std::size_t N>
+compressed_ndarray<T, N>::compressed_ndarray(
+    ndview<const T, N> src,
+    const compression_options& options
+) :
+    _shape{src.shape()},
+    _chunk_rows{options.chunk_rows},
+    _cache_capacity{std::max<std::size_t>(options.cache_chunks, 1)},
+    _use_counter{0}
+{
+    assert(options.error_bound >= 0.0);
+
+    const std::size_t row_size = src.element_count() / std::max<std::size_t>(
+        _shape[0],
+        1
+    );
+
+    if (_chunk_rows == 0) {
+        const std::size_t row_bytes = std::max<std::size_t>(
+            row_size * sizeof(T),
+            1
+        );
+        _chunk_rows = std::max<std::size_t>(65536 / row_bytes, 1);
+    }
+
+    // Store the error bound in front of the chunks, so that decompression
+    // does not depend on the options after construction.
+    _storage.resize(sizeof(double));
+    std::memcpy(_storage.data(), &options.error_bound, sizeof(double));
+
+    const std::size_t count = this->chunk_count();
+    _offsets.reserve(count + 1);
+    for (std::size_t c = 0; c < count; ++c) {
+        _offsets.push_back(_storage.size());
+
+        const std::size_t first_row = c * _chunk_rows;
+        const std::size_t rows = std::min(_chunk_rows, _shape[0] - first_row);
+        detail::encode_chunk(
+            src.data() + first_row * row_size,
+            rows * row_size,
+            options.error_bound,
+            _storage
+        );
+    }
+    _offsets.push_back(_storage.size());
+
+    _storage.shrink_to_fit();
+}
+
+
+template<typename T, std::size_t N>
+decltype(auto) compressed_ndarray<T, N>::operator[](std::size_t idx) {
+    assert(idx < _shape[0]);
+
+    const ndview<const T, N> chunk_ = this->chunk(idx / _chunk_rows);
+
+    // Return by value, since the chunk may be evicted from the cache.
+    if constexpr (N > 1) {
+        const ndview<const T, N - 1> row = chunk_[idx % _chunk_rows];
+        return ndarray<T, N - 1>{row.shape(), row.begin(), row.end()};
+    } else {
+        return T{chunk_[idx % _chunk_rows]};
+    }
+}
+
+
+template<typename T, std::size_t N>
+std::size_t compressed_ndarray<T, N>::element_count() const noexcept {
+    return detail::count_elements(_shape);
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& compressed_ndarray<T, N>::shape(
+) const noexcept {
+    return _shape;
+}
+
+
+template<typename T, std::size_t N>
+std::size_t compressed_ndarray<T, N>::shape(std::size_t dim) const noexcept {
+    assert(dim < N);
+
+    return _shape[dim];
+}
+
+
+template<typename T, std::size_t N>
+std::size_t compressed_ndarray<T, N>::chunk_rows() const noexcept {
+    return _chunk_rows;
+}
+
+
+template<typename T, std::size_t N>
+std::size_t compressed_ndarray<T, N>::chunk_count() const noexcept {
+    return (_shape[0] + _chunk_rows - 1) / _chunk_rows;
+}
+
+
+template<typename T, std::size_t N>
+std::size_t compressed_ndarray<T, N>::compressed_size() const noexcept {
+    return _storage.size() + _offsets.size() * sizeof(std::size_t);
+}
+
+
+template<typename T, std::size_t N>
+ndview<const T, N> compressed_ndarray<T, N>::chunk(std::size_t idx) {
+    assert(idx < this->chunk_count());
+
+    ++_use_counter;
+
+    for (auto& entry : _cache) {
+        if (entry.chunk == idx) {
+            entry.last_use = _use_counter;
+            return entry.data.cview();
+        }
+    }
+
+    const std::array<std::size_t, N> shape_ = this->chunk_shape(idx);
+
+    cache_entry* entry;
+    if (_cache.size() < _cache_capacity) {
+        _cache.push_back({ no_chunk, 0, ndarray<T, N>{shape_} });
+        entry = &_cache.back();
+    } else {
+        entry = &*std::min_element(
+            _cache.begin(),
+            _cache.end(),
+            [](const cache_entry& a, const cache_entry& b) {
+                return a.last_use < b.last_use;
+            }
+        );
+        // The entry is only labeled with the new chunk once it has been
+        // decoded, so that a failure cannot leave stale data behind.
+        entry->chunk = no_chunk;
+        // Only the last chunk can have a different shape, so the evicted
+        // buffer can almost always be reused.
+        if (entry->data.shape() != shape_) {
+            entry->data = ndarray<T, N>{shape_};
+        }
+    }
+
+    this->decompress_chunk(idx, entry->data.data());
+    entry->chunk = idx;
+    entry->last_use = _use_counter;
+
+    return entry->data.cview();
+}
+
+
+template<typename T, std::size_t N>
+void compressed_ndarray<T, N>::decompress(ndview<T, N> dst) const {
+    assert(dst.shape() == _shape);
+
+    const std::size_t row_size = this->element_count() /
+        std::max<std::size_t>(_shape[0], 1);
+
+    // Bypass the cache, since every chunk is only needed once.
+    for (std::size_t c = 0; c < this->chunk_count(); ++c) {
+        this->decompress_chunk(c, dst.data() + c * _chunk_rows * row_size);
+    }
+}
+
+
+template<typename T, std::size_t N>
+ndarray<T, N> compressed_ndarray<T, N>::decompress() const {
+    ndarray<T, N> dst{_shape};
+    this->decompress(dst.view());
+
+    return dst;
+}
+
+
+template<typename T, std::size_t N>
+void compressed_ndarray<T, N>::clear_cache() noexcept {
+    _cache.clear();
+}
+
+
+template<typename T, std::size_t N>
+std::array<std::size_t, N> compressed_ndarray<T, N>::chunk_shape(
+    std::size_t idx
+) const noexcept {
+    std::array<std::size_t, N> shape_ = _shape;
+    shape_[0] = std::min(_chunk_rows, _shape[0] - idx * _chunk_rows);
+
+    return shape_;
+}
+
+
+template<typename T, std::size_t N>
+void compressed_ndarray<T, N>::decompress_chunk(
+    std::size_t idx,
+    T* dst
+) const {
+    double error_bound;
+    std::memcpy(&error_bound, _storage.data(), sizeof(double));
+
+    detail::decode_chunk(
+        _storage.data() + _offsets[idx],
+        _storage.data() + _offsets[idx + 1],
+        detail::count_elements(this->chunk_shape(idx)),
+        error_bound,
+        dst
+    );
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_COMPRESSED_IPP_
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef VT_NDARRAY_IMPL_CONFIG_IPP_
+#define VT_NDARRAY_IMPL_CONFIG_IPP_
+
+// Instruction sets and platform interfaces that the implementation can use.
+// Each macro is defined as 1 or 0, so that it can be tested with #if.
+
+// F16C is implied by AVX2 on all processors that support it, and MSVC does
+// not define a separate macro for it.
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#   define VT_NDARRAY_F16C 1
+#else
+#   define VT_NDARRAY_F16C 0
+#endif
+
+#if defined(__AVX__)
+#   define VT_NDARRAY_AVX 1
+#else
+#   define VT_NDARRAY_AVX 0
+#endif
+
+#if defined(__AVX2__)
+#   define VT_NDARRAY_AVX2 1
+#else
+#   define VT_NDARRAY_AVX2 0
+#endif
+
+#if defined(__AVX512F__)
+#   define VT_NDARRAY_AVX512F 1
+#else
+#   define VT_NDARRAY_AVX512F 0
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+#   define VT_NDARRAY_SSE2 1
+#else
+#   define VT_NDARRAY_SSE2 0
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#   define VT_NDARRAY_POSIX 1
+#else
+#   define VT_NDARRAY_POSIX 0
+#endif
+
+#endif // VT_NDARRAY_IMPL_CONFIG_IPP_
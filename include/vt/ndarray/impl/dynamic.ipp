@@ -0,0 +1,607 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_DYNAMIC_IPP_
+#define VT_NDARRAY_IMPL_DYNAMIC_IPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+
+namespace vt {
+
+namespace detail {
+
+template<typename T>
+constexpr dtype dtype_of_impl() noexcept {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>);
+
+    if constexpr (std::is_floating_point_v<T>) {
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+
+        return sizeof(T) == 4 ? dtype::float32 : dtype::float64;
+    } else if constexpr (std::is_signed_v<T>) {
+        static_assert(
+            sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
+            sizeof(T) == 8
+        );
+
+        return sizeof(T) == 1 ? dtype::int8 :
+            sizeof(T) == 2 ? dtype::int16 :
+            sizeof(T) == 4 ? dtype::int32 :
+            dtype::int64;
+    } else {
+        static_assert(
+            sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
+            sizeof(T) == 8
+        );
+
+        return sizeof(T) == 1 ? dtype::uint8 :
+            sizeof(T) == 2 ? dtype::uint16 :
+            sizeof(T) == 4 ? dtype::uint32 :
+            dtype::uint64;
+    }
+}
+
+} // namespace detail
+
+
+constexpr std::size_t dtype_size(dtype type) noexcept {
+    // Indexed by the enumerator values of vt::dtype.
+    constexpr std::size_t sizes[] = { 1, 2, 4, 8, 1, 2, 4, 8, 4, 8 };
+
+    return sizes[static_cast<std::size_t>(type)];
+}
+
+
+template<typename F>
+decltype(auto) visit(dtype type, F&& f) {
+    if (type == dtype::int8) return f(dtype_tag<std::int8_t>{});
+    if (type == dtype::int16) return f(dtype_tag<std::int16_t>{});
+    if (type == dtype::int32) return f(dtype_tag<std::int32_t>{});
+    if (type == dtype::int64) return f(dtype_tag<std::int64_t>{});
+    if (type == dtype::uint8) return f(dtype_tag<std::uint8_t>{});
+    if (type == dtype::uint16) return f(dtype_tag<std::uint16_t>{});
+    if (type == dtype::uint32) return f(dtype_tag<std::uint32_t>{});
+    if (type == dtype::uint64) return f(dtype_tag<std::uint64_t>{});
+    if (type == dtype::float32) return f(dtype_tag<float>{});
+
+    assert(type == dtype::float64);
+    return f(dtype_tag<double>{});
+}
+
+
+inline dynamic_shape::dynamic_shape() noexcept :
+    _rank{0},
+    _inline{}
+{
+}
+
+
+inline dynamic_shape::dynamic_shape(std::size_t rank_) :
+    _rank{rank_},
+    _inline{}
+{
+    // Shapes up to inline_capacity dimensions are stored without any heap
+    // allocation, which covers the vast majority of arrays in practice.
+    if (_rank > inline_capacity) {
+        _heap = std::make_unique<std::size_t[]>(_rank);
+    }
+}
+
+
+inline dynamic_shape::dynamic_shape(
+    std::initializer_list<std::size_t> shape_
+) :
+    dynamic_shape(shape_.size())
+{
+    std::copy(shape_.begin(), shape_.end(), this->data());
+}
+
+
+template<std::size_t N>
+dynamic_shape::dynamic_shape(const std::array<std::size_t, N>& shape_) :
+    dynamic_shape(N)
+{
+    std::copy(shape_.begin(), shape_.end(), this->data());
+}
+
+
+inline dynamic_shape::dynamic_shape(const dynamic_shape& other) :
+    dynamic_shape(other._rank)
+{
+    std::copy(other.begin(), other.end(), this->data());
+}
+
+
+inline dynamic_shape::dynamic_shape(dynamic_shape&& other) noexcept :
+    _rank{other._rank},
+    _heap{std::move(other._heap)}
+{
+    std::copy(std::begin(other._inline), std::end(other._inline), _inline);
+    other._rank = 0;
+}
+
+
+inline dynamic_shape& dynamic_shape::operator=(const dynamic_shape& other) {
+    if (&other == this) return *this;
+
+    *this = dynamic_shape{other};
+    return *this;
+}
+
+
+inline dynamic_shape& dynamic_shape::operator=(
+    dynamic_shape&& other
+) noexcept {
+    if (&other == this) return *this;
+
+    _rank = other._rank;
+    _heap = std::move(other._heap);
+    std::copy(std::begin(other._inline), std::end(other._inline), _inline);
+    other._rank = 0;
+
+    return *this;
+}
+
+
+inline std::size_t& dynamic_shape::operator[](std::size_t dim) noexcept {
+    assert(dim < _rank);
+
+    return this->data()[dim];
+}
+
+
+inline std::size_t dynamic_shape::operator[](std::size_t dim) const noexcept {
+    assert(dim < _rank);
+
+    return this->data()[dim];
+}
+
+
+inline std::size_t dynamic_shape::rank() const noexcept {
+    return _rank;
+}
+
+
+inline std::size_t dynamic_shape::element_count() const noexcept {
+    std::size_t count = 1;
+    for (std::size_t i = 0; i < _rank; ++i) {
+        count *= this->data()[i];
+    }
+
+    return count;
+}
+
+
+inline std::size_t* dynamic_shape::data() noexcept {
+    return _heap ? _heap.get() : _inline;
+}
+
+
+inline const std::size_t* dynamic_shape::data() const noexcept {
+    return _heap ? _heap.get() : _inline;
+}
+
+
+inline const std::size_t* dynamic_shape::begin() const noexcept {
+    return this->data();
+}
+
+
+inline const std::size_t* dynamic_shape::end() const noexcept {
+    return this->data() + _rank;
+}
+
+
+template<std::size_t N>
+std::array<std::size_t, N> dynamic_shape::to_array() const noexcept {
+    assert(N == _rank);
+
+    std::array<std::size_t, N> shape_;
+    std::copy(this->begin(), this->end(), shape_.begin());
+
+    return shape_;
+}
+
+
+inline bool operator==(
+    const dynamic_shape& lhs,
+    const dynamic_shape& rhs
+) noexcept {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+
+inline bool operator!=(
+    const dynamic_shape& lhs,
+    const dynamic_shape& rhs
+) noexcept {
+    return !(lhs == rhs);
+}
+
+
+template<typename T>
+dynamic_ndview<T>::dynamic_ndview(
+    vt::dtype type_,
+    dynamic_shape shape_,
+    T* data_
+) noexcept :
+    _type{type_},
+    _shape{std::move(shape_)},
+    _data{data_}
+{
+}
+
+
+template<typename T>
+template<typename U, std::size_t N, typename>
+dynamic_ndview<T>::dynamic_ndview(ndview<U, N> view) :
+    _type{dtype_of<U>},
+    _shape{view.shape()},
+    _data{view.data()}
+{
+}
+
+
+template<typename T>
+dynamic_ndview<T>::operator dynamic_ndview<const void>() const noexcept {
+    return { _type, _shape, _data };
+}
+
+
+template<typename T>
+vt::dtype dynamic_ndview<T>::type() const noexcept {
+    return _type;
+}
+
+
+template<typename T>
+std::size_t dynamic_ndview<T>::rank() const noexcept {
+    return _shape.rank();
+}
+
+
+template<typename T>
+const dynamic_shape& dynamic_ndview<T>::shape() const noexcept {
+    return _shape;
+}
+
+
+template<typename T>
+std::size_t dynamic_ndview<T>::shape(std::size_t dim) const noexcept {
+    return _shape[dim];
+}
+
+
+template<typename T>
+std::size_t dynamic_ndview<T>::element_count() const noexcept {
+    return _shape.element_count();
+}
+
+
+template<typename T>
+std::size_t dynamic_ndview<T>::byte_size() const noexcept {
+    return this->element_count() * dtype_size(_type);
+}
+
+
+template<typename T>
+T* dynamic_ndview<T>::data() const noexcept {
+    return _data;
+}
+
+
+template<typename T>
+template<typename U, std::size_t N>
+bool dynamic_ndview<T>::holds() const noexcept {
+    return dtype_of<U> == _type && N == _shape.rank();
+}
+
+
+template<typename T>
+template<typename U, std::size_t N>
+ndview<U, N> dynamic_ndview<T>::as() const noexcept {
+    static_assert(std::is_const_v<U> || !std::is_const_v<T>);
+    assert((this->holds<U, N>()));
+
+    return { _shape.template to_array<N>(), static_cast<U*>(_data) };
+}
+
+
+template<typename T>
+template<typename U>
+ndview<U, 1> dynamic_ndview<T>::flatten() const noexcept {
+    static_assert(std::is_const_v<U> || !std::is_const_v<T>);
+    assert(dtype_of<U> == _type);
+
+    return { { this->element_count() }, static_cast<U*>(_data) };
+}
+
+
+namespace detail {
+
+// Calls f with the view as an ndview<U, N>, for the N that equals its rank
+template<typename U, std::size_t N, typename T, typename F>
+decltype(auto) visit_rank(const dynamic_ndview<T>& view, F& f) {
+    if constexpr (N < max_visit_rank) {
+        if (view.rank() != N) return visit_rank<U, N + 1>(view, f);
+    }
+
+    return f(view.template as<U, N>());
+}
+
+} // namespace detail
+
+
+template<typename T, typename F>
+decltype(auto) visit(const dynamic_ndview<T>& view, F&& f) {
+    if (view.rank() == 0 || view.rank() > max_visit_rank) {
+        throw std::invalid_argument{"vt::visit: unsupported rank"};
+    }
+
+    return visit(view.type(), [&](auto tag) -> decltype(auto) {
+        using U = std::conditional_t<
+            std::is_const_v<T>,
+            const typename decltype(tag)::type,
+            typename decltype(tag)::type
+        >;
+
+        return detail::visit_rank<U, 1>(view, f);
+    });
+}
+
+
+inline dynamic_ndarray::dynamic_ndarray() noexcept :
+    _type{dtype::float64},
+    _shape{std::array<std::size_t, 1>{ 0 }},
+    _data{nullptr}
+{
+}
+
+
+inline dynamic_ndarray::dynamic_ndarray(
+    vt::dtype type_,
+    dynamic_shape shape_,
+    const allocator_type& alloc
+) :
+    _alloc{alloc},
+    _type{type_},
+    _shape{std::move(shape_)},
+    _data{nullptr}
+{
+    // Like vt::ndarray with fundamental element types, the elements are left
+    // uninitialized.
+    this->allocate();
+}
+
+
+template<typename T, std::size_t N>
+dynamic_ndarray::dynamic_ndarray(
+    ndview<T, N> view_,
+    const allocator_type& alloc
+) :
+    dynamic_ndarray{dynamic_ndview<const void>{view_}, alloc}
+{
+}
+
+
+inline dynamic_ndarray::dynamic_ndarray(
+    dynamic_ndview<const void> view_,
+    const allocator_type& alloc
+) :
+    dynamic_ndarray{view_.type(), view_.shape(), alloc}
+{
+    if (this->byte_size() > 0) {
+        std::memcpy(_data, view_.data(), this->byte_size());
+    }
+}
+
+
+inline dynamic_ndarray::dynamic_ndarray(const dynamic_ndarray& other) :
+    dynamic_ndarray{other.cview(), other._alloc}
+{
+}
+
+
+inline dynamic_ndarray::dynamic_ndarray(dynamic_ndarray&& other) noexcept :
+    _alloc{other._alloc},
+    _type{other._type},
+    _shape{std::move(other._shape)},
+    _data{std::exchange(other._data, nullptr)}
+{
+    other._shape = dynamic_shape{std::array<std::size_t, 1>{ 0 }};
+}
+
+
+inline dynamic_ndarray::~dynamic_ndarray() {
+    this->deallocate();
+}
+
+
+inline dynamic_ndarray& dynamic_ndarray::operator=(
+    const dynamic_ndarray& other
+) {
+    if (&other == this) return *this;
+
+    dynamic_ndarray{other}.swap(*this);
+    return *this;
+}
+
+
+inline dynamic_ndarray& dynamic_ndarray::operator=(
+    dynamic_ndarray&& other
+) noexcept {
+    if (&other == this) return *this;
+
+    dynamic_ndarray{std::move(other)}.swap(*this);
+    return *this;
+}
+
+
+inline dynamic_ndarray::operator dynamic_ndview<void>() noexcept {
+    return this->view();
+}
+
+
+inline dynamic_ndarray::operator dynamic_ndview<const void>() const noexcept {
+    return this->cview();
+}
+
+
+inline dynamic_ndview<void> dynamic_ndarray::view() noexcept {
+    return { _type, _shape, _data };
+}
+
+
+inline dynamic_ndview<const void> dynamic_ndarray::view() const noexcept {
+    return { _type, _shape, _data };
+}
+
+
+inline dynamic_ndview<const void> dynamic_ndarray::cview() const noexcept {
+    return { _type, _shape, _data };
+}
+
+
+inline vt::dtype dynamic_ndarray::type() const noexcept {
+    return _type;
+}
+
+
+inline std::size_t dynamic_ndarray::rank() const noexcept {
+    return _shape.rank();
+}
+
+
+inline const dynamic_shape& dynamic_ndarray::shape() const noexcept {
+    return _shape;
+}
+
+
+inline std::size_t dynamic_ndarray::shape(std::size_t dim) const noexcept {
+    return _shape[dim];
+}
+
+
+inline std::size_t dynamic_ndarray::element_count() const noexcept {
+    return _shape.element_count();
+}
+
+
+inline std::size_t dynamic_ndarray::byte_size() const noexcept {
+    return this->element_count() * dtype_size(_type);
+}
+
+
+inline void* dynamic_ndarray::data() noexcept {
+    return _data;
+}
+
+
+inline const void* dynamic_ndarray::data() const noexcept {
+    return _data;
+}
+
+
+inline dynamic_ndarray::allocator_type dynamic_ndarray::get_allocator(
+) const noexcept {
+    return _alloc;
+}
+
+
+template<typename U, std::size_t N>
+bool dynamic_ndarray::holds() const noexcept {
+    return dtype_of<U> == _type && N == _shape.rank();
+}
+
+
+template<typename U, std::size_t N>
+ndview<U, N> dynamic_ndarray::as() noexcept {
+    assert((this->holds<U, N>()));
+
+    return { _shape.template to_array<N>(), static_cast<U*>(this->data()) };
+}
+
+
+template<typename U, std::size_t N>
+ndview<const U, N> dynamic_ndarray::as() const noexcept {
+    assert((this->holds<U, N>()));
+
+    return {
+        _shape.template to_array<N>(),
+        static_cast<const U*>(this->data())
+    };
+}
+
+
+template<typename U>
+ndview<U, 1> dynamic_ndarray::flatten() noexcept {
+    assert(dtype_of<U> == _type);
+
+    return { { this->element_count() }, static_cast<U*>(this->data()) };
+}
+
+
+template<typename U>
+ndview<const U, 1> dynamic_ndarray::flatten() const noexcept {
+    assert(dtype_of<U> == _type);
+
+    return {
+        { this->element_count() },
+        static_cast<const U*>(this->data())
+    };
+}
+
+
+inline void dynamic_ndarray::swap(dynamic_ndarray& other) noexcept {
+    using std::swap;
+
+    swap(_alloc, other._alloc);
+    swap(_type, other._type);
+    swap(_shape, other._shape);
+    swap(_data, other._data);
+}
+
+
+inline void dynamic_ndarray::allocate() {
+    const std::size_t n = this->byte_size();
+    _data = n > 0 ? _alloc.allocate(n) : nullptr;
+}
+
+
+inline void dynamic_ndarray::deallocate() noexcept {
+    if (_data != nullptr) {
+        _alloc.deallocate(_data, this->byte_size());
+        _data = nullptr;
+    }
+}
+
+
+inline void swap(dynamic_ndarray& a, dynamic_ndarray& b) noexcept {
+    a.swap(b);
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_DYNAMIC_IPP_
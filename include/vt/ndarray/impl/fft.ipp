@@ -0,0 +1,826 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_FFT_IPP_
+#define VT_NDARRAY_IMPL_FFT_IPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/impl/parallel.ipp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+
+namespace vt {
+
+namespace detail {
+
+// Number of adjacent columns that are transformed together along an axis
+// other than the last one. The columns form the innermost, contiguous loop of
+// every butterfly. Blocks are narrowed for long axes, so that the two buffers
+// of a block stay in the L2 cache, but are kept at least a cache line wide.
+template<typename T>
+std::size_t fft_block_width(std::size_t length) noexcept {
+    constexpr std::size_t max_width = 32;
+
+    const cpu_topology& topology = cpu_topology::get();
+    const std::size_t column_size = 2 * length * sizeof(std::complex<T>);
+    const std::size_t min_width = std::max<std::size_t>(
+        1, topology.cache_line_size / sizeof(std::complex<T>)
+    );
+
+    std::size_t width = max_width;
+    while (width > min_width && width * column_size > topology.l2_cache_size) {
+        width /= 2;
+    }
+
+    return width;
+}
+
+
+template<typename T>
+using complex_vector =
+    std::vector<std::complex<T>, ndarray_allocator<std::complex<T>>>;
+
+
+// Written out, since operator* of std::complex handles infinities and NaNs
+// through a library call that prevents vectorization.
+template<typename T>
+std::complex<T> cmul(
+    const std::complex<T>& a,
+    const std::complex<T>& b
+) noexcept {
+    return {
+        a.real() * b.real() - a.imag() * b.imag(),
+        a.real() * b.imag() + a.imag() * b.real()
+    };
+}
+
+
+// Returns f * i * a
+template<typename T>
+std::complex<T> mul_i(const std::complex<T>& a, T f) noexcept {
+    return {-f * a.imag(), f * a.real()};
+}
+
+
+// Returns exp(-2 pi i k / n)
+template<typename T>
+std::complex<T> unit_root(std::size_t k, std::size_t n) noexcept {
+    constexpr double pi = 3.14159265358979323846;
+    const double angle =
+        -2.0 * pi * static_cast<double>(k % n) / static_cast<double>(n);
+
+    return {static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle))};
+}
+
+
+// Minimum number of contiguous butterflies that share their twiddles, below
+// which a stage loops over the twiddles innermost instead
+constexpr std::size_t fft_min_stride = 4;
+
+
+// The butterflies below transform z in place. The sign is -1 for forward and
+// 1 for backward transforms.
+
+template<typename T>
+void butterfly(std::array<std::complex<T>, 2>& z, T) noexcept {
+    const std::complex<T> z0 = z[0];
+
+    z[0] = z0 + z[1];
+    z[1] = z0 - z[1];
+}
+
+
+template<typename T>
+void butterfly(std::array<std::complex<T>, 3>& z, T sign) noexcept {
+    // sin(2 pi / 3)
+    const T s = static_cast<T>(0.86602540378443864676) * sign;
+
+    const std::complex<T> t1 = z[1] + z[2];
+    const std::complex<T> t2 = z[0] - t1 * T{0.5};
+    const std::complex<T> t3 = mul_i(z[1] - z[2], s);
+
+    z[0] = z[0] + t1;
+    z[1] = t2 + t3;
+    z[2] = t2 - t3;
+}
+
+
+template<typename T>
+void butterfly(std::array<std::complex<T>, 4>& z, T sign) noexcept {
+    const std::complex<T> a0 = z[0] + z[2];
+    const std::complex<T> a1 = z[0] - z[2];
+    const std::complex<T> b0 = z[1] + z[3];
+    const std::complex<T> b1 = mul_i(z[1] - z[3], sign);
+
+    z[0] = a0 + b0;
+    z[1] = a1 + b1;
+    z[2] = a0 - b0;
+    z[3] = a1 - b1;
+}
+
+
+template<typename T>
+void butterfly(std::array<std::complex<T>, 5>& z, T sign) noexcept {
+    // cos(2 pi / 5), cos(4 pi / 5), sin(2 pi / 5) and sin(4 pi / 5)
+    const T c1 = static_cast<T>(0.30901699437494742410);
+    const T c2 = static_cast<T>(-0.80901699437494742410);
+    const T s1 = static_cast<T>(0.95105651629515357212) * sign;
+    const T s2 = static_cast<T>(0.58778525229247312917) * sign;
+
+    const std::complex<T> a1 = z[1] + z[4];
+    const std::complex<T> b1 = z[1] - z[4];
+    const std::complex<T> a2 = z[2] + z[3];
+    const std::complex<T> b2 = z[2] - z[3];
+
+    const std::complex<T> t1 = z[0] + a1 * c1 + a2 * c2;
+    const std::complex<T> t2 = z[0] + a1 * c2 + a2 * c1;
+    const std::complex<T> u1 = mul_i(b1 * s1 + b2 * s2, T{1});
+    const std::complex<T> u2 = mul_i(b1 * s2 - b2 * s1, T{1});
+
+    z[0] = z[0] + a1 + a2;
+    z[1] = t1 + u1;
+    z[2] = t2 + u2;
+    z[3] = t2 - u2;
+    z[4] = t1 - u1;
+}
+
+
+// One Stockham stage of radix P after `length` points have been combined:
+// for every k < length and j < stride, the inputs
+// src[(k P + q) stride + j], multiplied by twiddle w[k (P - 1) + q - 1] for
+// q > 0, are transformed into dst[(k + m length) stride + j] for m < P.
+template<std::size_t P, typename T>
+void fft_stage(
+    const std::complex<T>* src,
+    std::complex<T>* dst,
+    std::size_t length,
+    std::size_t stride,
+    const std::complex<T>* w,
+    T sign
+) noexcept {
+    const std::size_t out_stride = length * stride;
+    std::array<std::complex<T>, P> z;
+
+    if (stride >= fft_min_stride || length == 1) {
+        for (std::size_t k = 0; k < length; ++k) {
+            const std::complex<T>* in = src + k * P * stride;
+            std::complex<T>* out = dst + k * stride;
+
+            std::array<std::complex<T>, P - 1> wk;
+            std::copy_n(w + k * (P - 1), P - 1, wk.begin());
+
+            for (std::size_t j = 0; j < stride; ++j) {
+                z[0] = in[j];
+                for (std::size_t q = 1; q < P; ++q) {
+                    z[q] = cmul(in[q * stride + j], wk[q - 1]);
+                }
+                butterfly(z, sign);
+                for (std::size_t m = 0; m < P; ++m) {
+                    out[m * out_stride + j] = z[m];
+                }
+            }
+        }
+    } else {
+        for (std::size_t j = 0; j < stride; ++j) {
+            for (std::size_t k = 0; k < length; ++k) {
+                const std::complex<T>* in = src + k * P * stride + j;
+                const std::complex<T>* wk = w + k * (P - 1);
+
+                z[0] = in[0];
+                for (std::size_t q = 1; q < P; ++q) {
+                    z[q] = cmul(in[q * stride], wk[q - 1]);
+                }
+                butterfly(z, sign);
+                for (std::size_t m = 0; m < P; ++m) {
+                    dst[k * stride + m * out_stride + j] = z[m];
+                }
+            }
+        }
+    }
+}
+
+
+// Stage for any other prime radix, as a direct DFT with
+// roots[i] = w(radix)^i
+template<typename T>
+void fft_stage_generic(
+    const std::complex<T>* src,
+    std::complex<T>* dst,
+    std::size_t radix,
+    std::size_t length,
+    std::size_t stride,
+    const std::complex<T>* w,
+    const std::complex<T>* roots
+) noexcept {
+    const std::size_t out_stride = length * stride;
+
+    for (std::size_t k = 0; k < length; ++k) {
+        const std::complex<T>* in = src + k * radix * stride;
+        const std::complex<T>* wk = w + k * (radix - 1);
+
+        for (std::size_t m = 0; m < radix; ++m) {
+            std::complex<T>* out = dst + k * stride + m * out_stride;
+            std::copy_n(in, stride, out);
+
+            for (std::size_t q = 1; q < radix; ++q) {
+                const std::complex<T> factor =
+                    cmul(wk[q - 1], roots[q * m % radix]);
+                const std::complex<T>* in_q = in + q * stride;
+                for (std::size_t j = 0; j < stride; ++j) {
+                    out[j] += cmul(in_q[j], factor);
+                }
+            }
+        }
+    }
+}
+
+
+template<typename T>
+struct fft_plan_cache {
+    std::mutex mutex;
+    std::unordered_map<std::size_t, std::shared_ptr<const fft_plan<T>>> plans;
+    std::unordered_map<std::size_t, std::shared_ptr<const complex_vector<T>>>
+        real_twiddles;
+};
+
+
+template<typename T>
+fft_plan_cache<T>& get_fft_plan_cache() {
+    static fft_plan_cache<T> cache;
+
+    return cache;
+}
+
+
+// Returns exp(-2 pi i k / n) for k <= n / 2, which combine the two halves of
+// an even length real transform
+template<typename T>
+std::shared_ptr<const complex_vector<T>> get_real_twiddles(std::size_t n) {
+    fft_plan_cache<T>& cache = get_fft_plan_cache<T>();
+    std::lock_guard<std::mutex> lock{cache.mutex};
+
+    std::shared_ptr<const complex_vector<T>>& twiddles =
+        cache.real_twiddles[n];
+    if (!twiddles) {
+        complex_vector<T> values;
+        values.reserve(n / 2 + 1);
+        for (std::size_t k = 0; k <= n / 2; ++k) {
+            values.push_back(unit_root<T>(k, n));
+        }
+        twiddles = std::make_shared<const complex_vector<T>>(
+            std::move(values)
+        );
+    }
+
+    return twiddles;
+}
+
+
+template<std::size_t N>
+std::array<std::size_t, N> fft_axes(
+    std::initializer_list<std::size_t> axes,
+    std::size_t& count
+) noexcept {
+    std::array<std::size_t, N> result{};
+
+    if (axes.size() == 0) {
+        for (std::size_t i = 0; i < N; ++i) result[i] = i;
+        count = N;
+    } else {
+        assert(axes.size() <= N);
+        count = 0;
+        for (std::size_t axis : axes) {
+            assert(axis < N);
+            assert(std::find(result.begin(), result.begin() + count, axis) ==
+                result.begin() + count);
+            result[count++] = axis;
+        }
+    }
+
+    return result;
+}
+
+
+// Returns the number of elements before and after `axis` in row-major order
+template<std::size_t N>
+std::pair<std::size_t, std::size_t> fft_extent(
+    const std::array<std::size_t, N>& shape,
+    std::size_t axis
+) noexcept {
+    std::size_t outer = 1;
+    std::size_t inner = 1;
+    for (std::size_t i = 0; i < axis; ++i) outer *= shape[i];
+    for (std::size_t i = axis + 1; i < N; ++i) inner *= shape[i];
+
+    return {outer, inner};
+}
+
+
+// Calls f(o, c0, count, line, work) for blocks of up to fft_block_width
+// adjacent columns [c0, c0 + count) of every outer index o, divided over
+// threads. The two buffers hold `length` rows of a block each and are owned
+// by the calling thread.
+template<typename T, typename F>
+void for_each_fft_block(
+    std::size_t outer,
+    std::size_t inner,
+    std::size_t length,
+    std::size_t thread_count,
+    F&& f
+) {
+    if (outer == 0 || inner == 0) return;
+
+    const std::size_t width = std::min(inner, fft_block_width<T>(length));
+    const std::size_t blocks = (inner + width - 1) / width;
+    const std::size_t total = outer * blocks;
+    const std::size_t chunk_count =
+        std::min(resolve_thread_count(thread_count), total);
+    const std::size_t buffer_size = length * width;
+
+    complex_vector<T> buffers(2 * chunk_count * buffer_size);
+
+    parallel_invoke(chunk_count, [&](std::size_t i) {
+        std::complex<T>* line = buffers.data() + 2 * i * buffer_size;
+        std::complex<T>* work = line + buffer_size;
+
+        const std::size_t last = total * (i + 1) / chunk_count;
+        for (std::size_t b = total * i / chunk_count; b < last; ++b) {
+            const std::size_t c0 = b % blocks * width;
+            f(b / blocks, c0, std::min(width, inner - c0), line, work);
+        }
+    });
+}
+
+
+// Transforms all sequences along an axis of a contiguous array in place
+template<typename T>
+void fft_axis(
+    std::complex<T>* data,
+    std::size_t outer,
+    std::size_t n,
+    std::size_t inner,
+    fft_direction direction,
+    std::size_t thread_count
+) {
+    if (n <= 1) return;
+
+    const std::shared_ptr<const fft_plan<T>> plan = fft_plan<T>::get(n);
+
+    for_each_fft_block<T>(outer, inner, n, thread_count, [&](
+        std::size_t o, std::size_t c0, std::size_t count,
+        std::complex<T>* line, std::complex<T>* work
+    ) {
+        std::complex<T>* base = data + o * n * inner + c0;
+
+        // A block spanning all columns is already laid out as the plan wants
+        if (count == inner) {
+            plan->execute(base, work, count, direction);
+            return;
+        }
+
+        for (std::size_t t = 0; t < n; ++t) {
+            std::copy_n(base + t * inner, count, line + t * count);
+        }
+        plan->execute(line, work, count, direction);
+        for (std::size_t t = 0; t < n; ++t) {
+            std::copy_n(line + t * count, count, base + t * inner);
+        }
+    });
+}
+
+
+// Forward transform along an axis of length n of real input, writing the
+// n / 2 + 1 non-negative frequencies. Even lengths are transformed as a
+// complex sequence of half the length.
+template<typename T>
+void rfft_axis(
+    const T* in,
+    std::complex<T>* out,
+    std::size_t outer,
+    std::size_t n,
+    std::size_t inner,
+    std::size_t thread_count
+) {
+    const bool even = n % 2 == 0;
+    const std::size_t m = even ? n / 2 : n;
+    const std::size_t half = n / 2 + 1;
+    const std::shared_ptr<const fft_plan<T>> plan = fft_plan<T>::get(m);
+
+    const std::shared_ptr<const complex_vector<T>> twiddles =
+        even ? get_real_twiddles<T>(n) : nullptr;
+
+    for_each_fft_block<T>(outer, inner, m, thread_count, [&](
+        std::size_t o, std::size_t c0, std::size_t count,
+        std::complex<T>* line, std::complex<T>* work
+    ) {
+        const T* src = in + o * n * inner + c0;
+        std::complex<T>* dst = out + o * half * inner + c0;
+
+        if (!even) {
+            for (std::size_t t = 0; t < n; ++t) {
+                for (std::size_t c = 0; c < count; ++c) {
+                    line[t * count + c] = {src[t * inner + c], T{0}};
+                }
+            }
+            plan->execute(line, work, count, fft_direction::forward);
+            for (std::size_t k = 0; k < half; ++k) {
+                std::copy_n(line + k * count, count, dst + k * inner);
+            }
+            return;
+        }
+
+        for (std::size_t t = 0; t < m; ++t) {
+            const T* even_row = src + 2 * t * inner;
+            const T* odd_row = even_row + inner;
+            for (std::size_t c = 0; c < count; ++c) {
+                line[t * count + c] = {even_row[c], odd_row[c]};
+            }
+        }
+        plan->execute(line, work, count, fft_direction::forward);
+
+        // Separate the transforms of the even and odd samples and combine
+        // them into the full transform
+        for (std::size_t k = 0; k <= m; ++k) {
+            const std::complex<T>* z = line + (k < m ? k : 0) * count;
+            const std::complex<T>* z_mirror =
+                line + (k > 0 ? m - k : 0) * count;
+            std::complex<T>* x = dst + k * inner;
+            const std::complex<T> w = (*twiddles)[k];
+            for (std::size_t c = 0; c < count; ++c) {
+                const std::complex<T> a = z[c];
+                const std::complex<T> b = std::conj(z_mirror[c]);
+                const std::complex<T> e = (a + b) * T{0.5};
+                const std::complex<T> d = mul_i(a - b, T{-0.5});
+                x[c] = e + cmul(w, d);
+            }
+        }
+    });
+}
+
+
+// Unnormalized backward transform along an axis of the n / 2 + 1
+// non-negative frequencies of a real sequence of length n
+template<typename T>
+void irfft_axis(
+    const std::complex<T>* in,
+    T* out,
+    std::size_t outer,
+    std::size_t n,
+    std::size_t inner,
+    std::size_t thread_count
+) {
+    const bool even = n % 2 == 0;
+    const std::size_t m = even ? n / 2 : n;
+    const std::size_t half = n / 2 + 1;
+    const std::shared_ptr<const fft_plan<T>> plan = fft_plan<T>::get(m);
+
+    const std::shared_ptr<const complex_vector<T>> twiddles =
+        even ? get_real_twiddles<T>(n) : nullptr;
+
+    for_each_fft_block<T>(outer, inner, m, thread_count, [&](
+        std::size_t o, std::size_t c0, std::size_t count,
+        std::complex<T>* line, std::complex<T>* work
+    ) {
+        const std::complex<T>* src = in + o * half * inner + c0;
+        T* dst = out + o * n * inner + c0;
+
+        if (!even) {
+            // Complete the spectrum from its Hermitian symmetry
+            for (std::size_t k = 0; k < half; ++k) {
+                const std::complex<T>* x = src + k * inner;
+                for (std::size_t c = 0; c < count; ++c) {
+                    line[k * count + c] = x[c];
+                    if (k > 0) line[(n - k) * count + c] = std::conj(x[c]);
+                }
+            }
+            plan->execute(line, work, count, fft_direction::backward);
+            for (std::size_t t = 0; t < n; ++t) {
+                for (std::size_t c = 0; c < count; ++c) {
+                    dst[t * inner + c] = line[t * count + c].real();
+                }
+            }
+            return;
+        }
+
+        // Recombine into the transform of the even samples plus i times the
+        // transform of the odd samples
+        for (std::size_t k = 0; k < m; ++k) {
+            const std::complex<T>* x = src + k * inner;
+            const std::complex<T>* x_mirror = src + (m - k) * inner;
+            const std::complex<T> w = std::conj((*twiddles)[k]);
+            for (std::size_t c = 0; c < count; ++c) {
+                const std::complex<T> a = x[c];
+                const std::complex<T> b = std::conj(x_mirror[c]);
+                const std::complex<T> e = a + b;
+                const std::complex<T> d = cmul(a - b, w);
+                line[k * count + c] = e + mul_i(d, T{1});
+            }
+        }
+        plan->execute(line, work, count, fft_direction::backward);
+
+        for (std::size_t t = 0; t < m; ++t) {
+            T* even_row = dst + 2 * t * inner;
+            T* odd_row = even_row + inner;
+            for (std::size_t c = 0; c < count; ++c) {
+                even_row[c] = line[t * count + c].real();
+                odd_row[c] = line[t * count + c].imag();
+            }
+        }
+    });
+}
+
+
+template<typename T, std::size_t N>
+void scale(ndview<std::complex<T>, N> data, T factor) noexcept {
+    for (std::complex<T>& x : data) x *= factor;
+}
+
+} // namespace detail
+
+
+template<typename T>
+fft_plan<T>::fft_plan(std::size_t n) : _size{n} {
+    std::vector<std::size_t> radices;
+    constexpr std::size_t small_radices[] = {4, 2, 3, 5};
+
+    std::size_t remainder = n;
+    for (std::size_t radix : small_radices) {
+        while (remainder > 1 && remainder % radix == 0) {
+            radices.push_back(radix);
+            remainder /= radix;
+        }
+    }
+    for (std::size_t radix = 7; radix * radix <= remainder; radix += 2) {
+        while (remainder % radix == 0) {
+            radices.push_back(radix);
+            remainder /= radix;
+        }
+    }
+    if (remainder > 1) radices.push_back(remainder);
+
+    // Stage twiddles w(L p)^(q k) for k < L and 0 < q < p, followed by the
+    // roots w(p)^j for a generic stage. Backward transforms use the
+    // conjugates.
+    std::size_t length = 1;
+    for (std::size_t radix : radices) {
+        _stages.push_back({radix, length, _twiddles.size()});
+
+        for (std::size_t k = 0; k < length; ++k) {
+            for (std::size_t q = 1; q < radix; ++q) {
+                _twiddles.push_back(
+                    detail::unit_root<T>(q * k, length * radix)
+                );
+            }
+        }
+        if (radix > 5) {
+            for (std::size_t j = 0; j < radix; ++j) {
+                _twiddles.push_back(detail::unit_root<T>(j, radix));
+            }
+        }
+
+        length *= radix;
+    }
+
+    _inverse_twiddles.reserve(_twiddles.size());
+    for (const std::complex<T>& w : _twiddles) {
+        _inverse_twiddles.push_back(std::conj(w));
+    }
+}
+
+
+template<typename T>
+std::shared_ptr<const fft_plan<T>> fft_plan<T>::get(std::size_t n) {
+    detail::fft_plan_cache<T>& cache = detail::get_fft_plan_cache<T>();
+    std::lock_guard<std::mutex> lock{cache.mutex};
+
+    std::shared_ptr<const fft_plan>& plan = cache.plans[n];
+    if (!plan) plan = std::make_shared<const fft_plan>(n);
+
+    return plan;
+}
+
+
+template<typename T>
+void fft_plan<T>::clear_cache() {
+    detail::fft_plan_cache<T>& cache = detail::get_fft_plan_cache<T>();
+    std::lock_guard<std::mutex> lock{cache.mutex};
+
+    cache.plans.clear();
+    cache.real_twiddles.clear();
+}
+
+
+template<typename T>
+std::size_t fft_plan<T>::size() const noexcept {
+    return _size;
+}
+
+
+template<typename T>
+void fft_plan<T>::execute(
+    std::complex<T>* data,
+    std::complex<T>* work,
+    std::size_t batch,
+    fft_direction direction
+) const noexcept {
+    const bool inverse = direction == fft_direction::backward;
+    const T sign = inverse ? T{1} : T{-1};
+    const std::complex<T>* twiddles =
+        inverse ? _inverse_twiddles.data() : _twiddles.data();
+
+    // Stockham auto-sort: every stage reads from one buffer and writes to the
+    // other in natural order, so no bit reversal is needed
+    std::complex<T>* src = data;
+    std::complex<T>* dst = work;
+    for (const stage& s : _stages) {
+        const std::size_t stride = _size / (s.length * s.radix) * batch;
+        const std::complex<T>* w = twiddles + s.twiddle_offset;
+
+        if (s.radix == 2) {
+            detail::fft_stage<2>(src, dst, s.length, stride, w, sign);
+        } else if (s.radix == 3) {
+            detail::fft_stage<3>(src, dst, s.length, stride, w, sign);
+        } else if (s.radix == 4) {
+            detail::fft_stage<4>(src, dst, s.length, stride, w, sign);
+        } else if (s.radix == 5) {
+            detail::fft_stage<5>(src, dst, s.length, stride, w, sign);
+        } else {
+            detail::fft_stage_generic(
+                src, dst, s.radix, s.length, stride,
+                w, w + s.length * (s.radix - 1)
+            );
+        }
+
+        std::swap(src, dst);
+    }
+
+    if (src != data) std::copy_n(src, _size * batch, data);
+}
+
+
+template<typename T, std::size_t N>
+void fft(
+    detail::nondeduced_t<ndview<const std::complex<T>, N>> in,
+    ndview<std::complex<T>, N> out,
+    std::initializer_list<std::size_t> axes,
+    std::size_t thread_count
+) {
+    assert(in.shape() == out.shape());
+
+    if (in.data() != out.data()) std::copy(in.begin(), in.end(), out.begin());
+
+    std::size_t axis_count;
+    const std::array<std::size_t, N> axis_list =
+        detail::fft_axes<N>(axes, axis_count);
+
+    for (std::size_t i = 0; i < axis_count; ++i) {
+        const std::size_t axis = axis_list[i];
+        const auto extent = detail::fft_extent(out.shape(), axis);
+        detail::fft_axis(
+            out.data(), extent.first, out.shape(axis), extent.second,
+            fft_direction::forward, thread_count
+        );
+    }
+}
+
+
+template<typename T, std::size_t N>
+void ifft(
+    detail::nondeduced_t<ndview<const std::complex<T>, N>> in,
+    ndview<std::complex<T>, N> out,
+    std::initializer_list<std::size_t> axes,
+    std::size_t thread_count
+) {
+    assert(in.shape() == out.shape());
+
+    if (in.data() != out.data()) std::copy(in.begin(), in.end(), out.begin());
+
+    std::size_t axis_count;
+    const std::array<std::size_t, N> axis_list =
+        detail::fft_axes<N>(axes, axis_count);
+
+    std::size_t length = 1;
+    for (std::size_t i = 0; i < axis_count; ++i) {
+        const std::size_t axis = axis_list[i];
+        const auto extent = detail::fft_extent(out.shape(), axis);
+        detail::fft_axis(
+            out.data(), extent.first, out.shape(axis), extent.second,
+            fft_direction::backward, thread_count
+        );
+        length *= out.shape(axis);
+    }
+
+    if (length > 1) detail::scale(out, T{1} / static_cast<T>(length));
+}
+
+
+template<typename T, std::size_t N>
+void rfft(
+    detail::nondeduced_t<ndview<const T, N>> in,
+    ndview<std::complex<T>, N> out,
+    std::initializer_list<std::size_t> axes,
+    std::size_t thread_count
+) {
+    std::size_t axis_count;
+    const std::array<std::size_t, N> axis_list =
+        detail::fft_axes<N>(axes, axis_count);
+    const std::size_t real_axis = axis_list[axis_count - 1];
+
+#ifndef NDEBUG
+    for (std::size_t i = 0; i < N; ++i) {
+        assert(out.shape(i) == (
+            i == real_axis ? in.shape(i) / 2 + 1 : in.shape(i)
+        ));
+    }
+#endif
+
+    const auto real_extent = detail::fft_extent(in.shape(), real_axis);
+    detail::rfft_axis(
+        in.data(), out.data(), real_extent.first, in.shape(real_axis),
+        real_extent.second, thread_count
+    );
+
+    for (std::size_t i = 0; i + 1 < axis_count; ++i) {
+        const std::size_t axis = axis_list[i];
+        const auto extent = detail::fft_extent(out.shape(), axis);
+        detail::fft_axis(
+            out.data(), extent.first, out.shape(axis), extent.second,
+            fft_direction::forward, thread_count
+        );
+    }
+}
+
+
+template<typename T, std::size_t N>
+void irfft(
+    detail::nondeduced_t<ndview<const std::complex<T>, N>> in,
+    ndview<T, N> out,
+    std::initializer_list<std::size_t> axes,
+    std::size_t thread_count
+) {
+    std::size_t axis_count;
+    const std::array<std::size_t, N> axis_list =
+        detail::fft_axes<N>(axes, axis_count);
+    const std::size_t real_axis = axis_list[axis_count - 1];
+
+#ifndef NDEBUG
+    for (std::size_t i = 0; i < N; ++i) {
+        assert(in.shape(i) == (
+            i == real_axis ? out.shape(i) / 2 + 1 : out.shape(i)
+        ));
+    }
+#endif
+
+    // The complex axes are transformed first, on a copy of the input
+    ndarray<std::complex<T>, N> spectrum{in.shape(), in.begin(), in.end()};
+
+    std::size_t length = out.shape(real_axis);
+    for (std::size_t i = 0; i + 1 < axis_count; ++i) {
+        const std::size_t axis = axis_list[i];
+        const auto extent = detail::fft_extent(spectrum.shape(), axis);
+        detail::fft_axis(
+            spectrum.data(), extent.first, spectrum.shape(axis),
+            extent.second, fft_direction::backward, thread_count
+        );
+        length *= spectrum.shape(axis);
+    }
+
+    const auto real_extent = detail::fft_extent(out.shape(), real_axis);
+    detail::irfft_axis(
+        spectrum.data(), out.data(), real_extent.first, out.shape(real_axis),
+        real_extent.second, thread_count
+    );
+
+    if (length > 1) {
+        const T factor = T{1} / static_cast<T>(length);
+        for (T& x : out) x *= factor;
+    }
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_FFT_IPP_
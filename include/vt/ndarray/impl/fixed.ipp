@@ -0,0 +1,263 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_FIXED_IPP_
+#define VT_NDARRAY_IMPL_FIXED_IPP_
+
+#include <cassert>
+
+
+namespace vt {
+
+template<typename T, std::size_t... Extents>
+constexpr fixed_ndarray<T, Extents...>::fixed_ndarray() noexcept(
+    std::is_nothrow_default_constructible_v<T>
+) :
+    _data{}
+{}
+
+
+template<typename T, std::size_t... Extents>
+template<typename... U, typename>
+constexpr fixed_ndarray<T, Extents...>::fixed_ndarray(const U&... init) :
+    _data{static_cast<T>(init)...}
+{
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr fixed_ndarray<T, Extents...> fixed_ndarray<T, Extents...>::filled(
+    const T& init
+) {
+    fixed_ndarray a;
+    for (std::size_t i = 0; i < element_count(); ++i) {
+        a._data[i] = init;
+    }
+
+    return a;
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr decltype(auto) fixed_ndarray<T, Extents...>::operator[](
+    std::size_t idx
+) noexcept {
+    return this->view()[idx];
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr decltype(auto) fixed_ndarray<T, Extents...>::operator[](
+    std::size_t idx
+) const noexcept {
+    return this->view()[idx];
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr fixed_ndarray<T, Extents...>::operator ndview<
+    T, fixed_ndarray<T, Extents...>::dim_count
+>() noexcept {
+    return this->view();
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr fixed_ndarray<T, Extents...>::operator ndview<
+    const T, fixed_ndarray<T, Extents...>::dim_count
+>() const noexcept {
+    return this->view();
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr ndview<T, fixed_ndarray<T, Extents...>::dim_count>
+fixed_ndarray<T, Extents...>::view() noexcept {
+    return { shape(), _data };
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr ndview<const T, fixed_ndarray<T, Extents...>::dim_count>
+fixed_ndarray<T, Extents...>::view() const noexcept {
+    return { shape(), _data };
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr ndview<const T, fixed_ndarray<T, Extents...>::dim_count>
+fixed_ndarray<T, Extents...>::cview() const noexcept {
+    return { shape(), _data };
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr std::size_t fixed_ndarray<T, Extents...>::element_count() noexcept {
+    return (Extents * ...);
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr std::array<std::size_t, fixed_ndarray<T, Extents...>::dim_count>
+fixed_ndarray<T, Extents...>::shape() noexcept {
+    return {{ Extents... }};
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr std::size_t fixed_ndarray<T, Extents...>::shape(
+    std::size_t dim
+) noexcept {
+    assert(dim < dim_count);
+
+    return shape()[dim];
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr T* fixed_ndarray<T, Extents...>::data() noexcept {
+    return _data;
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr const T* fixed_ndarray<T, Extents...>::data() const noexcept {
+    return _data;
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::iterator
+fixed_ndarray<T, Extents...>::begin() noexcept {
+    return _data;
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::const_iterator
+fixed_ndarray<T, Extents...>::begin() const noexcept {
+    return _data;
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::const_iterator
+fixed_ndarray<T, Extents...>::cbegin() const noexcept {
+    return _data;
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::iterator
+fixed_ndarray<T, Extents...>::end() noexcept {
+    return _data + element_count();
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::const_iterator
+fixed_ndarray<T, Extents...>::end() const noexcept {
+    return _data + element_count();
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::const_iterator
+fixed_ndarray<T, Extents...>::cend() const noexcept {
+    return _data + element_count();
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::reverse_iterator
+fixed_ndarray<T, Extents...>::rbegin() noexcept {
+    return reverse_iterator{this->end()};
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::const_reverse_iterator
+fixed_ndarray<T, Extents...>::rbegin() const noexcept {
+    return const_reverse_iterator{this->end()};
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::const_reverse_iterator
+fixed_ndarray<T, Extents...>::crbegin() const noexcept {
+    return const_reverse_iterator{this->cend()};
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::reverse_iterator
+fixed_ndarray<T, Extents...>::rend() noexcept {
+    return reverse_iterator{this->begin()};
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::const_reverse_iterator
+fixed_ndarray<T, Extents...>::rend() const noexcept {
+    return const_reverse_iterator{this->begin()};
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr typename fixed_ndarray<T, Extents...>::const_reverse_iterator
+fixed_ndarray<T, Extents...>::crend() const noexcept {
+    return const_reverse_iterator{this->cbegin()};
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr bool operator==(
+    const fixed_ndarray<T, Extents...>& a,
+    const fixed_ndarray<T, Extents...>& b
+) {
+    // std::equal is not constexpr before C++20
+    for (std::size_t i = 0; i < a.element_count(); ++i) {
+        if (!(a.data()[i] == b.data()[i])) return false;
+    }
+
+    return true;
+}
+
+
+template<typename T, std::size_t... Extents>
+constexpr bool operator!=(
+    const fixed_ndarray<T, Extents...>& a,
+    const fixed_ndarray<T, Extents...>& b
+) {
+    return !(a == b);
+}
+
+
+template<typename T, std::size_t... Extents>
+std::ostream& operator<<(
+    std::ostream& os,
+    const fixed_ndarray<T, Extents...>& a
+) {
+    return os << a.view();
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_FIXED_IPP_
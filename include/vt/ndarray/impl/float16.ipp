@@ -0,0 +1,394 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_FLOAT16_IPP_
+#define VT_NDARRAY_IMPL_FLOAT16_IPP_
+
+#include <vt/ndarray/impl/config.ipp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+#if VT_NDARRAY_F16C || VT_NDARRAY_AVX512F
+#   include <immintrin.h>
+#endif
+
+
+namespace vt {
+
+namespace detail {
+
+inline std::uint16_t float_to_half_bits(float value) noexcept {
+    std::uint32_t f;
+    std::memcpy(&f, &value, sizeof(f));
+
+    const auto sign = static_cast<std::uint16_t>((f >> 16) & 0x8000u);
+    f &= 0x7fffffffu;
+
+    // Infinity and NaN; NaNs are kept quiet
+    if (f >= 0x7f800000u) {
+        const std::uint32_t nan = f > 0x7f800000u ?
+            0x200u | ((f >> 13) & 0x3ffu) :
+            0u;
+        return static_cast<std::uint16_t>(sign | 0x7c00u | nan);
+    }
+
+    // Values of at least 65520 round to infinity
+    if (f >= 0x477ff000u) {
+        return static_cast<std::uint16_t>(sign | 0x7c00u);
+    }
+
+    // Subnormal results; values of at most 2^-25 round to zero
+    if (f < 0x38800000u) {
+        if (f <= 0x33000000u) return sign;
+
+        const std::uint32_t mantissa = (f & 0x7fffffu) | 0x800000u;
+        const std::uint32_t shift = 126u - (f >> 23);
+        const std::uint32_t rest = mantissa & ((1u << shift) - 1u);
+        const std::uint32_t halfway = 1u << (shift - 1u);
+
+        std::uint32_t h = mantissa >> shift;
+        if (rest > halfway || (rest == halfway && (h & 1u))) ++h;
+
+        return static_cast<std::uint16_t>(sign | h);
+    }
+
+    // Normal results. Rebias the exponent and round to nearest even; a carry
+    // out of the mantissa correctly increments the exponent.
+    std::uint32_t h = (f - 0x38000000u) >> 13;
+    const std::uint32_t rest = f & 0x1fffu;
+    if (rest > 0x1000u || (rest == 0x1000u && (h & 1u))) ++h;
+
+    return static_cast<std::uint16_t>(sign | h);
+}
+
+
+inline float half_bits_to_float(std::uint16_t h) noexcept {
+    const std::uint32_t sign = (h & 0x8000u) << 16;
+    std::uint32_t exponent = (h >> 10) & 0x1fu;
+    std::uint32_t mantissa = h & 0x3ffu;
+
+    std::uint32_t f;
+    if (exponent == 0x1fu) {
+        f = sign | 0x7f800000u | (mantissa << 13);
+    } else if (exponent != 0) {
+        f = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        f = sign;
+    } else {
+        // Subnormal half values are normal float values
+        exponent = 113;
+        while (!(mantissa & 0x400u)) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        f = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+    }
+
+    float value;
+    std::memcpy(&value, &f, sizeof(value));
+    return value;
+}
+
+
+inline std::uint16_t float_to_bfloat16_bits(float value) noexcept {
+    std::uint32_t f;
+    std::memcpy(&f, &value, sizeof(f));
+
+    // Truncating a NaN could turn it into infinity, so force it to be quiet
+    if ((f & 0x7fffffffu) > 0x7f800000u) {
+        return static_cast<std::uint16_t>((f >> 16) | 0x40u);
+    }
+
+    // Round to nearest even
+    return static_cast<std::uint16_t>((f + 0x7fffu + ((f >> 16) & 1u)) >> 16);
+}
+
+
+inline float bfloat16_bits_to_float(std::uint16_t h) noexcept {
+    const std::uint32_t f = static_cast<std::uint32_t>(h) << 16;
+
+    float value;
+    std::memcpy(&value, &f, sizeof(value));
+    return value;
+}
+
+
+inline void convert_n(const float* src, std::size_t n, half* dst) noexcept {
+    std::size_t i = 0;
+#if VT_NDARRAY_AVX512F
+    for (; i + 16 <= n; i += 16) {
+        const __m256i h = _mm512_maskz_cvtps_ph(
+            0xffff,
+            _mm512_loadu_ps(src + i),
+            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+        );
+        _mm256_storeu_si256(static_cast<__m256i*>(
+            static_cast<void*>(dst + i)
+        ), h);
+    }
+#endif
+#if VT_NDARRAY_F16C
+    for (; i + 8 <= n; i += 8) {
+        const __m128i h = _mm256_cvtps_ph(
+            _mm256_loadu_ps(src + i),
+            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+        );
+        _mm_storeu_si128(static_cast<__m128i*>(
+            static_cast<void*>(dst + i)
+        ), h);
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = half::from_bits(float_to_half_bits(src[i]));
+    }
+}
+
+
+inline void convert_n(const half* src, std::size_t n, float* dst) noexcept {
+    std::size_t i = 0;
+#if VT_NDARRAY_AVX512F
+    for (; i + 16 <= n; i += 16) {
+        const __m256i h = _mm256_loadu_si256(static_cast<const __m256i*>(
+            static_cast<const void*>(src + i)
+        ));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(h));
+    }
+#endif
+#if VT_NDARRAY_F16C
+    for (; i + 8 <= n; i += 8) {
+        const __m128i h = _mm_loadu_si128(static_cast<const __m128i*>(
+            static_cast<const void*>(src + i)
+        ));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = half_bits_to_float(src[i].bits());
+    }
+}
+
+
+// The bfloat16 conversions are plain integer arithmetic, which compilers
+// vectorize for any available instruction set.
+inline void convert_n(
+    const float* src,
+    std::size_t n,
+    bfloat16* dst
+) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = bfloat16::from_bits(float_to_bfloat16_bits(src[i]));
+    }
+}
+
+
+inline void convert_n(
+    const bfloat16* src,
+    std::size_t n,
+    float* dst
+) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = bfloat16_bits_to_float(src[i].bits());
+    }
+}
+
+
+// Elements are converted in blocks that fit in the L1 cache, and summed with
+// several independent accumulators so that the additions can be vectorized
+// without reassociating the whole reduction.
+inline constexpr std::size_t reduce_block_size = 512;
+inline constexpr std::size_t reduce_lanes = 16;
+
+
+template<typename T>
+float sum_n(const T* x, std::size_t n) noexcept {
+    alignas(64) float block[reduce_block_size];
+    float acc[reduce_lanes] = {};
+
+    for (std::size_t first = 0; first < n; first += reduce_block_size) {
+        const std::size_t count = std::min(reduce_block_size, n - first);
+        convert_n(x + first, count, block);
+
+        std::size_t i = 0;
+        for (; i + reduce_lanes <= count; i += reduce_lanes) {
+            for (std::size_t j = 0; j < reduce_lanes; ++j) {
+                acc[j] += block[i + j];
+            }
+        }
+        for (; i < count; ++i) {
+            acc[i % reduce_lanes] += block[i];
+        }
+    }
+
+    float total = 0.0f;
+    for (float a : acc) total += a;
+
+    return total;
+}
+
+
+template<typename T>
+float dot_n(const T* x, const T* y, std::size_t n) noexcept {
+    alignas(64) float block_x[reduce_block_size];
+    alignas(64) float block_y[reduce_block_size];
+    float acc[reduce_lanes] = {};
+
+    for (std::size_t first = 0; first < n; first += reduce_block_size) {
+        const std::size_t count = std::min(reduce_block_size, n - first);
+        convert_n(x + first, count, block_x);
+        convert_n(y + first, count, block_y);
+
+        std::size_t i = 0;
+        for (; i + reduce_lanes <= count; i += reduce_lanes) {
+            for (std::size_t j = 0; j < reduce_lanes; ++j) {
+                acc[j] += block_x[i + j] * block_y[i + j];
+            }
+        }
+        for (; i < count; ++i) {
+            acc[i % reduce_lanes] += block_x[i] * block_y[i];
+        }
+    }
+
+    float total = 0.0f;
+    for (float a : acc) total += a;
+
+    return total;
+}
+
+} // namespace detail
+
+
+inline half::half(float value) noexcept :
+    _bits{detail::float_to_half_bits(value)}
+{
+}
+
+
+inline half::operator float() const noexcept {
+    return detail::half_bits_to_float(_bits);
+}
+
+
+constexpr half half::from_bits(std::uint16_t bits_) noexcept {
+    half h{};
+    h._bits = bits_;
+    return h;
+}
+
+
+constexpr std::uint16_t half::bits() const noexcept {
+    return _bits;
+}
+
+
+inline bfloat16::bfloat16(float value) noexcept :
+    _bits{detail::float_to_bfloat16_bits(value)}
+{
+}
+
+
+inline bfloat16::operator float() const noexcept {
+    return detail::bfloat16_bits_to_float(_bits);
+}
+
+
+constexpr bfloat16 bfloat16::from_bits(std::uint16_t bits_) noexcept {
+    bfloat16 h{};
+    h._bits = bits_;
+    return h;
+}
+
+
+constexpr std::uint16_t bfloat16::bits() const noexcept {
+    return _bits;
+}
+
+
+static_assert(sizeof(half) == 2 && std::is_trivially_copyable_v<half>);
+static_assert(
+    sizeof(bfloat16) == 2 && std::is_trivially_copyable_v<bfloat16>
+);
+
+
+template<std::size_t N>
+void convert(
+    detail::nondeduced_t<ndview<const float, N>> src,
+    ndview<half, N> dst
+) noexcept {
+    assert(src.shape() == dst.shape());
+
+    detail::convert_n(src.data(), src.element_count(), dst.data());
+}
+
+
+template<std::size_t N>
+void convert(
+    detail::nondeduced_t<ndview<const half, N>> src,
+    ndview<float, N> dst
+) noexcept {
+    assert(src.shape() == dst.shape());
+
+    detail::convert_n(src.data(), src.element_count(), dst.data());
+}
+
+
+template<std::size_t N>
+void convert(
+    detail::nondeduced_t<ndview<const float, N>> src,
+    ndview<bfloat16, N> dst
+) noexcept {
+    assert(src.shape() == dst.shape());
+
+    detail::convert_n(src.data(), src.element_count(), dst.data());
+}
+
+
+template<std::size_t N>
+void convert(
+    detail::nondeduced_t<ndview<const bfloat16, N>> src,
+    ndview<float, N> dst
+) noexcept {
+    assert(src.shape() == dst.shape());
+
+    detail::convert_n(src.data(), src.element_count(), dst.data());
+}
+
+
+template<typename T, std::size_t N, typename>
+float sum(ndview<T, N> x) noexcept {
+    return detail::sum_n(x.data(), x.element_count());
+}
+
+
+template<typename T, std::size_t N, typename>
+float dot(
+    ndview<T, N> x,
+    detail::nondeduced_t<ndview<const T, N>> y
+) noexcept {
+    assert(x.shape() == y.shape());
+
+    return detail::dot_n(x.data(), y.data(), x.element_count());
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_FLOAT16_IPP_
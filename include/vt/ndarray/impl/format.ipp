@@ -0,0 +1,550 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_FORMAT_IPP_
+#define VT_NDARRAY_IMPL_FORMAT_IPP_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+
+namespace vt {
+
+namespace detail {
+
+template<typename T, std::size_t N>
+class text_parser {
+public:
+    explicit text_parser(std::string_view text) noexcept;
+
+    ndarray<T, N> parse();
+
+private:
+    std::string_view _text;
+    std::size_t _pos;
+    std::array<std::size_t, N> _shape;
+    std::array<bool, N> _known;
+    std::vector<T> _values;
+
+    [[noreturn]] void fail(const char* what) const;
+
+    char peek() noexcept;
+    void expect(char c);
+    void parse_array(std::size_t dim);
+    void parse_number();
+};
+
+
+template<typename T, std::size_t N>
+text_parser<T, N>::text_parser(std::string_view text) noexcept :
+    _text{text},
+    _pos{0},
+    _shape{},
+    _known{},
+    _values{}
+{
+}
+
+
+template<typename T, std::size_t N>
+ndarray<T, N> text_parser<T, N>::parse() {
+    this->parse_array(0);
+    if (this->peek() != '\0') this->fail("trailing characters");
+
+    return ndarray<T, N>{_shape, _values.begin(), _values.end()};
+}
+
+
+template<typename T, std::size_t N>
+void text_parser<T, N>::fail(const char* what) const {
+    throw std::invalid_argument{
+        std::string{"vt::parse_text: "} + what +
+        " at position " + std::to_string(_pos)
+    };
+}
+
+
+// Skips whitespace and returns the next character, or '\0' at the end
+template<typename T, std::size_t N>
+char text_parser<T, N>::peek() noexcept {
+    while (_pos < _text.size()) {
+        const char c = _text[_pos];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') return c;
+        ++_pos;
+    }
+
+    return '\0';
+}
+
+
+template<typename T, std::size_t N>
+void text_parser<T, N>::expect(char c) {
+    if (this->peek() != c) this->fail("unexpected character");
+    ++_pos;
+}
+
+
+template<typename T, std::size_t N>
+void text_parser<T, N>::parse_array(std::size_t dim) {
+    this->expect('[');
+
+    std::size_t n = 0;
+    if (this->peek() != ']') {
+        for (;;) {
+            if (dim + 1 == N) {
+                this->parse_number();
+            } else {
+                this->parse_array(dim + 1);
+            }
+            ++n;
+
+            if (this->peek() != ',') break;
+            ++_pos;
+        }
+    }
+
+    this->expect(']');
+
+    if (!_known[dim]) {
+        _known[dim] = true;
+        _shape[dim] = n;
+    } else if (_shape[dim] != n) {
+        this->fail("inconsistent dimension");
+    }
+}
+
+
+template<typename T, std::size_t N>
+void text_parser<T, N>::parse_number() {
+    this->peek();
+
+    std::size_t end = _pos;
+    while (
+        end < _text.size() &&
+        std::string_view{",] \t\n\r"}.find(_text[end]) == std::string_view::npos
+    ) {
+        ++end;
+    }
+
+    const char* first = _text.data() + _pos;
+    const char* last = _text.data() + end;
+    // from_chars does not accept a plus sign, while streams do
+    if (first != last && *first == '+') ++first;
+    if (first == last) this->fail("expected a number");
+
+    T value{};
+    bool ok;
+#if !defined(__cpp_lib_to_chars)
+    if constexpr (std::is_floating_point_v<T>) {
+        const std::string token{first, last};
+        char* token_end;
+        if constexpr (std::is_same_v<T, float>) {
+            value = std::strtof(token.c_str(), &token_end);
+        } else if constexpr (std::is_same_v<T, double>) {
+            value = std::strtod(token.c_str(), &token_end);
+        } else {
+            value = std::strtold(token.c_str(), &token_end);
+        }
+        ok = token_end == token.c_str() + token.size();
+    } else
+#endif
+    {
+        const std::from_chars_result result =
+            std::from_chars(first, last, value);
+        ok = result.ec == std::errc{} && result.ptr == last;
+    }
+    if (!ok) this->fail("invalid number");
+
+    _values.push_back(value);
+    _pos = end;
+}
+
+
+enum : unsigned char {
+    binary_version = 1
+};
+
+constexpr char binary_magic[4] = {'V', 'T', 'N', 'D'};
+constexpr std::size_t binary_fixed_header_size = 16;
+// Largest alignment, and so the largest padding after the header
+constexpr std::size_t binary_max_alignment = std::size_t{1} << 16;
+
+
+inline bool is_little_endian() noexcept {
+    const std::uint16_t one = 1;
+    unsigned char byte;
+    std::memcpy(&byte, &one, 1);
+
+    return byte == 1;
+}
+
+
+template<typename T>
+constexpr char binary_kind() noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        return 'f';
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        return 'i';
+    } else if constexpr (std::is_integral_v<T>) {
+        return 'u';
+    } else {
+        // Any other trivially copyable type, stored as raw bytes
+        return 'v';
+    }
+}
+
+
+inline void store_u64(unsigned char* p, std::uint64_t value) noexcept {
+    for (std::size_t i = 0; i < 8; ++i) {
+        p[i] = static_cast<unsigned char>(value >> (8 * i));
+    }
+}
+
+
+inline std::uint64_t load_u64(const unsigned char* p) noexcept {
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+        value |= std::uint64_t{p[i]} << (8 * i);
+    }
+
+    return value;
+}
+
+
+template<typename T>
+void swap_bytes(T* data, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        unsigned char* bytes = static_cast<unsigned char*>(
+            static_cast<void*>(data + i)
+        );
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+}
+
+
+// Header of the binary format, see write_binary, zero-padded up to a
+// multiple of alignment
+template<typename T, std::size_t N>
+std::vector<unsigned char> make_binary_header(
+    const std::array<std::size_t, N>& shape,
+    std::size_t alignment
+) {
+    static_assert(sizeof(T) <= 255 && N <= 255);
+
+    const std::size_t header_size = binary_fixed_header_size + 8 * N;
+    const std::size_t data_offset =
+        (header_size + alignment - 1) / alignment * alignment;
+
+    std::vector<unsigned char> header(data_offset, 0);
+    std::copy_n(binary_magic, 4, header.begin());
+    header[4] = binary_version;
+    header[5] = static_cast<unsigned char>(binary_kind<T>());
+    header[6] = static_cast<unsigned char>(sizeof(T));
+    header[7] = static_cast<unsigned char>(N);
+    store_u64(&header[8], data_offset);
+    for (std::size_t i = 0; i < N; ++i) {
+        store_u64(&header[16 + 8 * i], shape[i]);
+    }
+
+    return header;
+}
+
+
+// Checks the first binary_fixed_header_size bytes of a header and returns
+// the data offset
+template<typename T, std::size_t N>
+std::uint64_t check_binary_header(
+    const unsigned char* header,
+    const char* caller
+) {
+    const auto fail = [caller](const char* what) {
+        throw std::runtime_error{std::string{caller} + ": " + what};
+    };
+
+    if (!std::equal(header, header + 4, binary_magic)) {
+        fail("not an ndarray");
+    }
+    if (header[4] != binary_version) {
+        fail("unsupported version");
+    }
+    if (
+        header[5] != binary_kind<T>() ||
+        header[6] != sizeof(T) ||
+        header[7] != N
+    ) {
+        fail("element type or rank mismatch");
+    }
+
+    const std::uint64_t header_size = binary_fixed_header_size + 8 * N;
+    const std::uint64_t data_offset = load_u64(&header[8]);
+    if (
+        data_offset < header_size ||
+        data_offset - header_size >= binary_max_alignment
+    ) {
+        fail("invalid data offset");
+    }
+
+    return data_offset;
+}
+
+
+// Whether factor arrays of the given shape fit in memory, so that their
+// size in bytes can be computed without overflow
+template<typename T, std::size_t N>
+bool fits_in_memory(
+    const std::array<std::size_t, N>& shape,
+    std::size_t factor = 1
+) noexcept {
+    if (factor == 0) return true;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (shape[i] == 0) return true;
+    }
+
+    std::size_t count = factor;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T) /
+                shape[i]) {
+            return false;
+        }
+        count *= shape[i];
+    }
+
+    return true;
+}
+
+
+// Reads the shape that follows the fixed part of a header
+template<typename T, std::size_t N>
+std::array<std::size_t, N> load_binary_shape(
+    const unsigned char* p,
+    const char* caller
+) {
+    std::array<std::size_t, N> shape;
+    for (std::size_t i = 0; i < N; ++i) {
+        const std::uint64_t extent = load_u64(p + 8 * i);
+        if (extent > std::numeric_limits<std::size_t>::max()) {
+            throw std::runtime_error{std::string{caller} + ": too large"};
+        }
+        shape[i] = static_cast<std::size_t>(extent);
+    }
+
+    if (!fits_in_memory<T>(shape)) {
+        throw std::runtime_error{std::string{caller} + ": too large"};
+    }
+
+    return shape;
+}
+
+} // namespace detail
+
+
+template<typename T, std::size_t N>
+void write_text(
+    std::ostream& os,
+    ndview<T, N> a,
+    const format_options& options
+) {
+    using value_type = std::remove_cv_t<T>;
+
+    const bool summarize = a.element_count() > options.threshold;
+
+    if constexpr (detail::is_chars_formattable_v<value_type>) {
+        const detail::number_format fmt{
+            std::chars_format::general, options.precision
+        };
+        detail::buffered_text_sink sink{os, fmt};
+        detail::write_text(
+            sink, a.data(), a.shape(), summarize, options.edge_items
+        );
+    } else {
+        detail::stream_text_sink sink{os};
+        detail::write_text(
+            sink, a.data(), a.shape(), summarize, options.edge_items
+        );
+    }
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+void write_text(
+    std::ostream& os,
+    const ndarray<T, N, Allocator>& a,
+    const format_options& options
+) {
+    write_text(os, a.view(), options);
+}
+
+
+template<typename T, std::size_t N>
+std::string to_string(ndview<T, N> a, const format_options& options) {
+    std::ostringstream os;
+    write_text(os, a, options);
+
+    return os.str();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+std::string to_string(
+    const ndarray<T, N, Allocator>& a,
+    const format_options& options
+) {
+    return to_string(a.view(), options);
+}
+
+
+template<typename T, std::size_t N>
+ndarray<T, N> parse_text(std::string_view text) {
+    static_assert(
+        std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+        "vt::parse_text only supports numbers"
+    );
+
+    return detail::text_parser<T, N>{text}.parse();
+}
+
+
+template<typename T, std::size_t N>
+ndarray<T, N> read_text(std::istream& is) {
+    // Reads up to and including the closing bracket of the outer dimension
+    std::string text;
+    std::size_t depth = 0;
+    char c;
+    is >> std::ws;
+    while (is.get(c)) {
+        text.push_back(c);
+        if (c == '[') {
+            ++depth;
+        } else if (c == ']' && depth > 0 && --depth == 0) {
+            break;
+        } else if (depth == 0) {
+            break;
+        }
+    }
+
+    return parse_text<T, N>(text);
+}
+
+
+// Layout, with all header integers in little-endian byte order:
+//
+//   0   "VTND"
+//   4   version
+//   5   kind: 'i', 'u', 'f' or 'v' for raw bytes
+//   6   element size in bytes
+//   7   dimension count N
+//   8   offset of the data from the start of the header (uint64)
+//   16  shape (N x uint64)
+//
+// The header is zero-padded up to the data offset, which is a multiple of the
+// requested alignment. The elements follow in row-major, little-endian order.
+template<typename T, std::size_t N>
+void write_binary(
+    std::ostream& os,
+    ndview<T, N> a,
+    std::size_t alignment
+) {
+    using value_type = std::remove_cv_t<T>;
+    static_assert(std::is_trivially_copyable_v<value_type>);
+    static_assert(sizeof(value_type) <= 255 && N <= 255);
+    assert(alignment > 0 && alignment <= detail::binary_max_alignment);
+
+    const std::vector<unsigned char> header =
+        detail::make_binary_header<value_type, N>(a.shape(), alignment);
+
+    os.write(
+        static_cast<const char*>(static_cast<const void*>(header.data())),
+        static_cast<std::streamsize>(header.size())
+    );
+
+    if (sizeof(value_type) == 1 || detail::is_little_endian()) {
+        os.write(
+            static_cast<const char*>(static_cast<const void*>(a.data())),
+            static_cast<std::streamsize>(a.element_count() * sizeof(value_type))
+        );
+    } else {
+        for (const value_type& x : a) {
+            value_type swapped = x;
+            detail::swap_bytes(&swapped, 1);
+            os.write(
+                static_cast<const char*>(static_cast<const void*>(&swapped)),
+                sizeof(value_type)
+            );
+        }
+    }
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+void write_binary(
+    std::ostream& os,
+    const ndarray<T, N, Allocator>& a,
+    std::size_t alignment
+) {
+    write_binary(os, a.view(), alignment);
+}
+
+
+template<typename T, std::size_t N>
+ndarray<T, N> read_binary(std::istream& is) {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    const auto read = [&is](void* dst, std::size_t n) {
+        const auto count = static_cast<std::streamsize>(n);
+        if (!is.read(static_cast<char*>(dst), count)) {
+            throw std::runtime_error{"vt::read_binary: unexpected end of data"};
+        }
+    };
+
+    unsigned char header[detail::binary_fixed_header_size];
+    read(header, sizeof(header));
+    const std::uint64_t data_offset =
+        detail::check_binary_header<T, N>(header, "vt::read_binary");
+
+    std::vector<unsigned char> rest(
+        static_cast<std::size_t>(data_offset) - detail::binary_fixed_header_size
+    );
+    read(rest.data(), rest.size());
+
+    const std::array<std::size_t, N> shape =
+        detail::load_binary_shape<T, N>(rest.data(), "vt::read_binary");
+
+    ndarray<T, N> result{shape};
+    read(result.data(), result.element_count() * sizeof(T));
+    if (sizeof(T) > 1 && !detail::is_little_endian()) {
+        detail::swap_bytes(result.data(), result.element_count());
+    }
+
+    return result;
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_FORMAT_IPP_
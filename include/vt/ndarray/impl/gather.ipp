@@ -0,0 +1,638 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_GATHER_IPP_
+#define VT_NDARRAY_IMPL_GATHER_IPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/impl/config.ipp>
+#include <vt/ndarray/impl/parallel.ipp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if VT_NDARRAY_AVX2 || VT_NDARRAY_AVX512F
+#   include <immintrin.h>
+#endif
+
+
+namespace vt {
+
+namespace detail {
+
+template<typename Index>
+bool indices_in_range(
+    ndview<const Index, 1> indices,
+    std::size_t count
+) noexcept {
+    return std::all_of(indices.begin(), indices.end(), [count](Index idx) {
+        return idx >= Index{0} && to_size(idx) < count;
+    });
+}
+
+
+// Number of elements in one sub-array along the first dimension
+template<typename T, std::size_t N>
+std::size_t row_size(ndview<T, N> a) noexcept {
+    std::size_t size = 1;
+    for (std::size_t i = 1; i < N; ++i) {
+        size *= a.shape(i);
+    }
+
+    return size;
+}
+
+
+template<typename T, typename U, std::size_t N>
+bool same_row_shape(ndview<T, N> a, ndview<U, N> b) noexcept {
+    for (std::size_t i = 1; i < N; ++i) {
+        if (a.shape(i) != b.shape(i)) return false;
+    }
+
+    return true;
+}
+
+
+inline unsigned popcount(std::uint32_t x) noexcept {
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    x = (x + (x >> 4)) & 0x0f0f0f0fu;
+
+    return (x * 0x01010101u) >> 24;
+}
+
+
+// Elements are gathered and compressed with vector instructions when they can
+// be moved as 32- or 64-bit integers.
+template<typename T>
+constexpr bool simd_movable_v =
+    std::is_trivially_copyable_v<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+template<typename Index>
+constexpr bool simd_index_v =
+    std::is_integral_v<Index> && !std::is_same_v<Index, bool> &&
+    (sizeof(Index) == 4 || sizeof(Index) == 8);
+
+
+#if VT_NDARRAY_AVX2
+
+// Gathers whole vectors of elements and returns how many were processed. The
+// indices are sign-extended, so unsigned 32-bit indices are only passed when
+// they are known to be below 2^31. AVX-512 builds use these as well: the wider
+// gathers load no more elements per cycle.
+template<typename T, typename Index>
+std::size_t gather_simd(
+    const T* src,
+    const Index* indices,
+    T* dst,
+    std::size_t count
+) noexcept {
+    std::size_t i = 0;
+
+    const auto* src32 = reinterpret_cast<const int*>(src);
+    const auto* src64 = reinterpret_cast<const long long*>(src);
+
+    if constexpr (sizeof(T) == 4 && sizeof(Index) == 4) {
+        for (; i + 8 <= count; i += 8) {
+            const __m256i idx = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(indices + i)
+            );
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + i),
+                _mm256_i32gather_epi32(src32, idx, 4)
+            );
+        }
+    } else if constexpr (sizeof(T) == 4) {
+        for (; i + 4 <= count; i += 4) {
+            const __m256i idx = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(indices + i)
+            );
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dst + i),
+                _mm256_i64gather_epi32(src32, idx, 4)
+            );
+        }
+    } else if constexpr (sizeof(Index) == 4) {
+        for (; i + 4 <= count; i += 4) {
+            const __m128i idx = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(indices + i)
+            );
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + i),
+                _mm256_i32gather_epi64(src64, idx, 8)
+            );
+        }
+    } else {
+        for (; i + 4 <= count; i += 4) {
+            const __m256i idx = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(indices + i)
+            );
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + i),
+                _mm256_i64gather_epi64(src64, idx, 8)
+            );
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+
+// dst[i] = src[indices[i]] for single elements
+template<typename T, typename Index>
+void gather_elements(
+    const T* src,
+    std::size_t src_count,
+    const Index* indices,
+    T* dst,
+    std::size_t count
+) noexcept {
+    std::size_t i = 0;
+
+#if VT_NDARRAY_AVX2
+    if constexpr (simd_movable_v<T> && simd_index_v<Index>) {
+        constexpr auto max_index =
+            static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+        if (std::is_signed_v<Index> || sizeof(Index) == 8 ||
+                src_count <= max_index) {
+            i = gather_simd(src, indices, dst, count);
+        }
+    }
+#else
+    (void)src_count;
+#endif
+
+    for (; i < count; ++i) {
+        dst[i] = src[to_size(indices[i])];
+    }
+}
+
+
+#if VT_NDARRAY_AVX2 && !VT_NDARRAY_AVX512F
+
+// Permutations for _mm256_permutevar8x32_epi32 that move the selected lanes
+// of a vector to the front, packed as eight 4-bit lane indices per mask
+template<std::size_t Lanes>
+struct compress_permutations {
+    std::uint32_t table[std::size_t{1} << Lanes];
+
+    constexpr compress_permutations() noexcept : table{} {
+        constexpr std::size_t width = 8 / Lanes;
+
+        for (std::size_t mask = 0; mask < (std::size_t{1} << Lanes); ++mask) {
+            std::size_t pos = 0;
+            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                if (((mask >> lane) & 1) == 0) continue;
+
+                for (std::size_t w = 0; w < width; ++w) {
+                    const auto slot = static_cast<std::uint32_t>(
+                        lane * width + w
+                    );
+                    table[mask] |= slot << (4 * pos);
+                    ++pos;
+                }
+            }
+        }
+    }
+};
+
+template<std::size_t Lanes>
+inline constexpr compress_permutations<Lanes> compress_permutations_v{};
+
+#endif
+
+
+#if VT_NDARRAY_AVX512F || VT_NDARRAY_AVX2
+
+// Compresses whole vectors of elements to dst + out, advancing out, and
+// returns how many source elements were processed
+template<typename T>
+std::size_t compress_simd(
+    const T* src,
+    const bool* mask,
+    std::size_t count,
+    T* dst,
+    std::size_t& out
+) noexcept {
+    static_assert(sizeof(bool) == 1);
+
+    std::size_t i = 0;
+
+#if VT_NDARRAY_AVX512F
+    if constexpr (sizeof(T) == 4) {
+        for (; i + 16 <= count; i += 16) {
+            const __m512i m = _mm512_cvtepu8_epi32(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + i))
+            );
+            const __mmask16 k = _mm512_test_epi32_mask(m, m);
+            _mm512_mask_compressstoreu_epi32(
+                dst + out, k, _mm512_loadu_si512(src + i)
+            );
+            out += popcount(k);
+        }
+    } else {
+        for (; i + 8 <= count; i += 8) {
+            const __m512i m = _mm512_cvtepu8_epi64(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask + i))
+            );
+            const __mmask8 k = _mm512_test_epi64_mask(m, m);
+            _mm512_mask_compressstoreu_epi64(
+                dst + out, k, _mm512_loadu_si512(src + i)
+            );
+            out += popcount(k);
+        }
+    }
+#else
+    // AVX2 has no compressing store: the selected lanes are permuted to the
+    // front and written with a masked store.
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    const auto& permutations = compress_permutations_v<lanes>.table;
+
+    const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    const __m256i slots = lanes == 8 ?
+        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) :
+        _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+
+    for (; i + lanes <= count; i += lanes) {
+        std::uint32_t bits;
+        if constexpr (lanes == 8) {
+            const __m128i m =
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask + i));
+            const int zero_bits =
+                _mm_movemask_epi8(_mm_cmpeq_epi8(m, _mm_setzero_si128()));
+            bits = ~static_cast<std::uint32_t>(zero_bits) & 0xffu;
+        } else {
+            std::int32_t m;
+            std::memcpy(&m, mask + i, sizeof(m));
+            const int zero_bits = _mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_cvtsi32_si128(m), _mm_setzero_si128())
+            );
+            bits = ~static_cast<std::uint32_t>(zero_bits) & 0xfu;
+        }
+
+        const __m256i permutation = _mm256_srlv_epi32(
+            _mm256_set1_epi32(static_cast<int>(permutations[bits])), shifts
+        );
+        const __m256i packed = _mm256_permutevar8x32_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)),
+            permutation
+        );
+
+        const unsigned selected = popcount(bits);
+        const __m256i store_mask = _mm256_cmpgt_epi32(
+            _mm256_set1_epi32(static_cast<int>(selected)), slots
+        );
+        _mm256_maskstore_epi32(
+            reinterpret_cast<int*>(dst + out), store_mask, packed
+        );
+        out += selected;
+    }
+#endif
+
+    return i;
+}
+
+#endif
+
+
+template<typename T>
+std::size_t compress_elements(
+    const T* src,
+    const bool* mask,
+    std::size_t count,
+    T* dst
+) noexcept {
+    std::size_t i = 0;
+    std::size_t out = 0;
+
+#if VT_NDARRAY_AVX512F || VT_NDARRAY_AVX2
+    if constexpr (simd_movable_v<T>) {
+        i = compress_simd(src, mask, count, dst, out);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (mask[i]) {
+            dst[out] = src[i];
+            ++out;
+        }
+    }
+
+    return out;
+}
+
+
+template<scatter_op Op, typename T>
+void scatter_combine(T& dst, const T& src) {
+    if constexpr (Op == scatter_op::assign) {
+        dst = src;
+    } else if constexpr (Op == scatter_op::add) {
+        dst += src;
+    } else if constexpr (Op == scatter_op::min) {
+        if (src < dst) dst = src;
+    } else {
+        if (dst < src) dst = src;
+    }
+}
+
+
+// Scatters the source rows [first, last) to the destination rows that fall
+// in [dst_first, dst_last); other rows are skipped.
+template<scatter_op Op, typename T, typename Index>
+void scatter_rows(
+    const T* src,
+    const Index* indices,
+    std::size_t first,
+    std::size_t last,
+    T* dst,
+    std::size_t dst_first,
+    std::size_t dst_last,
+    std::size_t row
+) {
+    for (std::size_t i = first; i < last; ++i) {
+        const std::size_t j = to_size(indices[i]);
+        if (j < dst_first || j >= dst_last) continue;
+
+        for (std::size_t k = 0; k < row; ++k) {
+            scatter_combine<Op>(dst[j * row + k], src[i * row + k]);
+        }
+    }
+}
+
+
+template<scatter_op Op, typename T, typename Index, std::size_t N>
+void scatter(
+    ndview<const T, N> src,
+    ndview<const Index, 1> indices,
+    ndview<T, N> dst,
+    std::size_t thread_count
+) {
+    const std::size_t n = src.shape(0);
+    const std::size_t dst_rows = dst.shape(0);
+    const std::size_t row = row_size(dst);
+
+    const std::size_t part_count =
+        std::min(resolve_thread_count(thread_count), n);
+
+    if (part_count <= 1) {
+        scatter_rows<Op>(
+            src.data(), indices.data(), 0, n, dst.data(), 0, dst_rows, row
+        );
+        return;
+    }
+
+    // With a destination that is at most as large as the source, every
+    // thread scatters its part of the source to a private copy, and the
+    // copies are combined afterwards. Otherwise, every thread scans all
+    // indices and only writes the destination rows that it owns, which also
+    // keeps the order of assignments to the same row.
+    if (Op == scatter_op::assign || dst.element_count() > src.element_count()) {
+        parallel_for(dst_rows, part_count, [&](std::size_t lo, std::size_t hi) {
+            scatter_rows<Op>(
+                src.data(), indices.data(), 0, n, dst.data(), lo, hi, row
+            );
+        });
+        return;
+    }
+
+    const std::size_t dst_count = dst.element_count();
+    ndarray<T, 2> partial{{ part_count, dst_count }};
+
+    parallel_invoke(part_count, [&](std::size_t part) {
+        T* partial_dst = partial[part].data();
+        if constexpr (Op == scatter_op::add) {
+            std::fill_n(partial_dst, dst_count, T{});
+        } else {
+            std::copy_n(dst.data(), dst_count, partial_dst);
+        }
+
+        scatter_rows<Op>(
+            src.data(), indices.data(),
+            n * part / part_count, n * (part + 1) / part_count,
+            partial_dst, 0, dst_rows, row
+        );
+    });
+
+    parallel_for(dst_count, part_count, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t part = 0; part < part_count; ++part) {
+            const T* partial_dst = partial[part].data();
+            for (std::size_t k = lo; k < hi; ++k) {
+                scatter_combine<Op>(dst.data()[k], partial_dst[k]);
+            }
+        }
+    });
+}
+
+} // namespace detail
+
+
+template<typename T, typename Index, std::size_t N>
+void gather(
+    detail::nondeduced_t<ndview<const T, N>> src,
+    detail::nondeduced_t<ndview<const Index, 1>> indices,
+    ndview<T, N> dst,
+    std::size_t thread_count
+) {
+    assert(indices.shape(0) == dst.shape(0));
+    assert(detail::same_row_shape(src, dst));
+    assert(detail::indices_in_range(indices, src.shape(0)));
+
+    const std::size_t row = detail::row_size(dst);
+
+    detail::parallel_for(
+        dst.shape(0), thread_count,
+        [&](std::size_t first, std::size_t last) {
+            if (row == 1) {
+                detail::gather_elements(
+                    src.data(), src.shape(0),
+                    indices.data() + first, dst.data() + first, last - first
+                );
+                return;
+            }
+
+            for (std::size_t i = first; i < last; ++i) {
+                std::copy_n(
+                    src.data() + detail::to_size(indices[i]) * row, row,
+                    dst.data() + i * row
+                );
+            }
+        }
+    );
+}
+
+
+template<typename T, typename Index, std::size_t N>
+void scatter(
+    detail::nondeduced_t<ndview<const T, N>> src,
+    detail::nondeduced_t<ndview<const Index, 1>> indices,
+    ndview<T, N> dst,
+    scatter_op op,
+    std::size_t thread_count
+) {
+    assert(indices.shape(0) == src.shape(0));
+    assert(detail::same_row_shape(src, dst));
+    assert(detail::indices_in_range(indices, dst.shape(0)));
+
+    switch (op) {
+    case scatter_op::assign:
+        detail::scatter<scatter_op::assign>(src, indices, dst, thread_count);
+        break;
+    case scatter_op::add:
+        detail::scatter<scatter_op::add>(src, indices, dst, thread_count);
+        break;
+    case scatter_op::min:
+        detail::scatter<scatter_op::min>(src, indices, dst, thread_count);
+        break;
+    case scatter_op::max:
+        detail::scatter<scatter_op::max>(src, indices, dst, thread_count);
+        break;
+    }
+}
+
+
+template<typename T, typename Index, std::size_t N>
+void take_along_axis(
+    detail::nondeduced_t<ndview<const T, N>> src,
+    detail::nondeduced_t<ndview<const Index, N>> indices,
+    ndview<T, N> dst,
+    std::size_t axis,
+    std::size_t thread_count
+) {
+    assert(axis < N);
+    assert(indices.shape() == dst.shape());
+
+    std::size_t outer = 1;
+    std::size_t inner = 1;
+    for (std::size_t i = 0; i < N; ++i) {
+        assert(i == axis || src.shape(i) == dst.shape(i));
+
+        if (i < axis) outer *= dst.shape(i);
+        if (i > axis) inner *= dst.shape(i);
+    }
+
+    const std::size_t length = dst.shape(axis);
+    const std::size_t src_length = src.shape(axis);
+
+    assert(std::all_of(
+        indices.begin(), indices.end(), [src_length](Index idx) {
+            return idx >= Index{0} && detail::to_size(idx) < src_length;
+        }
+    ));
+
+    // Every (outer, axis) position is one row of `inner` elements
+    detail::parallel_for(
+        outer * length, thread_count,
+        [&](std::size_t first, std::size_t last) {
+            const T* s = src.data();
+            const Index* idx = indices.data();
+            T* d = dst.data();
+
+            if (inner == 1) {
+                // Gathers along the last axis, one outer row at a time
+                while (first < last) {
+                    const std::size_t o = first / length;
+                    const std::size_t end = std::min(last, (o + 1) * length);
+
+                    detail::gather_elements(
+                        s + o * src_length, src_length,
+                        idx + first, d + first, end - first
+                    );
+                    first = end;
+                }
+                return;
+            }
+
+            for (std::size_t r = first; r < last; ++r) {
+                const T* src_row = s + r / length * src_length * inner;
+                for (std::size_t k = 0; k < inner; ++k) {
+                    const std::size_t j = detail::to_size(idx[r * inner + k]);
+                    d[r * inner + k] = src_row[j * inner + k];
+                }
+            }
+        }
+    );
+}
+
+
+template<typename T>
+std::size_t compress(
+    detail::nondeduced_t<ndview<const T, 1>> src,
+    ndview<const bool, 1> mask,
+    ndview<T, 1> dst,
+    std::size_t thread_count
+) {
+    assert(mask.shape(0) == src.shape(0));
+    assert(
+        dst.shape(0) >= static_cast<std::size_t>(
+            std::count(mask.begin(), mask.end(), true)
+        )
+    );
+
+    const std::size_t n = src.shape(0);
+    const std::size_t part_count =
+        std::min(detail::resolve_thread_count(thread_count), n);
+
+    if (part_count <= 1) {
+        return detail::compress_elements(
+            src.data(), mask.data(), n, dst.data()
+        );
+    }
+
+    // Counts the selected elements of every part first, so that all parts
+    // can be written concurrently to their final position.
+    std::vector<std::size_t> offsets(part_count + 1, 0);
+    detail::parallel_invoke(part_count, [&](std::size_t part) {
+        const bool* first = mask.data() + n * part / part_count;
+        const bool* last = mask.data() + n * (part + 1) / part_count;
+
+        std::size_t count = 0;
+        for (const bool* m = first; m != last; ++m) {
+            count += *m ? 1 : 0;
+        }
+        offsets[part + 1] = count;
+    });
+
+    for (std::size_t part = 0; part < part_count; ++part) {
+        offsets[part + 1] += offsets[part];
+    }
+
+    detail::parallel_invoke(part_count, [&](std::size_t part) {
+        const std::size_t first = n * part / part_count;
+        const std::size_t last = n * (part + 1) / part_count;
+
+        detail::compress_elements(
+            src.data() + first, mask.data() + first, last - first,
+            dst.data() + offsets[part]
+        );
+    });
+
+    return offsets[part_count];
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_GATHER_IPP_
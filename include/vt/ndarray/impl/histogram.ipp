@@ -0,0 +1,396 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_HISTOGRAM_IPP_
+#define VT_NDARRAY_IMPL_HISTOGRAM_IPP_
+
+#include <vt/ndarray/impl/parallel.ipp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+namespace vt {
+
+namespace detail {
+
+// Number of sub-histograms per thread. Consecutive elements are counted in
+// different sub-histograms, so that runs of equal bins do not wait for the
+// previous increment of the same counter.
+constexpr std::size_t histogram_lanes = 4;
+
+// Number of elements whose bins are computed at once, in a loop that the
+// compiler can vectorize, before they are counted
+constexpr std::size_t histogram_block = 256;
+
+
+template<typename T>
+using histogram_real_t =
+    std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+
+template<typename To, typename From>
+constexpr To histogram_cast(From x) noexcept {
+    if constexpr (std::is_same_v<To, From>) {
+        return x;
+    } else {
+        return static_cast<To>(x);
+    }
+}
+
+
+// Stores the bin of each value in out, with bins.bin_count() for values
+// outside all bins.
+template<typename T>
+void compute_bins(
+    const histogram_bins<T>& bins,
+    const T* values,
+    std::size_t count,
+    std::uint32_t* out
+) noexcept {
+    const std::size_t bin_count = bins.bin_count();
+
+    if (!bins.is_uniform()) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<std::uint32_t>(bins.bin(values[i]));
+        }
+        return;
+    }
+
+    using real = histogram_real_t<T>;
+    const T* edges = bins.edges().data();
+    const T low = edges[0];
+    const T high = edges[bin_count];
+    const auto offset = histogram_cast<real>(low);
+    const real scale = static_cast<real>(bin_count) /
+        (histogram_cast<real>(high) - offset);
+    const auto last = static_cast<std::int32_t>(bin_count - 1);
+    const auto outside = static_cast<std::uint32_t>(bin_count);
+
+    const auto bin_values = [&](auto size) {
+        for (std::size_t i = 0; i < size; ++i) {
+            const T x = values[i];
+            const bool inside = x >= low && x <= high;
+            const real pos =
+                inside ? (histogram_cast<real>(x) - offset) * scale : real{0};
+            const std::int32_t b =
+                std::min(static_cast<std::int32_t>(pos), last);
+            out[i] = inside ? static_cast<std::uint32_t>(b) : outside;
+        }
+    };
+
+    // A constant trip count lets the compiler vectorize full blocks
+    if (count == histogram_block) {
+        bin_values(std::integral_constant<std::size_t, histogram_block>{});
+    } else {
+        bin_values(count);
+    }
+
+    // Near an edge, the multiplication can put a value in the neighbouring
+    // bin. As numpy does, bins are corrected against the stored edges, so
+    // that every value lands in the same bin as with a search.
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint32_t b = out[i];
+        if (b == outside) continue;
+
+        const T x = values[i];
+        if (x < edges[b]) {
+            out[i] = b - 1;
+        } else if (b != static_cast<std::uint32_t>(last) &&
+                x >= edges[b + 1]) {
+            out[i] = b + 1;
+        }
+    }
+}
+
+
+// Counts n elements in bin_count bins, using per-thread and per-lane
+// sub-histograms that are summed at the end. bin_block(first, count, out)
+// stores the bins of elements [first, first + count) in out. Without
+// weights, every element counts as one.
+template<typename C, typename F>
+ndarray<C, 1> fill_histogram(
+    std::size_t n,
+    std::size_t bin_count,
+    const C* weights,
+    std::size_t thread_count,
+    const F& bin_block
+) {
+    // One extra slot collects the elements outside all bins
+    const std::size_t slots = bin_count + 1;
+    const std::size_t lanes =
+        histogram_lanes * slots * sizeof(C) <=
+            cpu_topology::get().l1d_cache_size / 2 ?
+        histogram_lanes : 1;
+    const std::size_t part_count = std::max<std::size_t>(
+        std::min(resolve_thread_count(thread_count), n), 1
+    );
+
+    ndarray<C, 2> partial({ part_count * lanes, slots }, C{});
+
+    parallel_invoke(part_count, [&](std::size_t part) {
+        C* sub = partial[part * lanes].data();
+        const std::size_t end = n * (part + 1) / part_count;
+        std::uint32_t bins[histogram_block];
+
+        for (std::size_t first = n * part / part_count; first < end;
+                first += histogram_block) {
+            const std::size_t count = std::min(histogram_block, end - first);
+            bin_block(first, count, bins);
+
+            const C* w = weights != nullptr ? weights + first : nullptr;
+            std::size_t i = 0;
+            if (lanes == histogram_lanes) {
+                for (; i + 4 <= count; i += 4) {
+                    sub[bins[i]] += w != nullptr ? w[i] : C{1};
+                    sub[slots + bins[i + 1]] += w != nullptr ? w[i + 1] : C{1};
+                    sub[2 * slots + bins[i + 2]] +=
+                        w != nullptr ? w[i + 2] : C{1};
+                    sub[3 * slots + bins[i + 3]] +=
+                        w != nullptr ? w[i + 3] : C{1};
+                }
+            }
+            for (; i < count; ++i) {
+                sub[bins[i]] += w != nullptr ? w[i] : C{1};
+            }
+        }
+    });
+
+    ndarray<C, 1> result(std::array<std::size_t, 1>{ bin_count });
+    parallel_for(bin_count, part_count, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            C sum{};
+            for (std::size_t row = 0; row < part_count * lanes; ++row) {
+                sum += partial[row][b];
+            }
+            result[b] = sum;
+        }
+    });
+
+    return result;
+}
+
+
+template<typename T, typename C, std::size_t N>
+ndarray<C, 1> histogram(
+    ndview<const T, N> data,
+    const C* weights,
+    const histogram_bins<T>& bins,
+    std::size_t thread_count
+) {
+    const T* values = data.data();
+
+    return fill_histogram<C>(
+        data.element_count(), bins.bin_count(), weights, thread_count,
+        [&](std::size_t first, std::size_t count, std::uint32_t* out) {
+            compute_bins(bins, values + first, count, out);
+        }
+    );
+}
+
+
+template<typename T, typename C, std::size_t N>
+ndarray<C, 2> histogram2d(
+    ndview<const T, N> x,
+    ndview<const T, N> y,
+    const C* weights,
+    const histogram_bins<T>& x_bins,
+    const histogram_bins<T>& y_bins,
+    std::size_t thread_count
+) {
+    assert(x.shape() == y.shape());
+
+    const std::size_t nx = x_bins.bin_count();
+    const std::size_t ny = y_bins.bin_count();
+    assert(nx * ny < std::numeric_limits<std::uint32_t>::max());
+
+    const auto outside = static_cast<std::uint32_t>(nx * ny);
+    const auto x_outside = static_cast<std::uint32_t>(nx);
+    const auto y_outside = static_cast<std::uint32_t>(ny);
+    const auto y_count = static_cast<std::uint32_t>(ny);
+
+    ndarray<C, 1> counts = fill_histogram<C>(
+        x.element_count(), nx * ny, weights, thread_count,
+        [&](std::size_t first, std::size_t count, std::uint32_t* out) {
+            std::uint32_t y_out[histogram_block];
+            compute_bins(x_bins, x.data() + first, count, out);
+            compute_bins(y_bins, y.data() + first, count, y_out);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                const bool inside =
+                    out[i] != x_outside && y_out[i] != y_outside;
+                out[i] = inside ? out[i] * y_count + y_out[i] : outside;
+            }
+        }
+    );
+
+    return ndarray<C, 2>({ nx, ny }, counts.begin(), counts.end());
+}
+
+} // namespace detail
+
+
+template<typename T>
+histogram_bins<T>::histogram_bins(std::size_t bin_count, T low, T high) :
+    _edges(std::array<std::size_t, 1>{ bin_count + 1 }),
+    _uniform{true}
+{
+    assert(bin_count > 0);
+    assert(bin_count <
+        static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()));
+    assert(low < high);
+
+    using real = detail::histogram_real_t<T>;
+    const auto offset = detail::histogram_cast<real>(low);
+    const real width = (detail::histogram_cast<real>(high) - offset) /
+        static_cast<real>(bin_count);
+    for (std::size_t i = 0; i < bin_count; ++i) {
+        _edges[i] = detail::histogram_cast<T>(
+            offset + static_cast<real>(i) * width
+        );
+    }
+    _edges[bin_count] = high;
+
+    // Rounded integer edges are no longer equally spaced
+    if constexpr (std::is_integral_v<T>) {
+        _uniform = static_cast<std::size_t>(high - low) % bin_count == 0;
+    }
+}
+
+
+template<typename T>
+histogram_bins<T>::histogram_bins(ndview<const T, 1> edges_) :
+    _edges{edges_.shape(), edges_.begin(), edges_.end()},
+    _uniform{false}
+{
+    assert(edges_.shape(0) >= 2);
+    assert(edges_.shape(0) - 1 <
+        static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()));
+    assert(std::adjacent_find(
+        edges_.begin(), edges_.end(), [](const T& a, const T& b) {
+            return !(a < b);
+        }
+    ) == edges_.end());
+}
+
+
+template<typename T>
+std::size_t histogram_bins<T>::bin_count() const noexcept {
+    return _edges.shape(0) - 1;
+}
+
+
+template<typename T>
+ndview<const T, 1> histogram_bins<T>::edges() const noexcept {
+    return _edges;
+}
+
+
+template<typename T>
+bool histogram_bins<T>::is_uniform() const noexcept {
+    return _uniform;
+}
+
+
+template<typename T>
+std::size_t histogram_bins<T>::bin(T value) const noexcept {
+    const std::size_t bin_count = this->bin_count();
+    const T* first = _edges.data();
+    const T* last = first + bin_count;
+
+    if (!(value >= *first && value <= *last)) return bin_count;
+
+    if (_uniform) {
+        std::uint32_t b;
+        detail::compute_bins(*this, &value, 1, &b);
+        return b;
+    }
+
+    // The last bin includes its upper edge
+    const T* upper = std::upper_bound(first + 1, last, value);
+
+    return static_cast<std::size_t>(upper - first) - 1;
+}
+
+
+template<typename T, std::size_t N>
+ndarray<std::size_t, 1> histogram(
+    ndview<const T, N> data,
+    const histogram_bins<T>& bins,
+    std::size_t thread_count
+) {
+    return detail::histogram<T, std::size_t>(
+        data, nullptr, bins, thread_count
+    );
+}
+
+
+template<typename T, typename W, std::size_t N>
+ndarray<W, 1> histogram(
+    ndview<const T, N> data,
+    ndview<const W, N> weights,
+    const histogram_bins<T>& bins,
+    std::size_t thread_count
+) {
+    assert(weights.shape() == data.shape());
+
+    return detail::histogram<T, W>(
+        data, weights.data(), bins, thread_count
+    );
+}
+
+
+template<typename T, std::size_t N>
+ndarray<std::size_t, 2> histogram2d(
+    ndview<const T, N> x,
+    ndview<const T, N> y,
+    const histogram_bins<T>& x_bins,
+    const histogram_bins<T>& y_bins,
+    std::size_t thread_count
+) {
+    return detail::histogram2d<T, std::size_t>(
+        x, y, nullptr, x_bins, y_bins, thread_count
+    );
+}
+
+
+template<typename T, typename W, std::size_t N>
+ndarray<W, 2> histogram2d(
+    ndview<const T, N> x,
+    ndview<const T, N> y,
+    ndview<const W, N> weights,
+    const histogram_bins<T>& x_bins,
+    const histogram_bins<T>& y_bins,
+    std::size_t thread_count
+) {
+    assert(weights.shape() == x.shape());
+
+    return detail::histogram2d<T, W>(
+        x, y, weights.data(), x_bins, y_bins, thread_count
+    );
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_HISTOGRAM_IPP_
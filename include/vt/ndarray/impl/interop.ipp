@@ -0,0 +1,451 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_INTEROP_IPP_
+#define VT_NDARRAY_IMPL_INTEROP_IPP_
+
+#include <vt/ndarray/float16.hpp>
+#include <vt/ndarray/format.hpp>
+
+#include <cassert>
+#include <complex>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+
+namespace vt {
+
+namespace detail {
+
+template<typename T>
+struct dependent_false : std::false_type {};
+
+
+template<typename T>
+constexpr DLDataType dlpack_dtype() noexcept {
+    using U = std::remove_cv_t<T>;
+    constexpr auto bits = static_cast<std::uint8_t>(8 * sizeof(U));
+
+    if constexpr (std::is_same_v<U, bool>) {
+        return { static_cast<std::uint8_t>(kDLBool), 8, 1 };
+    } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+        return { static_cast<std::uint8_t>(kDLInt), bits, 1 };
+    } else if constexpr (std::is_integral_v<U>) {
+        return { static_cast<std::uint8_t>(kDLUInt), bits, 1 };
+    } else if constexpr (std::is_floating_point_v<U> ||
+            std::is_same_v<U, half>) {
+        return { static_cast<std::uint8_t>(kDLFloat), bits, 1 };
+    } else if constexpr (std::is_same_v<U, bfloat16>) {
+        return { static_cast<std::uint8_t>(kDLBfloat), bits, 1 };
+    } else if constexpr (std::is_same_v<U, std::complex<float>> ||
+            std::is_same_v<U, std::complex<double>>) {
+        return { static_cast<std::uint8_t>(kDLComplex), bits, 1 };
+    } else {
+        static_assert(dependent_false<T>::value, "no DLPack data type");
+    }
+}
+
+
+template<typename T, std::size_t N>
+std::array<std::size_t, N> dlpack_shape(const DLTensor& tensor) noexcept {
+    std::array<std::size_t, N> shape{};
+    for (std::size_t i = 0; i < N; ++i) {
+        shape[i] = static_cast<std::size_t>(tensor.shape[i]);
+    }
+
+    return shape;
+}
+
+
+// Returns why the tensor cannot be viewed as ndview<T, N>, or null
+template<typename T, std::size_t N>
+const char* dlpack_error(const DLTensor& tensor) noexcept {
+    const DLDeviceType device = tensor.device.device_type;
+    if (device != kDLCPU && device != kDLCUDAHost &&
+            device != kDLROCMHost && device != kDLCUDAManaged) {
+        return "memory is not accessible from the host";
+    }
+
+    constexpr DLDataType dtype = dlpack_dtype<T>();
+    if (tensor.ndim != static_cast<std::int32_t>(N) ||
+            tensor.dtype.code != dtype.code ||
+            tensor.dtype.bits != dtype.bits ||
+            tensor.dtype.lanes != dtype.lanes) {
+        return "element type or rank mismatch";
+    }
+
+    for (std::size_t i = 0; i < N; ++i) {
+        if (tensor.shape[i] < 0) return "negative extent";
+    }
+
+    // Strides of dimensions of extent one are irrelevant, and so are all
+    // strides of an empty tensor.
+    if (tensor.strides != nullptr) {
+        const std::array<std::size_t, N> shape = dlpack_shape<T, N>(tensor);
+        if (count_elements(shape) > 0) {
+            std::int64_t stride = 1;
+            for (std::size_t i = N; i-- > 0;) {
+                if (shape[i] != 1 && tensor.strides[i] != stride) {
+                    return "elements are not contiguous in row-major order";
+                }
+                stride *= tensor.shape[i];
+            }
+        }
+    }
+
+    const std::uintptr_t address =
+        reinterpret_cast<std::uintptr_t>(tensor.data) + tensor.byte_offset;
+    if (address % alignof(T) != 0) return "misaligned data";
+
+    return nullptr;
+}
+
+
+// Validates the tensor, destroying it if it cannot be viewed
+template<typename T, std::size_t N>
+ndview<T, N> dlpack_view(DLManagedTensor* tensor) {
+    assert(tensor != nullptr);
+
+    const DLTensor& t = tensor->dl_tensor;
+    const char* error = dlpack_error<T, N>(t);
+    if (error != nullptr) {
+        if (tensor->deleter != nullptr) tensor->deleter(tensor);
+        throw std::invalid_argument{std::string{"vt::dlpack_tensor: "} + error};
+    }
+
+    void* data = static_cast<char*>(t.data) + t.byte_offset;
+
+    return { dlpack_shape<T, N>(t), static_cast<T*>(data) };
+}
+
+
+// Keeps the exported array and the shape and strides that the tensor points
+// to alive until the consumer calls the deleter
+template<typename T, std::size_t N, typename Allocator>
+struct dlpack_context {
+    ndarray<T, N, Allocator> array;
+    std::array<std::int64_t, N> shape;
+    std::array<std::int64_t, N> strides;
+    DLManagedTensor tensor;
+};
+
+
+struct buffer_type {
+    char kind;
+    std::size_t size;
+};
+
+
+template<typename T>
+constexpr buffer_type buffer_type_of() noexcept {
+    if constexpr (std::is_same_v<T, bool>) {
+        return { '?', 1 };
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        return { 'i', sizeof(T) };
+    } else if constexpr (std::is_integral_v<T>) {
+        return { 'u', sizeof(T) };
+    } else if constexpr (std::is_floating_point_v<T> ||
+            std::is_same_v<T, half>) {
+        return { 'f', sizeof(T) };
+    } else if constexpr (std::is_same_v<T, std::complex<float>> ||
+            std::is_same_v<T, std::complex<double>>) {
+        return { 'c', sizeof(T) };
+    } else {
+        static_assert(dependent_false<T>::value, "no buffer format");
+    }
+}
+
+
+// Format string of the struct module for the type
+template<typename T>
+constexpr const char* buffer_format() noexcept {
+    constexpr buffer_type type = buffer_type_of<T>();
+
+    switch (type.kind) {
+    case '?': return "?";
+    case 'i':
+        return type.size == 1 ? "b" : type.size == 2 ? "h" :
+            type.size == 4 ? "i" : "q";
+    case 'u':
+        return type.size == 1 ? "B" : type.size == 2 ? "H" :
+            type.size == 4 ? "I" : "Q";
+    case 'f':
+        return type.size == 2 ? "e" : type.size == 4 ? "f" : "d";
+    default:
+        return type.size == 8 ? "Zf" : "Zd";
+    }
+}
+
+
+// Parses a format string of the struct module with a single element.
+// Returns a type of size 0 for unsupported formats.
+inline buffer_type parse_buffer_format(const char* format) noexcept {
+    // A missing format means unsigned bytes
+    if (format == nullptr) return { 'u', 1 };
+
+    // Native sizes apply without a prefix and with '@'; the other prefixes
+    // select standard sizes in a byte order that must be native.
+    bool native = true;
+    switch (*format) {
+    case '@':
+        ++format;
+        break;
+    case '=':
+        native = false;
+        ++format;
+        break;
+    case '<':
+        if (!is_little_endian()) return { 0, 0 };
+        native = false;
+        ++format;
+        break;
+    case '>':
+    case '!':
+        if (is_little_endian()) return { 0, 0 };
+        native = false;
+        ++format;
+        break;
+    default:
+        break;
+    }
+
+    const std::string_view code{format};
+    if (code == "?") return { '?', 1 };
+    if (code == "b") return { 'i', 1 };
+    if (code == "B") return { 'u', 1 };
+    if (code == "h") return { 'i', 2 };
+    if (code == "H") return { 'u', 2 };
+    if (code == "i") return { 'i', native ? sizeof(int) : 4 };
+    if (code == "I") return { 'u', native ? sizeof(unsigned) : 4 };
+    if (code == "l") return { 'i', native ? sizeof(long) : 4 };
+    if (code == "L") return { 'u', native ? sizeof(unsigned long) : 4 };
+    if (code == "q") return { 'i', 8 };
+    if (code == "Q") return { 'u', 8 };
+    if (code == "n" && native) return { 'i', sizeof(std::ptrdiff_t) };
+    if (code == "N" && native) return { 'u', sizeof(std::size_t) };
+    if (code == "e") return { 'f', 2 };
+    if (code == "f") return { 'f', 4 };
+    if (code == "d") return { 'f', 8 };
+    if (code == "Zf") return { 'c', 8 };
+    if (code == "Zd") return { 'c', 16 };
+
+    return { 0, 0 };
+}
+
+} // namespace detail
+
+
+#if defined(__cpp_lib_mdspan)
+
+template<typename T, std::size_t N>
+std::mdspan<T, std::dextents<std::size_t, N>> to_mdspan(
+    ndview<T, N> view
+) noexcept {
+    return std::mdspan<T, std::dextents<std::size_t, N>>(
+        view.data(), view.shape()
+    );
+}
+
+
+template<typename T, typename Extents>
+ndview<T, Extents::rank()> from_mdspan(
+    std::mdspan<T, Extents, std::layout_right> span
+) noexcept {
+    std::array<std::size_t, Extents::rank()> shape{};
+    for (std::size_t i = 0; i < Extents::rank(); ++i) {
+        shape[i] = detail::to_size(span.extent(i));
+    }
+
+    return ndview<T, Extents::rank()>{shape, span.data_handle()};
+}
+
+#endif
+
+
+template<typename T, std::size_t N, typename Allocator>
+DLManagedTensor* to_dlpack(ndarray<T, N, Allocator>&& array) {
+    using context_type = detail::dlpack_context<T, N, Allocator>;
+
+    auto* context = new context_type{std::move(array), {}, {}, {}};
+
+    std::int64_t stride = 1;
+    for (std::size_t i = N; i-- > 0;) {
+        context->shape[i] = static_cast<std::int64_t>(context->array.shape(i));
+        context->strides[i] = stride;
+        stride *= context->shape[i];
+    }
+
+    DLTensor& tensor = context->tensor.dl_tensor;
+    tensor.data = context->array.data();
+    tensor.device = { kDLCPU, 0 };
+    tensor.ndim = static_cast<std::int32_t>(N);
+    tensor.dtype = detail::dlpack_dtype<T>();
+    tensor.shape = context->shape.data();
+    tensor.strides = context->strides.data();
+    tensor.byte_offset = 0;
+
+    context->tensor.manager_ctx = context;
+    context->tensor.deleter = [](DLManagedTensor* self) {
+        delete static_cast<context_type*>(self->manager_ctx);
+    };
+
+    return &context->tensor;
+}
+
+
+template<typename T, std::size_t N>
+dlpack_tensor<T, N>::dlpack_tensor(DLManagedTensor* tensor) :
+    _tensor{tensor},
+    _view{detail::dlpack_view<T, N>(tensor)}
+{
+}
+
+
+template<typename T, std::size_t N>
+dlpack_tensor<T, N>::dlpack_tensor(dlpack_tensor&& other) noexcept :
+    _tensor{std::exchange(other._tensor, nullptr)},
+    _view{other._view}
+{
+}
+
+
+template<typename T, std::size_t N>
+dlpack_tensor<T, N>::~dlpack_tensor() {
+    if (_tensor != nullptr && _tensor->deleter != nullptr) {
+        _tensor->deleter(_tensor);
+    }
+}
+
+
+template<typename T, std::size_t N>
+dlpack_tensor<T, N>& dlpack_tensor<T, N>::operator=(
+    dlpack_tensor&& other
+) noexcept {
+    if (this != &other) {
+        if (_tensor != nullptr && _tensor->deleter != nullptr) {
+            _tensor->deleter(_tensor);
+        }
+        _tensor = std::exchange(other._tensor, nullptr);
+        _view = other._view;
+    }
+
+    return *this;
+}
+
+
+template<typename T, std::size_t N>
+ndview<T, N> dlpack_tensor<T, N>::view() noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N>
+ndview<const T, N> dlpack_tensor<T, N>::view() const noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& dlpack_tensor<T, N>::shape() const noexcept {
+    return _view.shape();
+}
+
+
+template<typename T, std::size_t N>
+DLManagedTensor* dlpack_tensor<T, N>::release() noexcept {
+    return std::exchange(_tensor, nullptr);
+}
+
+
+template<typename T, std::size_t N>
+buffer_info<N> to_buffer(ndview<T, N> view) noexcept {
+    using value_type = std::remove_const_t<T>;
+
+    const void* data = view.data();
+    buffer_info<N> info{
+        const_cast<void*>(data),
+        static_cast<std::ptrdiff_t>(view.element_count() * sizeof(T)),
+        static_cast<std::ptrdiff_t>(sizeof(T)),
+        std::is_const_v<T>,
+        static_cast<int>(N),
+        detail::buffer_format<value_type>(),
+        {},
+        {}
+    };
+
+    std::ptrdiff_t stride = info.itemsize;
+    for (std::size_t i = N; i-- > 0;) {
+        info.shape[i] = static_cast<std::ptrdiff_t>(view.shape(i));
+        info.strides[i] = stride;
+        stride *= info.shape[i];
+    }
+
+    return info;
+}
+
+
+template<typename T, std::size_t N>
+ndview<T, N> from_buffer(const buffer_info<N>& info) {
+    using value_type = std::remove_const_t<T>;
+
+    const auto fail = [](const char* what) {
+        throw std::invalid_argument{std::string{"vt::from_buffer: "} + what};
+    };
+
+    const detail::buffer_type expected = detail::buffer_type_of<value_type>();
+    const detail::buffer_type actual =
+        detail::parse_buffer_format(info.format);
+    if (info.ndim != static_cast<int>(N) || actual.kind != expected.kind ||
+            actual.size != expected.size ||
+            info.itemsize != static_cast<std::ptrdiff_t>(sizeof(T))) {
+        fail("element type or rank mismatch");
+    }
+    if (info.readonly && !std::is_const_v<T>) fail("read-only buffer");
+
+    std::array<std::size_t, N> shape{};
+    for (std::size_t i = 0; i < N; ++i) {
+        if (info.shape[i] < 0) fail("negative extent");
+        shape[i] = static_cast<std::size_t>(info.shape[i]);
+    }
+
+    if (detail::count_elements(shape) > 0) {
+        std::ptrdiff_t stride = info.itemsize;
+        for (std::size_t i = N; i-- > 0;) {
+            if (shape[i] != 1 && info.strides[i] != stride) {
+                fail("elements are not contiguous in row-major order");
+            }
+            stride *= info.shape[i];
+        }
+    }
+
+    if (reinterpret_cast<std::uintptr_t>(info.buf) % alignof(T) != 0) {
+        fail("misaligned data");
+    }
+
+    return { shape, static_cast<T*>(info.buf) };
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_INTEROP_IPP_
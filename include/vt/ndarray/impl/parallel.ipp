@@ -0,0 +1,92 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_PARALLEL_IPP_
+#define VT_NDARRAY_IMPL_PARALLEL_IPP_
+
+#include <vt/ndarray/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+
+namespace vt {
+
+namespace detail {
+
+// A thread count of 0 selects the number of hardware threads, which can be
+// overridden through the VT_NDARRAY_THREAD_COUNT environment variable.
+inline std::size_t resolve_thread_count(std::size_t thread_count) noexcept {
+    if (thread_count > 0) return thread_count;
+
+    return cpu_topology::get().thread_count;
+}
+
+
+// Calls f(i) concurrently for all i in [0, n). Index 0 runs on the calling
+// thread. If starting a thread or f(0) throws, the threads that were started
+// are joined before the exception propagates. The function must not throw on
+// the other threads.
+template<typename F>
+void parallel_invoke(std::size_t n, F&& f) {
+    if (n == 0) return;
+
+    std::vector<std::thread> threads;
+    const auto join = [&threads] {
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    };
+
+    try {
+        threads.reserve(n - 1);
+        for (std::size_t i = 1; i < n; ++i) {
+            threads.emplace_back([&f, i] { f(i); });
+        }
+
+        f(std::size_t{0});
+    } catch (...) {
+        join();
+        throw;
+    }
+
+    join();
+}
+
+
+// Splits [0, n) into contiguous ranges of nearly equal size and calls
+// f(begin, end) for each of them concurrently.
+template<typename F>
+void parallel_for(std::size_t n, std::size_t thread_count, F&& f) {
+    const std::size_t chunk_count =
+        std::min(resolve_thread_count(thread_count), n);
+
+    parallel_invoke(chunk_count, [n, chunk_count, &f](std::size_t i) {
+        f(n * i / chunk_count, n * (i + 1) / chunk_count);
+    });
+}
+
+} // namespace detail
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_PARALLEL_IPP_
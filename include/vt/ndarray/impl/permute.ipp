@@ -0,0 +1,503 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_PERMUTE_IPP_
+#define VT_NDARRAY_IMPL_PERMUTE_IPP_
+
+#include <vt/ndarray/impl/config.ipp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+#if VT_NDARRAY_AVX || VT_NDARRAY_SSE2
+#   include <immintrin.h>
+#endif
+
+
+namespace vt {
+
+namespace detail {
+
+// Transposes a square tile in registers, for elements of the given size:
+// dst[c * dst_stride + r] = src[r * src_stride + c] for r, c < size. Elements
+// that are not trivially copyable use size 0, which copies one element at a
+// time.
+template<std::size_t ElementSize>
+struct transpose_tile {
+    static constexpr std::size_t size = 8;
+
+    template<typename T>
+    static void apply(
+        const T* src, std::size_t src_stride,
+        T* dst, std::size_t dst_stride
+    ) noexcept {
+        for (std::size_t r = 0; r < size; ++r) {
+            for (std::size_t c = 0; c < size; ++c) {
+                dst[c * dst_stride + r] = src[r * src_stride + c];
+            }
+        }
+    }
+};
+
+
+#if VT_NDARRAY_AVX
+
+template<>
+struct transpose_tile<4> {
+    static constexpr std::size_t size = 8;
+
+    template<typename T>
+    static void apply(
+        const T* src, std::size_t src_stride,
+        T* dst, std::size_t dst_stride
+    ) noexcept {
+        // Only shuffles are applied, so the bits of any 4-byte type pass
+        // through unchanged
+        const auto* s =
+            static_cast<const float*>(static_cast<const void*>(src));
+        auto* d = static_cast<float*>(static_cast<void*>(dst));
+
+        const __m256 r0 = _mm256_loadu_ps(s);
+        const __m256 r1 = _mm256_loadu_ps(s + src_stride);
+        const __m256 r2 = _mm256_loadu_ps(s + 2 * src_stride);
+        const __m256 r3 = _mm256_loadu_ps(s + 3 * src_stride);
+        const __m256 r4 = _mm256_loadu_ps(s + 4 * src_stride);
+        const __m256 r5 = _mm256_loadu_ps(s + 5 * src_stride);
+        const __m256 r6 = _mm256_loadu_ps(s + 6 * src_stride);
+        const __m256 r7 = _mm256_loadu_ps(s + 7 * src_stride);
+
+        const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        const __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        const __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        const __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        const __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+        const __m256 u0 = _mm256_shuffle_ps(t0, t2, 0x44);
+        const __m256 u1 = _mm256_shuffle_ps(t0, t2, 0xee);
+        const __m256 u2 = _mm256_shuffle_ps(t1, t3, 0x44);
+        const __m256 u3 = _mm256_shuffle_ps(t1, t3, 0xee);
+        const __m256 u4 = _mm256_shuffle_ps(t4, t6, 0x44);
+        const __m256 u5 = _mm256_shuffle_ps(t4, t6, 0xee);
+        const __m256 u6 = _mm256_shuffle_ps(t5, t7, 0x44);
+        const __m256 u7 = _mm256_shuffle_ps(t5, t7, 0xee);
+
+        _mm256_storeu_ps(d, _mm256_permute2f128_ps(u0, u4, 0x20));
+        _mm256_storeu_ps(d + dst_stride, _mm256_permute2f128_ps(u1, u5, 0x20));
+        _mm256_storeu_ps(
+            d + 2 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x20)
+        );
+        _mm256_storeu_ps(
+            d + 3 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x20)
+        );
+        _mm256_storeu_ps(
+            d + 4 * dst_stride, _mm256_permute2f128_ps(u0, u4, 0x31)
+        );
+        _mm256_storeu_ps(
+            d + 5 * dst_stride, _mm256_permute2f128_ps(u1, u5, 0x31)
+        );
+        _mm256_storeu_ps(
+            d + 6 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x31)
+        );
+        _mm256_storeu_ps(
+            d + 7 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x31)
+        );
+    }
+};
+
+
+template<>
+struct transpose_tile<8> {
+    static constexpr std::size_t size = 4;
+
+    template<typename T>
+    static void apply(
+        const T* src, std::size_t src_stride,
+        T* dst, std::size_t dst_stride
+    ) noexcept {
+        const auto* s =
+            static_cast<const double*>(static_cast<const void*>(src));
+        auto* d = static_cast<double*>(static_cast<void*>(dst));
+
+        const __m256d r0 = _mm256_loadu_pd(s);
+        const __m256d r1 = _mm256_loadu_pd(s + src_stride);
+        const __m256d r2 = _mm256_loadu_pd(s + 2 * src_stride);
+        const __m256d r3 = _mm256_loadu_pd(s + 3 * src_stride);
+
+        const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+        _mm256_storeu_pd(d, _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(d + dst_stride, _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(
+            d + 2 * dst_stride, _mm256_permute2f128_pd(t0, t2, 0x31)
+        );
+        _mm256_storeu_pd(
+            d + 3 * dst_stride, _mm256_permute2f128_pd(t1, t3, 0x31)
+        );
+    }
+};
+
+#elif VT_NDARRAY_SSE2
+
+template<>
+struct transpose_tile<4> {
+    static constexpr std::size_t size = 4;
+
+    template<typename T>
+    static void apply(
+        const T* src, std::size_t src_stride,
+        T* dst, std::size_t dst_stride
+    ) noexcept {
+        const auto load = [src, src_stride](std::size_t r) {
+            return _mm_loadu_si128(static_cast<const __m128i*>(
+                static_cast<const void*>(src + r * src_stride)
+            ));
+        };
+        const auto store = [dst, dst_stride](std::size_t c, __m128i x) {
+            _mm_storeu_si128(
+                static_cast<__m128i*>(
+                    static_cast<void*>(dst + c * dst_stride)
+                ),
+                x
+            );
+        };
+
+        const __m128i r0 = load(0);
+        const __m128i r1 = load(1);
+        const __m128i r2 = load(2);
+        const __m128i r3 = load(3);
+
+        const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+        const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+        const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+        const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+        store(0, _mm_unpacklo_epi64(t0, t1));
+        store(1, _mm_unpackhi_epi64(t0, t1));
+        store(2, _mm_unpacklo_epi64(t2, t3));
+        store(3, _mm_unpackhi_epi64(t2, t3));
+    }
+};
+
+
+template<>
+struct transpose_tile<8> {
+    static constexpr std::size_t size = 2;
+
+    template<typename T>
+    static void apply(
+        const T* src, std::size_t src_stride,
+        T* dst, std::size_t dst_stride
+    ) noexcept {
+        const __m128i r0 = _mm_loadu_si128(
+            static_cast<const __m128i*>(static_cast<const void*>(src))
+        );
+        const __m128i r1 = _mm_loadu_si128(static_cast<const __m128i*>(
+            static_cast<const void*>(src + src_stride)
+        ));
+
+        _mm_storeu_si128(
+            static_cast<__m128i*>(static_cast<void*>(dst)),
+            _mm_unpacklo_epi64(r0, r1)
+        );
+        _mm_storeu_si128(
+            static_cast<__m128i*>(static_cast<void*>(dst + dst_stride)),
+            _mm_unpackhi_epi64(r0, r1)
+        );
+    }
+};
+
+#endif
+
+
+template<typename T>
+using transpose_kernel = transpose_tile<
+    std::is_trivially_copyable<T>::value ? sizeof(T) : 0
+>;
+
+
+// Edge length of the blocks that are transposed at once, such that a source
+// and a destination block take up a quarter of the L1 cache. A power of two,
+// so that it is a multiple of every transpose kernel size.
+template<typename T>
+std::size_t transpose_block_size() noexcept {
+    const std::size_t elements =
+        cpu_topology::get().l1d_cache_size / (8 * sizeof(T));
+
+    std::size_t b = 8;
+    while (b < 64 && 2 * b * 2 * b <= elements) {
+        b *= 2;
+    }
+
+    return b;
+}
+
+
+// dst[c * dst_stride + r] = src[r * src_stride + c] for r < rows and
+// c < cols, for a block that fits in the cache
+template<typename T>
+void transpose_block(
+    const T* src, std::size_t src_stride,
+    T* dst, std::size_t dst_stride,
+    std::size_t rows, std::size_t cols
+) noexcept {
+    using kernel = transpose_kernel<T>;
+    constexpr std::size_t k = kernel::size;
+
+    std::size_t r = 0;
+    for (; r + k <= rows; r += k) {
+        std::size_t c = 0;
+        for (; c + k <= cols; c += k) {
+            kernel::apply(
+                src + r * src_stride + c, src_stride,
+                dst + c * dst_stride + r, dst_stride
+            );
+        }
+        for (; c < cols; ++c) {
+            for (std::size_t i = r; i < r + k; ++i) {
+                dst[c * dst_stride + i] = src[i * src_stride + c];
+            }
+        }
+    }
+    for (; r < rows; ++r) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            dst[c * dst_stride + r] = src[r * src_stride + c];
+        }
+    }
+}
+
+
+template<typename T>
+void transpose_copy(
+    const T* src, std::size_t src_stride,
+    T* dst, std::size_t dst_stride,
+    std::size_t rows, std::size_t cols
+) noexcept {
+    const std::size_t b = transpose_block_size<T>();
+
+    for (std::size_t r = 0; r < rows; r += b) {
+        for (std::size_t c = 0; c < cols; c += b) {
+            transpose_block(
+                src + r * src_stride + c, src_stride,
+                dst + c * dst_stride + r, dst_stride,
+                std::min(b, rows - r), std::min(b, cols - c)
+            );
+        }
+    }
+}
+
+
+// Calls f(src_offset, dst_offset) for every index into the first `rank`
+// dimensions, in row-major order
+template<std::size_t N, typename F>
+void for_each_offset(
+    const std::array<std::size_t, N>& extent,
+    const std::array<std::size_t, N>& src_stride,
+    const std::array<std::size_t, N>& dst_stride,
+    std::size_t rank,
+    F&& f
+) {
+    std::array<std::size_t, N> index{};
+    std::size_t src_offset = 0;
+    std::size_t dst_offset = 0;
+
+    for (;;) {
+        f(src_offset, dst_offset);
+
+        std::size_t d = rank;
+        for (;;) {
+            if (d == 0) return;
+            --d;
+
+            if (++index[d] < extent[d]) {
+                src_offset += src_stride[d];
+                dst_offset += dst_stride[d];
+                break;
+            }
+
+            index[d] = 0;
+            src_offset -= (extent[d] - 1) * src_stride[d];
+            dst_offset -= (extent[d] - 1) * dst_stride[d];
+        }
+    }
+}
+
+} // namespace detail
+
+
+template<typename T, std::size_t N>
+void permute_copy(
+    detail::nondeduced_t<ndview<const T, N>> src,
+    ndview<T, N> dst,
+    const std::array<std::size_t, N>& axes
+) noexcept {
+#ifndef NDEBUG
+    std::array<bool, N> seen{};
+    for (std::size_t i = 0; i < N; ++i) {
+        assert(axes[i] < N && !seen[axes[i]]);
+        assert(dst.shape(i) == src.shape(axes[i]));
+        seen[axes[i]] = true;
+    }
+#endif
+
+    if (dst.element_count() == 0) return;
+
+    std::array<std::size_t, N> src_strides;
+    std::size_t stride = 1;
+    for (std::size_t i = N; i-- > 0;) {
+        src_strides[i] = stride;
+        stride *= src.shape(i);
+    }
+
+    // The axes of dst with their strides in src. Axes of length 1 are
+    // dropped, and adjacent axes that are contiguous in src are merged.
+    std::array<std::size_t, N> extent;
+    std::array<std::size_t, N> src_stride;
+    std::size_t rank = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        const std::size_t e = dst.shape(i);
+        if (e == 1) continue;
+
+        const std::size_t s = src_strides[axes[i]];
+        if (rank > 0 && src_stride[rank - 1] == s * e) {
+            extent[rank - 1] *= e;
+            src_stride[rank - 1] = s;
+        } else {
+            extent[rank] = e;
+            src_stride[rank] = s;
+            ++rank;
+        }
+    }
+
+    const T* src_data = src.data();
+    T* dst_data = dst.data();
+
+    if (rank == 0) {
+        *dst_data = *src_data;
+        return;
+    }
+
+    std::array<std::size_t, N> dst_stride;
+    dst_stride[rank - 1] = 1;
+    for (std::size_t d = rank - 1; d-- > 0;) {
+        dst_stride[d] = dst_stride[d + 1] * extent[d + 1];
+    }
+
+    // Rows that are contiguous in both are copied as a whole
+    if (src_stride[rank - 1] == 1) {
+        const std::size_t row = extent[rank - 1];
+        detail::for_each_offset(
+            extent, src_stride, dst_stride, rank - 1,
+            [&](std::size_t src_offset, std::size_t dst_offset) {
+                std::copy_n(src_data + src_offset, row, dst_data + dst_offset);
+            }
+        );
+        return;
+    }
+
+    // Otherwise the innermost axis of dst and the axis that is innermost in
+    // src form a transpose, which is repeated over all other axes
+    const std::size_t p = static_cast<std::size_t>(
+        std::find(src_stride.begin(), src_stride.begin() + rank, 1) -
+        src_stride.begin()
+    );
+    const std::size_t rows = extent[rank - 1];
+    const std::size_t row_stride = src_stride[rank - 1];
+    const std::size_t cols = extent[p];
+    const std::size_t col_stride = dst_stride[p];
+
+    std::array<std::size_t, N> outer_extent;
+    std::array<std::size_t, N> outer_src_stride;
+    std::array<std::size_t, N> outer_dst_stride;
+    std::size_t outer_rank = 0;
+    for (std::size_t d = 0; d + 1 < rank; ++d) {
+        if (d == p) continue;
+        outer_extent[outer_rank] = extent[d];
+        outer_src_stride[outer_rank] = src_stride[d];
+        outer_dst_stride[outer_rank] = dst_stride[d];
+        ++outer_rank;
+    }
+
+    detail::for_each_offset(
+        outer_extent, outer_src_stride, outer_dst_stride, outer_rank,
+        [&](std::size_t src_offset, std::size_t dst_offset) {
+            detail::transpose_copy(
+                src_data + src_offset, row_stride,
+                dst_data + dst_offset, col_stride,
+                rows, cols
+            );
+        }
+    );
+}
+
+
+template<typename T>
+void transpose(ndview<T, 2> a) noexcept {
+    assert(a.shape(0) == a.shape(1));
+
+    using kernel = detail::transpose_kernel<T>;
+    constexpr std::size_t k = kernel::size;
+    const std::size_t b = detail::transpose_block_size<T>();
+
+    const std::size_t n = a.shape(0);
+    const std::size_t tiled = n - n % k;
+    T* data = a.data();
+
+    // Tiles above the diagonal are exchanged with their mirror images through
+    // a buffer, block by block
+    std::array<T, k * k> tile;
+    for (std::size_t ib = 0; ib < tiled; ib += b) {
+        const std::size_t i_end = std::min(ib + b, tiled);
+        for (std::size_t jb = ib; jb < tiled; jb += b) {
+            const std::size_t j_end = std::min(jb + b, tiled);
+            for (std::size_t i = ib; i < i_end; i += k) {
+                for (std::size_t j = jb == ib ? i : jb; j < j_end; j += k) {
+                    T* upper = data + i * n + j;
+                    T* lower = data + j * n + i;
+
+                    kernel::apply(upper, n, tile.data(), k);
+                    if (i != j) kernel::apply(lower, n, upper, n);
+                    for (std::size_t r = 0; r < k; ++r) {
+                        std::copy_n(tile.data() + r * k, k, lower + r * n);
+                    }
+                }
+            }
+        }
+    }
+
+    for (std::size_t i = tiled; i < n; ++i) {
+        for (std::size_t j = 0; j < i; ++j) {
+            using std::swap;
+            swap(data[i * n + j], data[j * n + i]);
+        }
+    }
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_PERMUTE_IPP_
@@ -0,0 +1,695 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_PIPELINE_IPP_
+#define VT_NDARRAY_IMPL_PIPELINE_IPP_
+
+#include <vt/ndarray/impl/parallel.ipp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <map>
+#include <type_traits>
+#include <utility>
+
+
+namespace vt {
+
+namespace detail {
+
+inline thread_pool::thread_pool(std::size_t thread_count) :
+    _first_task{0},
+    _task_count{0},
+    _stopping{false}
+{
+    const std::size_t count = resolve_thread_count(thread_count);
+
+    _threads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        _threads.emplace_back([this] { run(); });
+    }
+}
+
+
+inline thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stopping = true;
+    }
+    _ready.notify_all();
+
+    for (std::thread& thread : _threads) {
+        thread.join();
+    }
+}
+
+
+inline void thread_pool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_task_count == _tasks.size()) this->grow();
+
+        _tasks[(_first_task + _task_count) % _tasks.size()] = std::move(task);
+        ++_task_count;
+    }
+    _ready.notify_one();
+}
+
+
+// Must be called with the mutex held. Leaves the tasks unchanged if the
+// allocation fails.
+inline void thread_pool::grow() {
+    std::vector<std::function<void()>> tasks(
+        std::max<std::size_t>(2 * _tasks.size(), 16)
+    );
+    for (std::size_t i = 0; i < _task_count; ++i) {
+        tasks[i] = std::move(_tasks[(_first_task + i) % _tasks.size()]);
+    }
+
+    _tasks = std::move(tasks);
+    _first_task = 0;
+}
+
+
+// Remaining tasks are still executed when the pool is stopped.
+inline void thread_pool::run() noexcept {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _ready.wait(lock, [this] { return _stopping || _task_count > 0; });
+            if (_task_count == 0) return;
+
+            task = std::move(_tasks[_first_task]);
+            _tasks[_first_task] = nullptr;
+            _first_task = (_first_task + 1) % _tasks.size();
+            --_task_count;
+        }
+
+        task();
+    }
+}
+
+
+// Queue of at most a fixed number of elements, which does not allocate
+// after construction
+template<typename U>
+class bounded_queue {
+public:
+    bounded_queue() noexcept;
+    explicit bounded_queue(std::size_t capacity);
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    void push(U&& value) noexcept;
+    U pop() noexcept;
+
+private:
+    std::vector<U> _slots;
+    std::size_t _first;
+    std::size_t _size;
+};
+
+
+template<typename U>
+bounded_queue<U>::bounded_queue() noexcept : _first{0}, _size{0} {
+}
+
+
+template<typename U>
+bounded_queue<U>::bounded_queue(std::size_t capacity) :
+    _slots(capacity),
+    _first{0},
+    _size{0}
+{
+}
+
+
+template<typename U>
+std::size_t bounded_queue<U>::size() const noexcept {
+    return _size;
+}
+
+
+template<typename U>
+bool bounded_queue<U>::empty() const noexcept {
+    return _size == 0;
+}
+
+
+template<typename U>
+void bounded_queue<U>::push(U&& value) noexcept {
+    static_assert(std::is_nothrow_move_assignable_v<U>);
+    assert(_size < _slots.size());
+
+    _slots[(_first + _size) % _slots.size()] = std::move(value);
+    ++_size;
+}
+
+
+template<typename U>
+U bounded_queue<U>::pop() noexcept {
+    static_assert(std::is_nothrow_move_constructible_v<U>);
+    assert(_size > 0);
+
+    U value = std::move(_slots[_first]);
+    _first = (_first + 1) % _slots.size();
+    --_size;
+
+    return value;
+}
+
+
+template<typename T, std::size_t N>
+struct ndarray_pool_state {
+    std::size_t capacity;
+    std::atomic<std::size_t> allocation_count;
+
+    std::mutex mutex;
+    std::map<std::array<std::size_t, N>, std::vector<ndarray<T, N>>> idle;
+
+    explicit ndarray_pool_state(std::size_t capacity_) noexcept :
+        capacity{capacity_},
+        allocation_count{0}
+    {}
+
+    ~ndarray_pool_state() {
+        unpoison_all(idle);
+    }
+
+    // The array is freed outside of the lock if it is not kept.
+    void release(ndarray<T, N>&& array) noexcept {
+        ndarray<T, N> dropped;
+
+        std::lock_guard<std::mutex> lock{mutex};
+        const auto it = idle.find(array.shape());
+        if (it != idle.end() && it->second.size() < capacity) {
+            poison(it->second.emplace_back(std::move(array)));
+        } else {
+            dropped = std::move(array);
+        }
+    }
+
+    // Idle arrays are poisoned under AddressSanitizer, so that writes through
+    // a view that outlived its pooled_ndarray are reported. Arrays of types
+    // with destructors are left alone, since destroying them reads the
+    // elements.
+    static void poison(const ndarray<T, N>& array) noexcept {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            poison_memory(array.data(), array.element_count() * sizeof(T));
+        }
+    }
+
+    static void unpoison(const ndarray<T, N>& array) noexcept {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            unpoison_memory(array.data(), array.element_count() * sizeof(T));
+        }
+    }
+
+    static void unpoison_all(
+        const std::map<
+            std::array<std::size_t, N>, std::vector<ndarray<T, N>>
+        >& arrays
+    ) noexcept {
+        for (const auto& entry : arrays) {
+            for (const ndarray<T, N>& array : entry.second) {
+                unpoison(array);
+            }
+        }
+    }
+};
+
+} // namespace detail
+
+
+template<typename T, std::size_t N>
+pooled_ndarray<T, N>::pooled_ndarray() noexcept = default;
+
+
+template<typename T, std::size_t N>
+pooled_ndarray<T, N>::pooled_ndarray(
+    std::shared_ptr<detail::ndarray_pool_state<T, N>> pool,
+    ndarray<T, N>&& array
+) noexcept :
+    _pool{std::move(pool)},
+    _array{std::move(array)}
+{}
+
+
+template<typename T, std::size_t N>
+pooled_ndarray<T, N>::pooled_ndarray(pooled_ndarray&& other) noexcept :
+    _pool{std::move(other._pool)},
+    _array{std::move(other._array)}
+{}
+
+
+template<typename T, std::size_t N>
+pooled_ndarray<T, N>::~pooled_ndarray() {
+    reset();
+}
+
+
+template<typename T, std::size_t N>
+pooled_ndarray<T, N>& pooled_ndarray<T, N>::operator=(
+    pooled_ndarray&& other
+) noexcept {
+    if (this != &other) {
+        reset();
+        _pool = std::move(other._pool);
+        _array = std::move(other._array);
+    }
+
+    return *this;
+}
+
+
+template<typename T, std::size_t N>
+pooled_ndarray<T, N>::operator ndview<T, N>() noexcept {
+    return _array.view();
+}
+
+
+template<typename T, std::size_t N>
+pooled_ndarray<T, N>::operator ndview<const T, N>() const noexcept {
+    return _array.view();
+}
+
+
+template<typename T, std::size_t N>
+ndview<T, N> pooled_ndarray<T, N>::view() noexcept {
+    return _array.view();
+}
+
+
+template<typename T, std::size_t N>
+ndview<const T, N> pooled_ndarray<T, N>::view() const noexcept {
+    return _array.view();
+}
+
+
+template<typename T, std::size_t N>
+ndview<const T, N> pooled_ndarray<T, N>::cview() const noexcept {
+    return _array.cview();
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& pooled_ndarray<T, N>::shape(
+) const noexcept {
+    return _array.shape();
+}
+
+
+template<typename T, std::size_t N>
+pooled_ndarray<T, N>::operator bool() const noexcept {
+    return _pool != nullptr;
+}
+
+
+template<typename T, std::size_t N>
+void pooled_ndarray<T, N>::reset() noexcept {
+    if (_pool) {
+        _pool->release(std::move(_array));
+        _pool.reset();
+    }
+}
+
+
+template<typename T, std::size_t N>
+ndarray_pool<T, N>::ndarray_pool(std::size_t capacity) :
+    _state{std::make_shared<detail::ndarray_pool_state<T, N>>(capacity)}
+{}
+
+
+template<typename T, std::size_t N>
+pooled_ndarray<T, N> ndarray_pool<T, N>::acquire(
+    const std::array<std::size_t, N>& shape
+) {
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+
+        // The idle list of a shape is allocated in full on first use, so
+        // that handing arrays back never allocates
+        std::vector<ndarray<T, N>>& idle = _state->idle[shape];
+        if (idle.capacity() < _state->capacity) {
+            idle.reserve(_state->capacity);
+        }
+
+        if (!idle.empty()) {
+            _state->unpoison(idle.back());
+            pooled_ndarray<T, N> result{_state, std::move(idle.back())};
+            idle.pop_back();
+            return result;
+        }
+    }
+
+    ++_state->allocation_count;
+
+    return {_state, ndarray<T, N>{shape}};
+}
+
+
+template<typename T, std::size_t N>
+std::size_t ndarray_pool<T, N>::capacity() const noexcept {
+    return _state->capacity;
+}
+
+
+template<typename T, std::size_t N>
+std::size_t ndarray_pool<T, N>::idle_count() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+
+    std::size_t count = 0;
+    for (const auto& entry : _state->idle) {
+        count += entry.second.size();
+    }
+
+    return count;
+}
+
+
+template<typename T, std::size_t N>
+std::size_t ndarray_pool<T, N>::allocation_count() const noexcept {
+    return _state->allocation_count;
+}
+
+
+template<typename T, std::size_t N>
+void ndarray_pool<T, N>::clear() {
+    std::map<std::array<std::size_t, N>, std::vector<ndarray<T, N>>> idle;
+
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    _state->idle.swap(idle);
+    _state->unpoison_all(idle);
+}
+
+
+inline std::chrono::nanoseconds pipeline_stage_stats::mean_time(
+) const noexcept {
+    if (frame_count == 0) return std::chrono::nanoseconds{0};
+
+    return total_time / static_cast<std::chrono::nanoseconds::rep>(
+        frame_count
+    );
+}
+
+
+// Frames per second of time spent in the stage
+inline double pipeline_stage_stats::throughput() const noexcept {
+    const double seconds =
+        std::chrono::duration<double>(total_time).count();
+
+    return seconds > 0.0 ? static_cast<double>(frame_count) / seconds : 0.0;
+}
+
+
+template<typename T, std::size_t N>
+struct pipeline<T, N>::stage {
+    std::array<std::size_t, N> shape;
+    stage_function function;
+
+    // Frames waiting for this stage, plus the number of places promised to
+    // a frame that is being produced by the previous stage
+    detail::bounded_queue<pooled_ndarray<T, N>> queue;
+    std::size_t reserved;
+
+    // The frame that is being processed, if running
+    pooled_ndarray<T, N> current;
+    bool running;
+
+    pipeline_stage_stats stats;
+};
+
+
+template<typename T, std::size_t N>
+pipeline<T, N>::pipeline(
+    ndarray_pool<T, N>& pool,
+    std::size_t queue_capacity,
+    std::size_t thread_count
+) :
+    _pool{pool},
+    _queue_capacity{queue_capacity},
+    _active_count{0},
+    _threads{thread_count}
+{
+    assert(queue_capacity > 0);
+}
+
+
+template<typename T, std::size_t N>
+pipeline<T, N>::~pipeline() {
+    try {
+        finish();
+    } catch (...) {
+        // Errors are only reported through finish
+    }
+}
+
+
+template<typename T, std::size_t N>
+pipeline<T, N>& pipeline<T, N>::add_stage(
+    std::string name,
+    const std::array<std::size_t, N>& output_shape,
+    stage_function function
+) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    assert(_active_count == 0);
+
+    auto s = std::make_unique<stage>();
+    s->shape = output_shape;
+    s->function = std::move(function);
+    s->queue = detail::bounded_queue<pooled_ndarray<T, N>>{_queue_capacity};
+    s->reserved = 0;
+    s->running = false;
+    s->stats = {
+        std::move(name), 0,
+        std::chrono::nanoseconds::zero(),
+        std::chrono::nanoseconds::max(),
+        std::chrono::nanoseconds::zero()
+    };
+    _stages.push_back(std::move(s));
+
+    return *this;
+}
+
+
+template<typename T, std::size_t N>
+pipeline<T, N>& pipeline<T, N>::set_sink(sink_function sink) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    assert(_active_count == 0);
+
+    _sink = std::move(sink);
+
+    return *this;
+}
+
+
+template<typename T, std::size_t N>
+void pipeline<T, N>::push(ndview<const T, N> frame) {
+    std::unique_lock<std::mutex> lock{_mutex};
+    wait_for_space(lock);
+
+    // Hold the place while the frame is copied
+    stage& first = *_stages.front();
+    ++first.reserved;
+    lock.unlock();
+
+    pooled_ndarray<T, N> buffer;
+    try {
+        buffer = _pool.acquire(frame.shape());
+        std::copy(frame.begin(), frame.end(), buffer.view().begin());
+    } catch (...) {
+        lock.lock();
+        --first.reserved;
+        _changed.notify_all();
+        throw;
+    }
+
+    lock.lock();
+    --first.reserved;
+    enqueue(std::move(buffer));
+}
+
+
+template<typename T, std::size_t N>
+void pipeline<T, N>::push(pooled_ndarray<T, N>&& frame) {
+    assert(frame);
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    wait_for_space(lock);
+    enqueue(std::move(frame));
+}
+
+
+template<typename T, std::size_t N>
+void pipeline<T, N>::finish() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _changed.wait(lock, [this] { return _active_count == 0; });
+
+    if (_error) {
+        std::exception_ptr error = std::move(_error);
+        _error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+
+template<typename T, std::size_t N>
+std::vector<pipeline_stage_stats> pipeline<T, N>::stats() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    std::vector<pipeline_stage_stats> result;
+    result.reserve(_stages.size());
+    for (const std::unique_ptr<stage>& s : _stages) {
+        result.push_back(s->stats);
+        if (s->stats.frame_count == 0) {
+            result.back().min_time = std::chrono::nanoseconds::zero();
+        }
+    }
+
+    return result;
+}
+
+
+// Blocks while the queue of the first stage is full, which is how a slow
+// stage holds back the producer
+template<typename T, std::size_t N>
+void pipeline<T, N>::wait_for_space(std::unique_lock<std::mutex>& lock) {
+    assert(!_stages.empty());
+
+    const stage& first = *_stages.front();
+    _changed.wait(lock, [this, &first] {
+        return first.queue.size() + first.reserved < _queue_capacity;
+    });
+}
+
+
+template<typename T, std::size_t N>
+void pipeline<T, N>::enqueue(pooled_ndarray<T, N>&& frame) {
+    _stages.front()->queue.push(std::move(frame));
+    ++_active_count;
+    schedule(0);
+}
+
+
+// Starts stage i on its next frame if it is idle and the next stage has room
+// for the result. Must be called with the mutex held.
+template<typename T, std::size_t N>
+void pipeline<T, N>::schedule(std::size_t i) noexcept {
+    stage& s = *_stages[i];
+    if (s.running || s.queue.empty()) return;
+
+    const bool last = i + 1 == _stages.size();
+    if (!last) {
+        stage& next = *_stages[i + 1];
+        if (next.queue.size() + next.reserved >= _queue_capacity) return;
+        ++next.reserved;
+    }
+
+    s.current = s.queue.pop();
+    s.running = true;
+    _changed.notify_all();
+
+    try {
+        _threads.submit([this, i] { run_stage(i); });
+    } catch (...) {
+        // Without a task to run the stage, its frames are dropped and the
+        // error is reported by finish
+        if (!_error) _error = std::current_exception();
+        if (!last) --_stages[i + 1]->reserved;
+
+        _active_count -= 1 + s.queue.size();
+        s.current.reset();
+        while (!s.queue.empty()) s.queue.pop();
+        s.running = false;
+    }
+}
+
+
+template<typename T, std::size_t N>
+void pipeline<T, N>::run_stage(std::size_t i) noexcept {
+    using clock = std::chrono::steady_clock;
+
+    stage& s = *_stages[i];
+    const bool last = i + 1 == _stages.size();
+
+    bool skip;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        skip = _error != nullptr;
+    }
+
+    // Frames after a failure are dropped until the failure is reported
+    pooled_ndarray<T, N> result;
+    std::exception_ptr error;
+    clock::duration elapsed{};
+    if (!skip) {
+        try {
+            result = _pool.acquire(s.shape);
+
+            const clock::time_point start = clock::now();
+            s.function(s.current.cview(), result.view());
+            elapsed = clock::now() - start;
+
+            if (last && _sink) _sink(result.cview());
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    s.current.reset();
+
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    const bool success = !skip && !error;
+    if (error && !_error) _error = error;
+
+    if (success) {
+        const auto time =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+        ++s.stats.frame_count;
+        s.stats.total_time += time;
+        s.stats.min_time = std::min(s.stats.min_time, time);
+        s.stats.max_time = std::max(s.stats.max_time, time);
+    }
+
+    if (!last) {
+        stage& next = *_stages[i + 1];
+        --next.reserved;
+        if (success) {
+            next.queue.push(std::move(result));
+        } else {
+            --_active_count;
+        }
+    } else {
+        --_active_count;
+    }
+    s.running = false;
+
+    schedule(i);
+    if (!last) schedule(i + 1);
+    if (i > 0) schedule(i - 1);
+    _changed.notify_all();
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_PIPELINE_IPP_
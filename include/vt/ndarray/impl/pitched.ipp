@@ -0,0 +1,364 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_PITCHED_IPP_
+#define VT_NDARRAY_IMPL_PITCHED_IPP_
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+
+namespace vt {
+
+namespace detail {
+
+// The default alignment of ndarray_allocator is a compile-time constant, which
+// can be smaller than the line size that padded_pitch rounds rows up to.
+template<typename T>
+ndarray_allocator<T> pitched_allocator() noexcept {
+    return ndarray_allocator<T>{std::align_val_t{
+        std::max(cpu_topology::get().cache_line_size, alignof(T))
+    }};
+}
+
+} // namespace detail
+
+
+// Cache sets are selected by the low bits of the line address, so a column
+// walk with a power-of-two pitch only ever touches a fraction of the sets. An
+// odd number of lines per row cycles through all of them.
+template<typename T>
+std::size_t padded_pitch(std::size_t row_length) noexcept {
+    const std::size_t line_size = cpu_topology::get().cache_line_size;
+    if (row_length == 0 || line_size % sizeof(T) != 0) return row_length;
+
+    const std::size_t line_elements = line_size / sizeof(T);
+    std::size_t line_count = (row_length + line_elements - 1) / line_elements;
+    if (line_count > 1 && line_count % 2 == 0) {
+        ++line_count;
+    }
+
+    return line_count * line_elements;
+}
+
+
+template<typename T, std::size_t N>
+constexpr pitched_ndview<T, N>::pitched_ndview(
+    const std::array<std::size_t, N>& shape_,
+    std::size_t pitch_,
+    T* data_
+) noexcept :
+    _shape{shape_},
+    _pitch{pitch_},
+    _data{data_}
+{
+    assert(_pitch >= _shape[N - 1]);
+}
+
+
+template<typename T, std::size_t N>
+constexpr pitched_ndview<T, N>::pitched_ndview(ndview<T, N> dense) noexcept :
+    _shape{dense.shape()},
+    _pitch{dense.shape(N - 1)},
+    _data{dense.data()}
+{
+}
+
+
+template<typename T, std::size_t N>
+constexpr decltype(auto) pitched_ndview<T, N>::operator[](
+    std::size_t idx
+) const noexcept {
+    detail::check_index(
+        "vt::pitched_ndview::operator[]: index out of range", idx, _shape
+    );
+
+    T* first = _data + idx * this->rows_per_index() * _pitch;
+
+    if constexpr (N > 2) {
+        std::array<std::size_t, N - 1> subshape_{};
+        for (std::size_t i = 0; i < N - 1; ++i) {
+            subshape_[i] = _shape[i + 1];
+        }
+
+        return pitched_ndview<T, N - 1>{subshape_, _pitch, first};
+    } else {
+        return ndview<T, 1>{{ _shape[1] }, first};
+    }
+}
+
+
+template<typename T, std::size_t N>
+constexpr pitched_ndview<T, N>::operator pitched_ndview<const T, N>(
+) const noexcept {
+    return { _shape, _pitch, _data };
+}
+
+
+template<typename T, std::size_t N>
+constexpr std::size_t pitched_ndview<T, N>::element_count() const noexcept {
+    return detail::count_elements(_shape);
+}
+
+
+template<typename T, std::size_t N>
+constexpr const std::array<std::size_t, N>& pitched_ndview<T, N>::shape(
+) const noexcept {
+    return _shape;
+}
+
+
+template<typename T, std::size_t N>
+constexpr std::size_t pitched_ndview<T, N>::shape(
+    std::size_t dim
+) const noexcept {
+    assert(dim < N);
+
+    return _shape[dim];
+}
+
+
+template<typename T, std::size_t N>
+constexpr std::size_t pitched_ndview<T, N>::pitch() const noexcept {
+    return _pitch;
+}
+
+
+template<typename T, std::size_t N>
+constexpr std::size_t pitched_ndview<T, N>::row_count() const noexcept {
+    return _shape[0] * this->rows_per_index();
+}
+
+
+template<typename T, std::size_t N>
+constexpr ndview<T, 1> pitched_ndview<T, N>::row(
+    std::size_t idx
+) const noexcept {
+    assert(idx < this->row_count());
+
+    return { { _shape[N - 1] }, _data + idx * _pitch };
+}
+
+
+template<typename T, std::size_t N>
+constexpr T* pitched_ndview<T, N>::data() const noexcept {
+    return _data;
+}
+
+
+template<typename T, std::size_t N>
+constexpr pitched_ndview<T, N> pitched_ndview<T, N>::slice(
+    std::size_t offset
+) const noexcept {
+    return this->slice(offset, _shape[0] - offset);
+}
+
+
+template<typename T, std::size_t N>
+constexpr pitched_ndview<T, N> pitched_ndview<T, N>::slice(
+    std::size_t offset,
+    std::size_t count
+) const noexcept {
+    detail::check_slice(
+        "vt::pitched_ndview::slice: range out of bounds", offset, count, _shape
+    );
+
+    std::array<std::size_t, N> slice_shape = _shape;
+    slice_shape[0] = count;
+
+    return {
+        slice_shape,
+        _pitch,
+        _data + offset * this->rows_per_index() * _pitch
+    };
+}
+
+
+// Number of rows spanned by one index into the first dimension
+template<typename T, std::size_t N>
+constexpr std::size_t pitched_ndview<T, N>::rows_per_index() const noexcept {
+    std::size_t count = 1;
+    for (std::size_t i = 1; i < N - 1; ++i) {
+        count *= _shape[i];
+    }
+
+    return count;
+}
+
+
+template<typename T, std::size_t N>
+pitched_ndarray<T, N>::pitched_ndarray() noexcept :
+    _shape{},
+    _pitch{0}
+{
+}
+
+
+template<typename T, std::size_t N>
+pitched_ndarray<T, N>::pitched_ndarray(
+    const std::array<std::size_t, N>& shape_
+) :
+    _shape{shape_},
+    _pitch{padded_pitch<T>(shape_[N - 1])},
+    _storage{
+        { detail::count_elements(shape_) / std::max<std::size_t>(
+            shape_[N - 1], 1
+        ) * _pitch },
+        detail::pitched_allocator<T>()
+    }
+{
+}
+
+
+template<typename T, std::size_t N>
+pitched_ndarray<T, N>::pitched_ndarray(
+    const std::array<std::size_t, N>& shape_,
+    const T& init
+) :
+    _shape{shape_},
+    _pitch{padded_pitch<T>(shape_[N - 1])},
+    _storage{
+        { detail::count_elements(shape_) / std::max<std::size_t>(
+            shape_[N - 1], 1
+        ) * _pitch },
+        init,
+        detail::pitched_allocator<T>()
+    }
+{
+}
+
+
+template<typename T, std::size_t N>
+pitched_ndarray<T, N>::pitched_ndarray(ndview<const T, N> src) :
+    pitched_ndarray{src.shape()}
+{
+    const std::size_t n = _shape[N - 1];
+    for (std::size_t r = 0; r < this->row_count(); ++r) {
+        std::copy_n(src.data() + r * n, n, _storage.data() + r * _pitch);
+    }
+}
+
+
+template<typename T, std::size_t N>
+decltype(auto) pitched_ndarray<T, N>::operator[](std::size_t idx) noexcept {
+    return this->view()[idx];
+}
+
+
+template<typename T, std::size_t N>
+decltype(auto) pitched_ndarray<T, N>::operator[](
+    std::size_t idx
+) const noexcept {
+    return this->cview()[idx];
+}
+
+
+template<typename T, std::size_t N>
+pitched_ndarray<T, N>::operator pitched_ndview<T, N>() noexcept {
+    return this->view();
+}
+
+
+template<typename T, std::size_t N>
+pitched_ndarray<T, N>::operator pitched_ndview<const T, N>() const noexcept {
+    return this->view();
+}
+
+
+template<typename T, std::size_t N>
+pitched_ndview<T, N> pitched_ndarray<T, N>::view() noexcept {
+    return { _shape, _pitch, _storage.data() };
+}
+
+
+template<typename T, std::size_t N>
+pitched_ndview<const T, N> pitched_ndarray<T, N>::view() const noexcept {
+    return { _shape, _pitch, _storage.data() };
+}
+
+
+template<typename T, std::size_t N>
+pitched_ndview<const T, N> pitched_ndarray<T, N>::cview() const noexcept {
+    return { _shape, _pitch, _storage.data() };
+}
+
+
+template<typename T, std::size_t N>
+std::size_t pitched_ndarray<T, N>::element_count() const noexcept {
+    return detail::count_elements(_shape);
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& pitched_ndarray<T, N>::shape(
+) const noexcept {
+    return _shape;
+}
+
+
+template<typename T, std::size_t N>
+std::size_t pitched_ndarray<T, N>::shape(std::size_t dim) const noexcept {
+    assert(dim < N);
+
+    return _shape[dim];
+}
+
+
+template<typename T, std::size_t N>
+std::size_t pitched_ndarray<T, N>::pitch() const noexcept {
+    return _pitch;
+}
+
+
+template<typename T, std::size_t N>
+std::size_t pitched_ndarray<T, N>::row_count() const noexcept {
+    return this->cview().row_count();
+}
+
+
+template<typename T, std::size_t N>
+ndview<T, 1> pitched_ndarray<T, N>::row(std::size_t idx) noexcept {
+    return this->view().row(idx);
+}
+
+
+template<typename T, std::size_t N>
+ndview<const T, 1> pitched_ndarray<T, N>::row(
+    std::size_t idx
+) const noexcept {
+    return this->cview().row(idx);
+}
+
+
+template<typename T, std::size_t N>
+T* pitched_ndarray<T, N>::data() noexcept {
+    return _storage.data();
+}
+
+
+template<typename T, std::size_t N>
+const T* pitched_ndarray<T, N>::data() const noexcept {
+    return _storage.data();
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_PITCHED_IPP_
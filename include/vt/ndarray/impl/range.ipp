@@ -0,0 +1,302 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_RANGE_IPP_
+#define VT_NDARRAY_IMPL_RANGE_IPP_
+
+#include <cassert>
+#include <utility>
+
+
+namespace vt {
+
+namespace detail {
+
+template<std::size_t N>
+constexpr std::size_t dot(
+    const std::array<std::size_t, N>& a,
+    const std::array<std::size_t, N>& b
+) noexcept {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        result += a[i] * b[i];
+    }
+
+    return result;
+}
+
+
+template<std::size_t N>
+constexpr void first_tile(
+    const std::array<std::size_t, N>& shape,
+    const std::array<std::size_t, N>& tile,
+    std::array<std::size_t, N>& first,
+    std::array<std::size_t, N>& last
+) noexcept {
+    for (std::size_t i = 0; i < N; ++i) {
+        first[i] = 0;
+        last[i] = tile[i] < shape[i] ? tile[i] : shape[i];
+    }
+}
+
+
+// Advances [first, last) to the next tile in row-major order. Returns false
+// after the last tile.
+template<std::size_t N>
+constexpr bool next_tile(
+    const std::array<std::size_t, N>& shape,
+    const std::array<std::size_t, N>& tile,
+    std::array<std::size_t, N>& first,
+    std::array<std::size_t, N>& last
+) noexcept {
+    std::size_t dim = N;
+    while (dim-- > 0) {
+        if (last[dim] < shape[dim]) {
+            first[dim] = last[dim];
+            last[dim] = shape[dim] - first[dim] > tile[dim] ?
+                first[dim] + tile[dim] : shape[dim];
+            return true;
+        }
+
+        first[dim] = 0;
+        last[dim] = tile[dim] < shape[dim] ? tile[dim] : shape[dim];
+    }
+
+    return false;
+}
+
+
+// Advances the multi-index over dimensions [0, dim_end) within the tile,
+// updating the offset along with it. Returns false once all indices wrapped
+// back to the start of the tile.
+template<std::size_t N>
+constexpr bool next_index(
+    ndindex<N>& idx,
+    std::size_t dim_end,
+    const std::array<std::size_t, N>& strides,
+    const std::array<std::size_t, N>& first,
+    const std::array<std::size_t, N>& last
+) noexcept {
+    std::size_t dim = dim_end;
+    while (dim-- > 0) {
+        if (++idx.index[dim] < last[dim]) {
+            idx.offset += strides[dim];
+            return true;
+        }
+
+        idx.index[dim] = first[dim];
+        idx.offset -= (last[dim] - 1 - first[dim]) * strides[dim];
+    }
+
+    return false;
+}
+
+} // namespace detail
+
+
+template<std::size_t N>
+constexpr std::size_t ndindex<N>::operator[](
+    std::size_t dim
+) const noexcept {
+    assert(dim < N);
+
+    return index[dim];
+}
+
+
+template<std::size_t N>
+constexpr ndrange<N>::ndrange(
+    const std::array<std::size_t, N>& shape_
+) noexcept :
+    ndrange{shape_, shape_}
+{
+}
+
+
+template<std::size_t N>
+constexpr ndrange<N>::ndrange(
+    const std::array<std::size_t, N>& shape_,
+    const std::array<std::size_t, N>& tile_
+) noexcept :
+    _shape{shape_},
+    _tile{tile_},
+    _strides{}
+{
+    std::size_t stride = 1;
+    for (std::size_t i = N; i-- > 0;) {
+        // A tile extent of 0 is only meaningful for an empty dimension
+        assert(_tile[i] > 0 || _shape[i] == 0);
+
+        _strides[i] = stride;
+        stride *= _shape[i];
+    }
+}
+
+
+template<std::size_t N>
+constexpr const std::array<std::size_t, N>& ndrange<N>::shape(
+) const noexcept {
+    return _shape;
+}
+
+
+template<std::size_t N>
+constexpr const std::array<std::size_t, N>& ndrange<N>::tile(
+) const noexcept {
+    return _tile;
+}
+
+
+template<std::size_t N>
+constexpr const std::array<std::size_t, N>& ndrange<N>::strides(
+) const noexcept {
+    return _strides;
+}
+
+
+template<std::size_t N>
+constexpr std::size_t ndrange<N>::element_count() const noexcept {
+    std::size_t count = 1;
+    for (std::size_t i = 0; i < N; ++i) {
+        count *= _shape[i];
+    }
+
+    return count;
+}
+
+
+template<std::size_t N>
+constexpr typename ndrange<N>::iterator ndrange<N>::begin() const noexcept {
+    iterator it;
+    it._range = this;
+    detail::first_tile(_shape, _tile, it._tile_first, it._tile_last);
+
+    return it;
+}
+
+
+template<std::size_t N>
+constexpr typename ndrange<N>::iterator ndrange<N>::end() const noexcept {
+    iterator it;
+    it._range = this;
+    it._position = this->element_count();
+
+    return it;
+}
+
+
+template<std::size_t N>
+constexpr typename ndrange<N>::iterator::reference
+ndrange<N>::iterator::operator*() const noexcept {
+    return _current;
+}
+
+
+template<std::size_t N>
+constexpr typename ndrange<N>::iterator::pointer
+ndrange<N>::iterator::operator->() const noexcept {
+    return &_current;
+}
+
+
+template<std::size_t N>
+constexpr typename ndrange<N>::iterator&
+ndrange<N>::iterator::operator++() noexcept {
+    ++_position;
+
+    const bool in_tile = detail::next_index(
+        _current, N, _range->_strides, _tile_first, _tile_last
+    );
+    if (!in_tile) {
+        detail::next_tile(
+            _range->_shape, _range->_tile, _tile_first, _tile_last
+        );
+        _current.index = _tile_first;
+        _current.offset = detail::dot(_tile_first, _range->_strides);
+    }
+
+    return *this;
+}
+
+
+template<std::size_t N>
+constexpr typename ndrange<N>::iterator
+ndrange<N>::iterator::operator++(int) noexcept {
+    iterator old = *this;
+    ++*this;
+
+    return old;
+}
+
+
+template<std::size_t N>
+constexpr bool ndrange<N>::iterator::operator==(
+    const iterator& other
+) const noexcept {
+    return _position == other._position;
+}
+
+
+template<std::size_t N>
+constexpr bool ndrange<N>::iterator::operator!=(
+    const iterator& other
+) const noexcept {
+    return !(*this == other);
+}
+
+
+template<std::size_t N, typename F>
+constexpr void for_each_row(const ndrange<N>& range, F&& f) {
+    if (range.element_count() == 0) return;
+
+    const std::array<std::size_t, N>& strides = range.strides();
+
+    std::array<std::size_t, N> first{};
+    std::array<std::size_t, N> last{};
+    detail::first_tile(range.shape(), range.tile(), first, last);
+
+    do {
+        ndindex<N> row{first, detail::dot(first, strides)};
+        const std::size_t count = last[N - 1] - first[N - 1];
+
+        do {
+            f(std::as_const(row), count);
+        } while (detail::next_index(row, N - 1, strides, first, last));
+    } while (detail::next_tile(range.shape(), range.tile(), first, last));
+}
+
+
+// The innermost index and offset are kept in locals, so that compilers see a
+// plain counted loop that they can vectorize once f is inlined.
+template<std::size_t N, typename F>
+constexpr void for_each_index(const ndrange<N>& range, F&& f) {
+    vt::for_each_row(range, [&f](const ndindex<N>& row, std::size_t count) {
+        ndindex<N> idx = row;
+        for (std::size_t j = 0; j < count; ++j) {
+            idx.index[N - 1] = row.index[N - 1] + j;
+            idx.offset = row.offset + j;
+            f(std::as_const(idx));
+        }
+    });
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_RANGE_IPP_
@@ -0,0 +1,373 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_RING_IPP_
+#define VT_NDARRAY_IMPL_RING_IPP_
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+
+
+namespace vt {
+
+namespace detail {
+
+// Number of failed attempts after which the blocking calls start yielding
+// to other threads
+constexpr int ring_spin_count = 64;
+
+
+template<typename F>
+auto retry_until_available(F&& try_once) noexcept {
+    for (int attempt = 0;; ++attempt) {
+        auto result = try_once();
+        if (result) return *result;
+        if (attempt >= ring_spin_count) std::this_thread::yield();
+    }
+}
+
+
+inline spsc_positions::spsc_positions(
+    std::atomic<std::uint64_t>* head,
+    std::atomic<std::uint64_t>* tail,
+    std::size_t capacity
+) noexcept :
+    _head{head},
+    _tail{tail},
+    _capacity{capacity},
+    _cached_head{head->load(std::memory_order_acquire)},
+    _cached_tail{tail->load(std::memory_order_acquire)}
+{
+    assert(capacity > 0);
+}
+
+
+inline std::optional<std::uint64_t> spsc_positions::try_begin_write(
+) noexcept {
+    const std::uint64_t head = _head->load(std::memory_order_relaxed);
+
+    if (head - _cached_tail == _capacity) {
+        _cached_tail = _tail->load(std::memory_order_acquire);
+        if (head - _cached_tail == _capacity) return std::nullopt;
+    }
+
+    return head;
+}
+
+
+inline void spsc_positions::end_write() noexcept {
+    _head->store(_head->load(std::memory_order_relaxed) + 1,
+        std::memory_order_release);
+}
+
+
+inline std::optional<std::uint64_t> spsc_positions::try_begin_read(
+) noexcept {
+    const std::uint64_t tail = _tail->load(std::memory_order_relaxed);
+
+    if (tail == _cached_head) {
+        _cached_head = _head->load(std::memory_order_acquire);
+        if (tail == _cached_head) return std::nullopt;
+    }
+
+    return tail;
+}
+
+
+inline void spsc_positions::end_read() noexcept {
+    _tail->store(_tail->load(std::memory_order_relaxed) + 1,
+        std::memory_order_release);
+}
+
+
+inline std::size_t spsc_positions::capacity() const noexcept {
+    return _capacity;
+}
+
+
+// Rounds frames up to a whole number of lines in bytes, so that a producer
+// and a consumer of adjacent frames do not share a cache line
+template<typename T>
+constexpr std::size_t ring_frame_stride(std::size_t frame_size) noexcept {
+    constexpr std::size_t line = ring_line_size / std::gcd(
+        sizeof(T), ring_line_size
+    );
+
+    return (frame_size + line - 1) / line * line;
+}
+
+
+template<typename T, std::size_t N>
+ring_frames<T, N>::ring_frames(
+    const std::array<std::size_t, N>& frame_shape,
+    std::size_t capacity
+) :
+    _frame_shape{frame_shape},
+    _capacity{capacity},
+    _frame_stride{ring_frame_stride<T>(count_elements(frame_shape))},
+    _elements(
+        std::array<std::size_t, 1>{ capacity * _frame_stride },
+        ndarray_allocator<T>{
+            std::align_val_t{std::max(ring_line_size, alignof(T))}
+        }
+    )
+{
+    assert(capacity > 0);
+}
+
+
+template<typename T, std::size_t N>
+ndview<T, N> ring_frames<T, N>::operator[](std::uint64_t position) noexcept {
+    const std::size_t frame = position % _capacity;
+
+    return { _frame_shape, _elements.data() + frame * _frame_stride };
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& ring_frames<T, N>::frame_shape(
+) const noexcept {
+    return _frame_shape;
+}
+
+} // namespace detail
+
+
+template<typename T, std::size_t N>
+spsc_frame_ring<T, N>::spsc_frame_ring(
+    const std::array<std::size_t, N>& frame_shape_,
+    std::size_t capacity_
+) :
+    _head{},
+    _tail{},
+    _producer{&_head.value, &_tail.value, capacity_},
+    _consumer{&_head.value, &_tail.value, capacity_},
+    _frames{frame_shape_, capacity_}
+{
+}
+
+
+template<typename T, std::size_t N>
+std::optional<ndview<T, N>> spsc_frame_ring<T, N>::try_begin_write(
+) noexcept {
+    const std::optional<std::uint64_t> position = _producer.try_begin_write();
+    if (!position) return std::nullopt;
+
+    return _frames[*position];
+}
+
+
+template<typename T, std::size_t N>
+ndview<T, N> spsc_frame_ring<T, N>::begin_write() noexcept {
+    return detail::retry_until_available([this] {
+        return this->try_begin_write();
+    });
+}
+
+
+template<typename T, std::size_t N>
+void spsc_frame_ring<T, N>::end_write() noexcept {
+    _producer.end_write();
+}
+
+
+template<typename T, std::size_t N>
+std::optional<ndview<const T, N>> spsc_frame_ring<T, N>::try_begin_read(
+) noexcept {
+    const std::optional<std::uint64_t> position = _consumer.try_begin_read();
+    if (!position) return std::nullopt;
+
+    return ndview<const T, N>{_frames[*position]};
+}
+
+
+template<typename T, std::size_t N>
+ndview<const T, N> spsc_frame_ring<T, N>::begin_read() noexcept {
+    return detail::retry_until_available([this] {
+        return this->try_begin_read();
+    });
+}
+
+
+template<typename T, std::size_t N>
+void spsc_frame_ring<T, N>::end_read() noexcept {
+    _consumer.end_read();
+}
+
+
+template<typename T, std::size_t N>
+std::size_t spsc_frame_ring<T, N>::capacity() const noexcept {
+    return _producer.capacity();
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& spsc_frame_ring<T, N>::frame_shape(
+) const noexcept {
+    return _frames.frame_shape();
+}
+
+
+template<typename T, std::size_t N>
+ring_frame<T, N>::ring_frame(
+    ndview<T, N> view_,
+    std::uint64_t position
+) noexcept :
+    _view{view_},
+    _position{position}
+{
+}
+
+
+template<typename T, std::size_t N>
+ring_frame<T, N>::operator ndview<T, N>() const noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N>
+ndview<T, N> ring_frame<T, N>::view() const noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N>
+mpmc_frame_ring<T, N>::mpmc_frame_ring(
+    const std::array<std::size_t, N>& frame_shape_,
+    std::size_t capacity_
+) :
+    _head{},
+    _tail{},
+    _sequences{new detail::padded_counter[capacity_]},
+    _capacity{capacity_},
+    _frames{frame_shape_, capacity_}
+{
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        _sequences[i].value.store(i, std::memory_order_relaxed);
+    }
+}
+
+
+// Bounded queue of D. Vyukov: a frame at position p may be written when its
+// sequence is p, and read when its sequence is p + 1. Claiming a position
+// takes a single compare-and-swap when there is no contention.
+template<typename T, std::size_t N>
+std::optional<ring_frame<T, N>> mpmc_frame_ring<T, N>::try_begin_write(
+) noexcept {
+    std::uint64_t head = _head.value.load(std::memory_order_relaxed);
+
+    for (;;) {
+        const std::uint64_t sequence = _sequences[head % _capacity].value.load(
+            std::memory_order_acquire
+        );
+
+        if (sequence == head) {
+            if (_head.value.compare_exchange_weak(
+                    head, head + 1, std::memory_order_relaxed)) {
+                return ring_frame<T, N>{_frames[head], head};
+            }
+        } else if (sequence < head) {
+            // The frame has not been read since the previous round
+            return std::nullopt;
+        } else {
+            head = _head.value.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+
+template<typename T, std::size_t N>
+ring_frame<T, N> mpmc_frame_ring<T, N>::begin_write() noexcept {
+    return detail::retry_until_available([this] {
+        return this->try_begin_write();
+    });
+}
+
+
+template<typename T, std::size_t N>
+void mpmc_frame_ring<T, N>::end_write(const ring_frame<T, N>& frame) noexcept {
+    _sequences[frame._position % _capacity].value.store(
+        frame._position + 1, std::memory_order_release
+    );
+}
+
+
+template<typename T, std::size_t N>
+std::optional<ring_frame<const T, N>> mpmc_frame_ring<T, N>::try_begin_read(
+) noexcept {
+    std::uint64_t tail = _tail.value.load(std::memory_order_relaxed);
+
+    for (;;) {
+        const std::uint64_t sequence = _sequences[tail % _capacity].value.load(
+            std::memory_order_acquire
+        );
+
+        if (sequence == tail + 1) {
+            if (_tail.value.compare_exchange_weak(
+                    tail, tail + 1, std::memory_order_relaxed)) {
+                return ring_frame<const T, N>{_frames[tail], tail};
+            }
+        } else if (sequence < tail + 1) {
+            // The frame has not been written yet
+            return std::nullopt;
+        } else {
+            tail = _tail.value.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+
+template<typename T, std::size_t N>
+ring_frame<const T, N> mpmc_frame_ring<T, N>::begin_read() noexcept {
+    return detail::retry_until_available([this] {
+        return this->try_begin_read();
+    });
+}
+
+
+template<typename T, std::size_t N>
+void mpmc_frame_ring<T, N>::end_read(
+    const ring_frame<const T, N>& frame
+) noexcept {
+    _sequences[frame._position % _capacity].value.store(
+        frame._position + _capacity, std::memory_order_release
+    );
+}
+
+
+template<typename T, std::size_t N>
+std::size_t mpmc_frame_ring<T, N>::capacity() const noexcept {
+    return _capacity;
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& mpmc_frame_ring<T, N>::frame_shape(
+) const noexcept {
+    return _frames.frame_shape();
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_RING_IPP_
@@ -0,0 +1,464 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_SCAN_IPP_
+#define VT_NDARRAY_IMPL_SCAN_IPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/impl/config.ipp>
+#include <vt/ndarray/impl/parallel.ipp>
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <vector>
+
+#if VT_NDARRAY_SSE2
+#   include <immintrin.h>
+#endif
+
+
+namespace vt {
+
+namespace detail {
+
+// Number of columns that are accumulated at once when scanning along an axis
+// other than the last one
+constexpr std::size_t scan_chunk = 64;
+
+// Minimum number of elements per thread for splitting a single lane
+constexpr std::size_t parallel_scan_min_size = 1 << 16;
+
+
+template<typename T, typename Source>
+constexpr bool simd_scannable_v = VT_NDARRAY_SSE2 &&
+    std::is_same_v<T, Source> && !std::is_same_v<T, bool> &&
+    (std::is_same_v<T, float> || std::is_same_v<T, double> ||
+        (std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)));
+
+
+#if VT_NDARRAY_SSE2
+
+template<typename T>
+__m128i simd_add(__m128i a, __m128i b) noexcept {
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm_castps_si128(
+            _mm_add_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))
+        );
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm_castpd_si128(
+            _mm_add_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b))
+        );
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_add_epi32(a, b);
+    } else {
+        return _mm_add_epi64(a, b);
+    }
+}
+
+
+// In-register inclusive scan: shifts the vector by one and two elements and
+// adds it to itself
+template<typename T>
+__m128i simd_prefix(__m128i x) noexcept {
+    x = simd_add<T>(x, _mm_slli_si128(x, sizeof(T)));
+    if constexpr (sizeof(T) == 4) {
+        x = simd_add<T>(x, _mm_slli_si128(x, 8));
+    }
+
+    return x;
+}
+
+
+template<typename T>
+__m128i simd_broadcast_last(__m128i x) noexcept {
+    if constexpr (sizeof(T) == 4) {
+        return _mm_shuffle_epi32(x, 0xFF);
+    } else {
+        return _mm_shuffle_epi32(x, 0xEE);
+    }
+}
+
+#endif
+
+
+// Scans a contiguous lane, starting at carry. If above is not null, it is
+// added element-wise to the result, which fuses the two passes of an
+// integral image. Returns the carry after the last element.
+template<bool Exclusive, typename T, typename Source>
+T scan_contiguous(
+    const Source* src,
+    T* dst,
+    std::size_t length,
+    T carry,
+    nondeduced_t<const T*> above
+) noexcept {
+    std::size_t i = 0;
+
+#if VT_NDARRAY_SSE2
+    if constexpr (simd_scannable_v<T, Source>) {
+        constexpr std::size_t lanes = 16 / sizeof(T);
+
+        alignas(16) T buffer[lanes];
+        std::fill_n(buffer, lanes, carry);
+        __m128i sum = _mm_load_si128(reinterpret_cast<const __m128i*>(buffer));
+
+        for (; i + lanes <= length; i += lanes) {
+            const __m128i local = simd_prefix<T>(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))
+            );
+            __m128i out = simd_add<T>(
+                Exclusive ? _mm_slli_si128(local, sizeof(T)) : local, sum
+            );
+            if (above != nullptr) {
+                out = simd_add<T>(out, _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(above + i)
+                ));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+            sum = simd_add<T>(sum, simd_broadcast_last<T>(local));
+        }
+
+        _mm_store_si128(reinterpret_cast<__m128i*>(buffer), sum);
+        carry = buffer[0];
+    }
+#endif
+
+    for (; i < length; ++i) {
+        const Source x = src[i];
+        T out;
+        if constexpr (Exclusive) {
+            out = carry;
+            carry += x;
+        } else {
+            carry += x;
+            out = carry;
+        }
+        dst[i] = above != nullptr ? out + above[i] : out;
+    }
+
+    return carry;
+}
+
+
+// Scans `width` adjacent lanes that are `inner` apart, starting at carry
+template<bool Exclusive, typename T, typename Source, typename Width>
+void scan_chunk_columns(
+    const Source* src,
+    T* dst,
+    std::size_t length,
+    std::size_t inner,
+    const T* carry,
+    Width width
+) noexcept {
+    // Accumulating in a local array lets the compiler vectorize the loops,
+    // even when the scan is in-place.
+    T acc[scan_chunk];
+    std::copy_n(carry, width, acc);
+
+    for (std::size_t k = 0; k < length; ++k) {
+        const Source* s = src + k * inner;
+        T* d = dst + k * inner;
+
+        if constexpr (Exclusive) {
+            Source x[scan_chunk];
+            std::copy_n(s, width, x);
+            std::copy_n(acc, width, d);
+            for (std::size_t j = 0; j < width; ++j) {
+                acc[j] += x[j];
+            }
+        } else {
+            for (std::size_t j = 0; j < width; ++j) {
+                acc[j] += s[j];
+            }
+            std::copy_n(acc, width, d);
+        }
+    }
+}
+
+
+// Scans the `inner` lanes of a block of length * inner elements, starting
+// at the `inner` values in carry
+template<bool Exclusive, typename T, typename Source>
+void scan_block(
+    const Source* src,
+    T* dst,
+    std::size_t length,
+    std::size_t inner,
+    const T* carry
+) noexcept {
+    if (inner == 1) {
+        scan_contiguous<Exclusive>(src, dst, length, carry[0], nullptr);
+        return;
+    }
+
+    for (std::size_t c = 0; c < inner; c += scan_chunk) {
+        if (inner - c >= scan_chunk) {
+            scan_chunk_columns<Exclusive>(
+                src + c, dst + c, length, inner, carry + c,
+                std::integral_constant<std::size_t, scan_chunk>{}
+            );
+        } else {
+            scan_chunk_columns<Exclusive>(
+                src + c, dst + c, length, inner, carry + c, inner - c
+            );
+        }
+    }
+}
+
+
+template<typename T, typename Source, typename Width>
+void sum_chunk_columns(
+    const Source* src,
+    std::size_t length,
+    std::size_t inner,
+    T* total,
+    Width width
+) noexcept {
+    T acc[scan_chunk];
+    std::copy_n(total, width, acc);
+
+    for (std::size_t k = 0; k < length; ++k) {
+        const Source* s = src + k * inner;
+        for (std::size_t j = 0; j < width; ++j) {
+            acc[j] += s[j];
+        }
+    }
+
+    std::copy_n(acc, width, total);
+}
+
+
+// Adds the sums of the `inner` lanes of a block of length * inner elements
+// to total
+template<typename T, typename Source>
+void sum_block(
+    const Source* src,
+    std::size_t length,
+    std::size_t inner,
+    T* total
+) noexcept {
+    if (inner == 1) {
+        // Sums interleaved partial sums of a single lane
+        T acc[scan_chunk] = {};
+        const std::size_t rows = length / scan_chunk;
+        sum_chunk_columns(
+            src, rows, scan_chunk, acc,
+            std::integral_constant<std::size_t, scan_chunk>{}
+        );
+        for (std::size_t i = rows * scan_chunk; i < length; ++i) {
+            acc[0] += src[i];
+        }
+        for (const T& a : acc) {
+            total[0] += a;
+        }
+        return;
+    }
+
+    for (std::size_t c = 0; c < inner; c += scan_chunk) {
+        if (inner - c >= scan_chunk) {
+            sum_chunk_columns(
+                src + c, length, inner, total + c,
+                std::integral_constant<std::size_t, scan_chunk>{}
+            );
+        } else {
+            sum_chunk_columns(src + c, length, inner, total + c, inner - c);
+        }
+    }
+}
+
+
+template<bool Exclusive, typename T, typename Source, std::size_t N>
+void scan(
+    ndview<const Source, N> src,
+    ndview<T, N> dst,
+    T init,
+    std::size_t axis,
+    std::size_t thread_count
+) {
+    assert(src.shape() == dst.shape());
+
+    const lane_layout layout = get_lane_layout(src.shape(), axis);
+    const std::size_t block = layout.length * layout.inner;
+    const std::size_t part_count = std::min(
+        resolve_thread_count(thread_count),
+        std::max<std::size_t>(src.element_count() / parallel_scan_min_size, 1)
+    );
+
+    if (layout.outer >= part_count) {
+        // Every block starts at init. The carry is only read, so the threads
+        // share it, and it is allocated before they start.
+        const std::vector<T> carry(layout.inner, init);
+        parallel_for(layout.outer, part_count, [&](
+            std::size_t begin, std::size_t end
+        ) {
+            for (std::size_t o = begin; o < end; ++o) {
+                scan_block<Exclusive>(
+                    src.data() + o * block, dst.data() + o * block,
+                    layout.length, layout.inner, carry.data()
+                );
+            }
+        });
+        return;
+    }
+
+    // Splits every block along the axis. The first pass sums the parts, the
+    // second pass scans every part, starting at the sum of the preceding
+    // parts.
+    ndarray<T, 2> carries({ part_count, layout.inner });
+    const auto part_begin = [&](std::size_t part) {
+        return layout.length * part / part_count * layout.inner;
+    };
+
+    for (std::size_t o = 0; o < layout.outer; ++o) {
+        const Source* s = src.data() + o * block;
+        T* d = dst.data() + o * block;
+
+        std::fill(carries.begin(), carries.end(), T{});
+        parallel_invoke(part_count - 1, [&](std::size_t part) {
+            sum_block(
+                s + part_begin(part),
+                (part_begin(part + 1) - part_begin(part)) / layout.inner,
+                layout.inner, carries[part + 1].data()
+            );
+        });
+
+        std::fill_n(carries[0].data(), layout.inner, init);
+        for (std::size_t part = 1; part < part_count; ++part) {
+            for (std::size_t j = 0; j < layout.inner; ++j) {
+                carries[part][j] += carries[part - 1][j];
+            }
+        }
+
+        parallel_invoke(part_count, [&](std::size_t part) {
+            scan_block<Exclusive>(
+                s + part_begin(part), d + part_begin(part),
+                (part_begin(part + 1) - part_begin(part)) / layout.inner,
+                layout.inner, carries[part].data()
+            );
+        });
+    }
+}
+
+} // namespace detail
+
+
+template<typename T, typename Source, std::size_t N>
+void inclusive_scan(
+    detail::nondeduced_t<ndview<const Source, N>> src,
+    ndview<T, N> dst,
+    std::size_t axis,
+    std::size_t thread_count
+) {
+    detail::scan<false>(src, dst, T{}, axis, thread_count);
+}
+
+
+template<typename T, typename Source, std::size_t N>
+void exclusive_scan(
+    detail::nondeduced_t<ndview<const Source, N>> src,
+    ndview<T, N> dst,
+    detail::nondeduced_t<T> init,
+    std::size_t axis,
+    std::size_t thread_count
+) {
+    detail::scan<true>(src, dst, init, axis, thread_count);
+}
+
+
+template<typename T, typename Source>
+void integral_image(
+    detail::nondeduced_t<ndview<const Source, 2>> src,
+    ndview<T, 2> dst,
+    std::size_t thread_count
+) {
+    assert(src.shape() == dst.shape());
+
+    const std::size_t rows = src.shape(0);
+    const std::size_t cols = src.shape(1);
+    const std::size_t part_count = std::min({
+        detail::resolve_thread_count(thread_count),
+        std::max<std::size_t>(
+            src.element_count() / detail::parallel_scan_min_size, 1
+        ),
+        std::max<std::size_t>(rows, 1)
+    });
+    const auto part_begin = [&](std::size_t part) {
+        return rows * part / part_count;
+    };
+
+    // The first pass sums the columns of every part of the rows. The first
+    // row of every part then starts from the integral image of the rows
+    // above it.
+    ndarray<T, 2> column_sums({ part_count, cols }, T{});
+    detail::parallel_invoke(part_count - 1, [&](std::size_t part) {
+        detail::sum_block(
+            src.data() + part_begin(part) * cols,
+            part_begin(part + 1) - part_begin(part), cols,
+            column_sums[part + 1].data()
+        );
+    });
+
+    ndarray<T, 2> tops({ part_count, cols });
+    for (std::size_t part = 1; part < part_count; ++part) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            column_sums[part][j] += column_sums[part - 1][j];
+        }
+        detail::scan_contiguous<false>(
+            column_sums[part].data(), tops[part].data(), cols, T{}, nullptr
+        );
+    }
+
+    detail::parallel_invoke(part_count, [&](std::size_t part) {
+        const T* above = part > 0 ? tops[part].data() : nullptr;
+        for (std::size_t r = part_begin(part); r < part_begin(part + 1);
+                ++r) {
+            detail::scan_contiguous<false>(
+                src.data() + r * cols, dst.data() + r * cols, cols, T{}, above
+            );
+            above = dst.data() + r * cols;
+        }
+    });
+}
+
+
+template<typename T>
+T box_sum(
+    detail::nondeduced_t<ndview<const T, 2>> integral,
+    std::size_t row_begin,
+    std::size_t col_begin,
+    std::size_t row_end,
+    std::size_t col_end
+) noexcept {
+    assert(row_begin <= row_end && row_end <= integral.shape(0));
+    assert(col_begin <= col_end && col_end <= integral.shape(1));
+
+    // Sum of the elements before row r and column c
+    const auto corner = [&](std::size_t r, std::size_t c) {
+        return r > 0 && c > 0 ? integral[r - 1][c - 1] : T{};
+    };
+
+    return corner(row_end, col_end) - corner(row_begin, col_end) -
+        corner(row_end, col_begin) + corner(row_begin, col_begin);
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_SCAN_IPP_
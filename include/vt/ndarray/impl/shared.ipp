@@ -0,0 +1,359 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_SHARED_IPP_
+#define VT_NDARRAY_IMPL_SHARED_IPP_
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+
+namespace vt {
+
+template<typename T, std::size_t N, typename Allocator>
+struct shared_ndarray<T, N, Allocator>::block {
+    explicit block(array_type&& array_) noexcept :
+        use_count{1},
+        array{std::move(array_)}
+    {
+    }
+
+    std::atomic<std::size_t> use_count;
+    array_type array;
+};
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>::shared_ndarray() noexcept :
+    _block{nullptr},
+    _view{{ 0 }, nullptr}
+{
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>::shared_ndarray(
+    const std::array<std::size_t, N>& shape_,
+    const Allocator& alloc
+) :
+    shared_ndarray{array_type{shape_, alloc}}
+{
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>::shared_ndarray(
+    const std::array<std::size_t, N>& shape_,
+    const T& init,
+    const Allocator& alloc
+) :
+    shared_ndarray{array_type{shape_, init, alloc}}
+{
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>::shared_ndarray(
+    const std::array<std::size_t, N>& shape_,
+    std::initializer_list<T> init,
+    const Allocator& alloc
+) :
+    shared_ndarray{array_type{shape_, init, alloc}}
+{
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>::shared_ndarray(array_type&& array) :
+    _block{new block{std::move(array)}},
+    _view{_block->array.cview()}
+{
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>::shared_ndarray(
+    const shared_ndarray& other
+) noexcept :
+    _block{other._block},
+    _view{other._view}
+{
+    // Incrementing can be relaxed, since a new reference can only be created
+    // from an existing one, which already keeps the buffer alive.
+    if (_block != nullptr) {
+        _block->use_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>::shared_ndarray(
+    shared_ndarray&& other
+) noexcept :
+    _block{std::exchange(other._block, nullptr)},
+    _view{std::exchange(other._view, { { 0 }, nullptr })}
+{
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>::~shared_ndarray() {
+    this->release();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>& shared_ndarray<T, N, Allocator>::operator=(
+    const shared_ndarray& other
+) noexcept {
+    shared_ndarray{other}.swap(*this);
+    return *this;
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>& shared_ndarray<T, N, Allocator>::operator=(
+    shared_ndarray&& other
+) noexcept {
+    shared_ndarray{std::move(other)}.swap(*this);
+    return *this;
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+decltype(auto) shared_ndarray<T, N, Allocator>::operator[](std::size_t idx) {
+    return this->view()[idx];
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+decltype(auto) shared_ndarray<T, N, Allocator>::operator[](
+    std::size_t idx
+) const noexcept {
+    return _view[idx];
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray<T, N, Allocator>::operator ndview<const T, N>(
+) const noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+ndview<T, N> shared_ndarray<T, N, Allocator>::view() {
+    this->detach();
+
+    if (_block == nullptr) return { _view.shape(), nullptr };
+
+    return _block->array.view();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+ndview<const T, N> shared_ndarray<T, N, Allocator>::view() const noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+ndview<const T, N> shared_ndarray<T, N, Allocator>::cview() const noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+std::size_t shared_ndarray<T, N, Allocator>::element_count() const noexcept {
+    return _view.element_count();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+const std::array<std::size_t, N>& shared_ndarray<T, N, Allocator>::shape(
+) const noexcept {
+    return _view.shape();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+std::size_t shared_ndarray<T, N, Allocator>::shape(
+    std::size_t dim
+) const noexcept {
+    return _view.shape(dim);
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+T* shared_ndarray<T, N, Allocator>::data() {
+    return this->view().data();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+const T* shared_ndarray<T, N, Allocator>::data() const noexcept {
+    return _view.data();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+typename shared_ndarray<T, N, Allocator>::iterator
+shared_ndarray<T, N, Allocator>::begin() {
+    return this->view().begin();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+typename shared_ndarray<T, N, Allocator>::const_iterator
+shared_ndarray<T, N, Allocator>::begin() const noexcept {
+    return _view.cbegin();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+typename shared_ndarray<T, N, Allocator>::const_iterator
+shared_ndarray<T, N, Allocator>::cbegin() const noexcept {
+    return _view.cbegin();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+typename shared_ndarray<T, N, Allocator>::iterator
+shared_ndarray<T, N, Allocator>::end() {
+    return this->view().end();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+typename shared_ndarray<T, N, Allocator>::const_iterator
+shared_ndarray<T, N, Allocator>::end() const noexcept {
+    return _view.cend();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+typename shared_ndarray<T, N, Allocator>::const_iterator
+shared_ndarray<T, N, Allocator>::cend() const noexcept {
+    return _view.cend();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+std::size_t shared_ndarray<T, N, Allocator>::use_count() const noexcept {
+    if (_block == nullptr) return 0;
+
+    return _block->use_count.load(std::memory_order_relaxed);
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+bool shared_ndarray<T, N, Allocator>::unique() const noexcept {
+    // Acquire ordering makes sure that any accesses through references that
+    // have since been released happen before our subsequent writes.
+    return _block != nullptr &&
+        _block->use_count.load(std::memory_order_acquire) == 1;
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+void shared_ndarray<T, N, Allocator>::detach() {
+    if (_block == nullptr || this->unique()) return;
+
+    block* copy = new block{array_type{_block->array}};
+
+    this->release();
+    _block = copy;
+    _view = _block->array.cview();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+typename shared_ndarray<T, N, Allocator>::array_type
+shared_ndarray<T, N, Allocator>::to_ndarray() const {
+    if (_block == nullptr) return array_type{};
+
+    return _block->array;
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+void shared_ndarray<T, N, Allocator>::swap(
+    shared_ndarray<T, N, Allocator>& other
+) noexcept {
+    using std::swap;
+
+    swap(_block, other._block);
+    swap(_view, other._view);
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+void shared_ndarray<T, N, Allocator>::release() noexcept {
+    if (_block == nullptr) return;
+
+    if (_block->use_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete _block;
+    }
+    _block = nullptr;
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+bool operator==(
+    const shared_ndarray<T, N, Allocator>& a,
+    const shared_ndarray<T, N, Allocator>& b
+) {
+    if (a.shape() != b.shape()) return false;
+    if (a.data() == b.data()) return true;
+
+    return std::equal(a.begin(), a.end(), b.begin());
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+bool operator!=(
+    const shared_ndarray<T, N, Allocator>& a,
+    const shared_ndarray<T, N, Allocator>& b
+) {
+    return !(a == b);
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+std::ostream& operator<<(
+    std::ostream& os,
+    const shared_ndarray<T, N, Allocator>& a
+) {
+    return os << a.cview();
+}
+
+
+template<typename T, std::size_t N, typename Allocator>
+void swap(
+    shared_ndarray<T, N, Allocator>& a,
+    shared_ndarray<T, N, Allocator>& b
+) noexcept {
+    a.swap(b);
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_SHARED_IPP_
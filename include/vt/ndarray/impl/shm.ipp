@@ -0,0 +1,596 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_SHM_IPP_
+#define VT_NDARRAY_IMPL_SHM_IPP_
+
+#include <vt/ndarray/format.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace vt {
+
+namespace detail {
+
+constexpr std::uint32_t shm_magic = 0x48535456; // "VTSH" on little endian
+constexpr std::uint8_t shm_version = 1;
+
+
+// Start of a shared memory object:
+//
+//   0    header
+//   24   shape (N x uint64)
+//        for a ring, the producer and consumer positions, each on its own
+//        line of ring_line_size bytes
+//        elements, starting at data_offset; the frames of a ring are
+//        padded to whole lines, as in ring_frames
+//
+// The magic number is stored last by the creator, so that a process that
+// attaches too early does not see a partially written header.
+struct shm_header {
+    std::atomic<std::uint32_t> magic;
+    std::uint8_t version;
+    char kind;
+    std::uint8_t element_size;
+    std::uint8_t dim_count;
+    std::uint64_t data_offset;
+    // Number of frames of a ring, or 0 for an array
+    std::uint64_t capacity;
+};
+
+static_assert(sizeof(shm_header) == 24);
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+
+constexpr std::size_t round_up(std::size_t n, std::size_t multiple) noexcept {
+    return (n + multiple - 1) / multiple * multiple;
+}
+
+
+template<std::size_t N>
+constexpr std::size_t shm_counters_offset() noexcept {
+    return round_up(sizeof(shm_header) + N * sizeof(std::uint64_t),
+        ring_line_size);
+}
+
+
+template<typename T, std::size_t N>
+constexpr std::size_t shm_data_offset(bool ring) noexcept {
+    return round_up(
+        shm_counters_offset<N>() + (ring ? 2 * ring_line_size : 0),
+        std::max(ring_line_size, alignof(T))
+    );
+}
+
+
+// Number of elements from the start of a frame to the start of the next
+template<typename T, std::size_t N>
+std::size_t shm_frame_stride(
+    const std::array<std::size_t, N>& frame_shape,
+    bool ring
+) noexcept {
+    const std::size_t frame_size = count_elements(frame_shape);
+    return ring ? ring_frame_stride<T>(frame_size) : frame_size;
+}
+
+
+// Producer (0) or consumer (1) position of a ring
+template<std::size_t N>
+std::atomic<std::uint64_t>* shm_counter(
+    const shm_mapping& mapping,
+    std::size_t index
+) noexcept {
+    return static_cast<std::atomic<std::uint64_t>*>(static_cast<void*>(
+        mapping.data() + shm_counters_offset<N>() + index * ring_line_size
+    ));
+}
+
+
+template<std::size_t N>
+std::array<std::size_t, N> shm_shape(const shm_mapping& mapping) noexcept {
+    std::array<std::size_t, N> shape{};
+    for (std::size_t i = 0; i < N; ++i) {
+        std::uint64_t extent;
+        std::memcpy(&extent,
+            mapping.data() + sizeof(shm_header) + i * sizeof(extent),
+            sizeof(extent));
+        shape[i] = extent;
+    }
+
+    return shape;
+}
+
+
+inline const shm_header& get_shm_header(const shm_mapping& mapping) noexcept {
+    return *static_cast<const shm_header*>(
+        static_cast<const void*>(mapping.data())
+    );
+}
+
+
+template<typename T, std::size_t N>
+void write_shm_header(
+    const shm_mapping& mapping,
+    const std::array<std::size_t, N>& shape,
+    std::size_t capacity
+) noexcept {
+    unsigned char* base = mapping.data();
+
+    auto* header = new (base) shm_header{};
+    header->version = shm_version;
+    header->kind = binary_kind<T>();
+    header->element_size = static_cast<std::uint8_t>(sizeof(T));
+    header->dim_count = static_cast<std::uint8_t>(N);
+    header->data_offset = shm_data_offset<T, N>(capacity > 0);
+    header->capacity = capacity;
+
+    for (std::size_t i = 0; i < N; ++i) {
+        const std::uint64_t extent = shape[i];
+        std::memcpy(base + sizeof(shm_header) + i * sizeof(extent), &extent,
+            sizeof(extent));
+    }
+
+    if (capacity > 0) {
+        new (shm_counter<N>(mapping, 0)) std::atomic<std::uint64_t>{0};
+        new (shm_counter<N>(mapping, 1)) std::atomic<std::uint64_t>{0};
+    }
+
+    header->magic.store(shm_magic, std::memory_order_release);
+}
+
+
+// Checks the header written by write_shm_header and returns the shape
+template<typename T, std::size_t N>
+std::array<std::size_t, N> read_shm_header(
+    const shm_mapping& mapping,
+    bool ring
+) {
+    const auto fail = [&](const char* what) {
+        throw std::runtime_error{
+            "vt::shm: " + mapping.name() + ": " + what
+        };
+    };
+
+    if (mapping.size() < shm_data_offset<T, N>(ring)) fail("too small");
+
+    const shm_header* header = &get_shm_header(mapping);
+    if (header->magic.load(std::memory_order_acquire) != shm_magic) {
+        fail("not an ndarray, or not yet initialized");
+    }
+    if (header->version != shm_version) fail("unsupported version");
+    if (header->kind != binary_kind<T>() ||
+            header->element_size != sizeof(T) || header->dim_count != N) {
+        fail("element type or rank mismatch");
+    }
+    if ((header->capacity > 0) != ring) {
+        fail(ring ? "not a frame ring" : "not an array");
+    }
+
+    const std::array<std::size_t, N> shape = shm_shape<N>(mapping);
+    const std::uint64_t frame_count = ring ? header->capacity : 1;
+    // Leaves room to pad the frames to whole lines
+    if (header->data_offset != shm_data_offset<T, N>(ring) ||
+            frame_count > std::numeric_limits<std::size_t>::max() ||
+            !fits_in_memory<T>(shape, 2)) {
+        fail("invalid data offset or size");
+    }
+
+    const std::array<std::size_t, 1> frame_elements{
+        shm_frame_stride<T>(shape, ring)
+    };
+    if (!fits_in_memory<T>(frame_elements,
+                static_cast<std::size_t>(frame_count)) ||
+            mapping.size() - header->data_offset <
+                frame_count * frame_elements[0] * sizeof(T)) {
+        fail("invalid data offset or size");
+    }
+
+    return shape;
+}
+
+
+[[noreturn]] inline void throw_shm_error(
+    const char* what,
+    const std::string& name
+) {
+    throw std::system_error{
+        errno, std::generic_category(), std::string{"vt::shm: "} + what +
+            " " + name
+    };
+}
+
+
+inline shm_mapping::shm_mapping() noexcept :
+    _name{},
+    _data{nullptr},
+    _size{0},
+    _owner{false}
+{
+}
+
+
+inline shm_mapping::shm_mapping(shm_mapping&& other) noexcept :
+    _name{std::move(other._name)},
+    _data{std::exchange(other._data, nullptr)},
+    _size{std::exchange(other._size, 0)},
+    _owner{std::exchange(other._owner, false)}
+{
+}
+
+
+inline shm_mapping::~shm_mapping() {
+    this->release();
+}
+
+
+inline shm_mapping& shm_mapping::operator=(shm_mapping&& other) noexcept {
+    if (this != &other) {
+        this->release();
+        _name = std::move(other._name);
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+        _owner = std::exchange(other._owner, false);
+    }
+
+    return *this;
+}
+
+
+inline shm_mapping shm_mapping::create(
+    const std::string& name,
+    std::size_t size
+) {
+    const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) throw_shm_error("cannot create", name);
+
+    shm_mapping mapping;
+    mapping._name = name;
+    mapping._owner = true;
+
+    // The new object is filled with zeros
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        const int error = errno;
+        ::close(fd);
+        errno = error;
+        throw_shm_error("cannot resize", name);
+    }
+
+    void* data = ::mmap(
+        nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0
+    );
+    const int error = errno;
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        errno = error;
+        throw_shm_error("cannot map", name);
+    }
+
+    mapping._data = data;
+    mapping._size = size;
+
+    return mapping;
+}
+
+
+inline shm_mapping shm_mapping::open(const std::string& name, bool writable) {
+    const int fd = ::shm_open(name.c_str(), writable ? O_RDWR : O_RDONLY, 0);
+    if (fd < 0) throw_shm_error("cannot open", name);
+
+    struct stat status;
+    if (::fstat(fd, &status) != 0) {
+        const int error = errno;
+        ::close(fd);
+        errno = error;
+        throw_shm_error("cannot query", name);
+    }
+    const auto size = static_cast<std::size_t>(status.st_size);
+
+    void* data = size == 0 ? MAP_FAILED : ::mmap(
+        nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+        MAP_SHARED, fd, 0
+    );
+    const int error = size == 0 ? EINVAL : errno;
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        errno = error;
+        throw_shm_error("cannot map", name);
+    }
+
+    shm_mapping mapping;
+    mapping._name = name;
+    mapping._data = data;
+    mapping._size = size;
+
+    return mapping;
+}
+
+
+inline unsigned char* shm_mapping::data() const noexcept {
+    return static_cast<unsigned char*>(_data);
+}
+
+
+inline std::size_t shm_mapping::size() const noexcept {
+    return _size;
+}
+
+
+inline const std::string& shm_mapping::name() const noexcept {
+    return _name;
+}
+
+
+inline void shm_mapping::release() noexcept {
+    if (_data != nullptr) {
+        ::munmap(_data, _size);
+        _data = nullptr;
+    }
+    // Processes that are attached keep their mapping
+    if (_owner) {
+        ::shm_unlink(_name.c_str());
+        _owner = false;
+    }
+}
+
+} // namespace detail
+
+
+template<typename T, std::size_t N>
+shm_ndarray<T, N> shm_ndarray<T, N>::create(
+    const std::string& name,
+    const std::array<std::size_t, N>& shape_
+) {
+    static_assert(!std::is_const_v<T>, "a read-only array cannot be created");
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    const std::size_t offset = detail::shm_data_offset<T, N>(false);
+    detail::shm_mapping mapping = detail::shm_mapping::create(
+        name, offset + detail::count_elements(shape_) * sizeof(T)
+    );
+    detail::write_shm_header<T>(mapping, shape_, 0);
+
+    T* data_ = static_cast<T*>(static_cast<void*>(mapping.data() + offset));
+
+    return shm_ndarray{std::move(mapping), ndview<T, N>{shape_, data_}};
+}
+
+
+template<typename T, std::size_t N>
+shm_ndarray<T, N> shm_ndarray<T, N>::open(const std::string& name) {
+    static_assert(std::is_trivially_copyable_v<value_type>);
+
+    detail::shm_mapping mapping =
+        detail::shm_mapping::open(name, !std::is_const_v<T>);
+    const std::array<std::size_t, N> shape_ =
+        detail::read_shm_header<value_type, N>(mapping, false);
+
+    void* data_ = mapping.data() + detail::shm_data_offset<T, N>(false);
+
+    return shm_ndarray{
+        std::move(mapping), ndview<T, N>{shape_, static_cast<T*>(data_)}
+    };
+}
+
+
+template<typename T, std::size_t N>
+shm_ndarray<T, N>::shm_ndarray(
+    detail::shm_mapping&& mapping,
+    ndview<T, N> view_
+) noexcept :
+    _mapping{std::move(mapping)},
+    _view{view_}
+{
+}
+
+
+template<typename T, std::size_t N>
+shm_ndarray<T, N>::operator ndview<const T, N>() const noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N>
+ndview<T, N> shm_ndarray<T, N>::view() noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N>
+ndview<const T, N> shm_ndarray<T, N>::view() const noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N>
+ndview<const T, N> shm_ndarray<T, N>::cview() const noexcept {
+    return _view;
+}
+
+
+template<typename T, std::size_t N>
+std::size_t shm_ndarray<T, N>::element_count() const noexcept {
+    return _view.element_count();
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& shm_ndarray<T, N>::shape() const noexcept {
+    return _view.shape();
+}
+
+
+template<typename T, std::size_t N>
+std::size_t shm_ndarray<T, N>::shape(std::size_t dim) const noexcept {
+    return _view.shape(dim);
+}
+
+
+template<typename T, std::size_t N>
+T* shm_ndarray<T, N>::data() noexcept {
+    return _view.data();
+}
+
+
+template<typename T, std::size_t N>
+const T* shm_ndarray<T, N>::data() const noexcept {
+    return _view.data();
+}
+
+
+template<typename T, std::size_t N>
+const std::string& shm_ndarray<T, N>::name() const noexcept {
+    return _mapping.name();
+}
+
+
+template<typename T, std::size_t N>
+shm_frame_ring<T, N> shm_frame_ring<T, N>::create(
+    const std::string& name,
+    const std::array<std::size_t, N>& frame_shape_,
+    std::size_t capacity_
+) {
+    static_assert(!std::is_const_v<T>);
+    static_assert(std::is_trivially_copyable_v<T>);
+    assert(capacity_ > 0);
+
+    const std::size_t offset = detail::shm_data_offset<T, N>(true);
+    detail::shm_mapping mapping = detail::shm_mapping::create(
+        name,
+        offset +
+            capacity_ * detail::shm_frame_stride<T>(frame_shape_, true) *
+                sizeof(T)
+    );
+    detail::write_shm_header<T>(mapping, frame_shape_, capacity_);
+
+    return shm_frame_ring{std::move(mapping)};
+}
+
+
+template<typename T, std::size_t N>
+shm_frame_ring<T, N> shm_frame_ring<T, N>::open(const std::string& name) {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    detail::shm_mapping mapping = detail::shm_mapping::open(name, true);
+    detail::read_shm_header<T, N>(mapping, true);
+
+    return shm_frame_ring{std::move(mapping)};
+}
+
+
+template<typename T, std::size_t N>
+shm_frame_ring<T, N>::shm_frame_ring(detail::shm_mapping&& mapping) noexcept :
+    _mapping{std::move(mapping)},
+    _frame_shape{detail::shm_shape<N>(_mapping)},
+    _frame_stride{detail::shm_frame_stride<T>(_frame_shape, true)},
+    _frames{static_cast<T*>(static_cast<void*>(
+        _mapping.data() + detail::shm_data_offset<T, N>(true)
+    ))},
+    _positions{
+        detail::shm_counter<N>(_mapping, 0),
+        detail::shm_counter<N>(_mapping, 1),
+        detail::get_shm_header(_mapping).capacity
+    }
+{
+}
+
+
+template<typename T, std::size_t N>
+std::optional<ndview<T, N>> shm_frame_ring<T, N>::try_begin_write() noexcept {
+    const std::optional<std::uint64_t> position = _positions.try_begin_write();
+    if (!position) return std::nullopt;
+
+    const std::size_t frame = *position % _positions.capacity();
+
+    return ndview<T, N>{
+        _frame_shape,
+        _frames + frame * _frame_stride
+    };
+}
+
+
+template<typename T, std::size_t N>
+void shm_frame_ring<T, N>::end_write() noexcept {
+    _positions.end_write();
+}
+
+
+template<typename T, std::size_t N>
+std::optional<ndview<const T, N>> shm_frame_ring<T, N>::try_begin_read(
+) noexcept {
+    const std::optional<std::uint64_t> position = _positions.try_begin_read();
+    if (!position) return std::nullopt;
+
+    const std::size_t frame = *position % _positions.capacity();
+
+    return ndview<const T, N>{
+        _frame_shape,
+        _frames + frame * _frame_stride
+    };
+}
+
+
+template<typename T, std::size_t N>
+void shm_frame_ring<T, N>::end_read() noexcept {
+    _positions.end_read();
+}
+
+
+template<typename T, std::size_t N>
+std::size_t shm_frame_ring<T, N>::capacity() const noexcept {
+    return _positions.capacity();
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& shm_frame_ring<T, N>::frame_shape(
+) const noexcept {
+    return _frame_shape;
+}
+
+
+template<typename T, std::size_t N>
+const std::string& shm_frame_ring<T, N>::name() const noexcept {
+    return _mapping.name();
+}
+
+
+inline bool remove_shm(const std::string& name) noexcept {
+    return ::shm_unlink(name.c_str()) == 0;
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_SHM_IPP_
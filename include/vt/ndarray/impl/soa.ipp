@@ -0,0 +1,385 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_SOA_IPP_
+#define VT_NDARRAY_IMPL_SOA_IPP_
+
+#include <cassert>
+
+
+namespace vt {
+
+namespace detail {
+
+template<typename T, auto M, std::size_t I = 0>
+constexpr std::size_t soa_member_index() noexcept {
+    using member_type = std::tuple_element_t<I, soa_members_t<T>>;
+
+    if constexpr (std::is_same_v<member_type, decltype(M)>) {
+        if (std::get<I>(soa_traits<std::remove_cv_t<T>>::members) == M) {
+            return I;
+        }
+    }
+
+    if constexpr (I + 1 < soa_field_count<T>) {
+        return soa_member_index<T, M, I + 1>();
+    } else {
+        return soa_field_count<T>;
+    }
+}
+
+
+// Fields can be selected either by their index in soa_traits<T>::members or
+// by the member pointer itself.
+template<typename T, auto X>
+constexpr std::size_t soa_field_index() noexcept {
+    if constexpr (std::is_member_object_pointer_v<decltype(X)>) {
+        constexpr std::size_t idx = soa_member_index<T, X>();
+        static_assert(
+            idx < soa_field_count<T>,
+            "member is not listed in vt::soa_traits<T>::members"
+        );
+
+        return idx;
+    } else {
+        static_assert(std::is_integral_v<decltype(X)>);
+        static_assert(
+            X >= 0 && static_cast<std::size_t>(X) < soa_field_count<T>
+        );
+
+        return static_cast<std::size_t>(X);
+    }
+}
+
+
+template<typename F, std::size_t... I>
+constexpr void soa_for_each_impl(F&& f, std::index_sequence<I...>) {
+    (f(std::integral_constant<std::size_t, I>{}), ...);
+}
+
+
+template<typename T, typename F>
+constexpr void soa_for_each(F&& f) {
+    soa_for_each_impl(f, std::make_index_sequence<soa_field_count<T>>{});
+}
+
+
+template<typename Pointers>
+constexpr Pointers soa_advance(
+    const Pointers& fields,
+    std::size_t offset
+) noexcept {
+    return std::apply(
+        [offset](auto*... field) { return Pointers{field + offset...}; },
+        fields
+    );
+}
+
+} // namespace detail
+
+
+template<typename T>
+soa_reference<T>::soa_reference(
+    const detail::soa_pointers_t<T>& fields_
+) noexcept :
+    _fields{fields_}
+{
+}
+
+
+template<typename T>
+const soa_reference<T>& soa_reference<T>::operator=(
+    const value_type& value
+) const {
+    static_assert(!std::is_const_v<T>);
+
+    constexpr auto& members = soa_traits<value_type>::members;
+    detail::soa_for_each<T>([&](auto i) {
+        *std::get<i>(_fields) = value.*std::get<i>(members);
+    });
+
+    return *this;
+}
+
+
+template<typename T>
+const soa_reference<T>& soa_reference<T>::operator=(
+    const soa_reference& other
+) const {
+    // Proxy semantics: assigning a reference assigns the referred-to values.
+    return *this = static_cast<value_type>(other);
+}
+
+
+template<typename T>
+soa_reference<T>::operator value_type() const {
+    constexpr auto& members = soa_traits<value_type>::members;
+
+    value_type value{};
+    detail::soa_for_each<T>([&](auto i) {
+        value.*std::get<i>(members) = *std::get<i>(_fields);
+    });
+
+    return value;
+}
+
+
+template<typename T>
+template<auto X>
+decltype(auto) soa_reference<T>::get() const noexcept {
+    return *std::get<detail::soa_field_index<T, X>()>(_fields);
+}
+
+
+template<typename T, std::size_t N>
+constexpr soa_ndview<T, N>::soa_ndview(
+    const std::array<std::size_t, N>& shape_,
+    const detail::soa_pointers_t<T>& fields_
+) noexcept :
+    _shape{shape_},
+    _fields{fields_}
+{
+}
+
+
+template<typename T, std::size_t N>
+decltype(auto) soa_ndview<T, N>::operator[](std::size_t idx) const noexcept {
+    detail::check_index(
+        "vt::soa_ndview::operator[]: index out of range", idx, _shape
+    );
+
+    if constexpr (N > 1) {
+        std::array<std::size_t, N - 1> subshape_;
+        for (std::size_t i = 0; i < N - 1; ++i) {
+            subshape_[i] = _shape[i + 1];
+        }
+
+        return soa_ndview<T, N - 1>{
+            subshape_,
+            detail::soa_advance(
+                _fields,
+                idx * detail::count_elements(subshape_)
+            )
+        };
+    } else {
+        return soa_reference<T>{detail::soa_advance(_fields, idx)};
+    }
+}
+
+
+template<typename T, std::size_t N>
+constexpr soa_ndview<T, N>::operator soa_ndview<const T, N>() const noexcept {
+    return { _shape, _fields };
+}
+
+
+template<typename T, std::size_t N>
+constexpr std::size_t soa_ndview<T, N>::element_count() const noexcept {
+    return detail::count_elements(_shape);
+}
+
+
+template<typename T, std::size_t N>
+constexpr const std::array<std::size_t, N>& soa_ndview<T, N>::shape(
+) const noexcept {
+    return _shape;
+}
+
+
+template<typename T, std::size_t N>
+constexpr std::size_t soa_ndview<T, N>::shape(std::size_t dim) const noexcept {
+    assert(dim < N);
+
+    return _shape[dim];
+}
+
+
+template<typename T, std::size_t N>
+template<auto X>
+constexpr auto soa_ndview<T, N>::field() const noexcept {
+    constexpr std::size_t idx = detail::soa_field_index<T, X>();
+
+    return ndview<detail::soa_field_t<T, idx>, N>{
+        _shape,
+        std::get<idx>(_fields)
+    };
+}
+
+
+template<typename T, std::size_t N>
+constexpr soa_ndview<T, N> soa_ndview<T, N>::slice(
+    std::size_t offset
+) const noexcept {
+    return this->slice(offset, _shape[0] - offset);
+}
+
+
+template<typename T, std::size_t N>
+constexpr soa_ndview<T, N> soa_ndview<T, N>::slice(
+    std::size_t offset,
+    std::size_t count
+) const noexcept {
+    detail::check_slice(
+        "vt::soa_ndview::slice: range out of bounds", offset, count, _shape
+    );
+
+    auto slice_shape = _shape;
+    slice_shape[0] = count;
+
+    std::size_t stride = 1;
+    for (std::size_t i = 1; i < N; ++i) {
+        stride *= _shape[i];
+    }
+
+    return {
+        slice_shape,
+        detail::soa_advance(_fields, offset * stride)
+    };
+}
+
+
+template<typename T, std::size_t N>
+soa_ndarray<T, N>::soa_ndarray() noexcept = default;
+
+
+template<typename T, std::size_t N>
+soa_ndarray<T, N>::soa_ndarray(const std::array<std::size_t, N>& shape_) {
+    detail::soa_for_each<T>([&](auto i) {
+        using field_type = detail::soa_field_t<T, i>;
+
+        std::get<i>(_fields) = ndarray<field_type, N>{shape_};
+    });
+}
+
+
+template<typename T, std::size_t N>
+soa_ndarray<T, N>::soa_ndarray(
+    const std::array<std::size_t, N>& shape_,
+    const T& init
+) {
+    constexpr auto& members = soa_traits<T>::members;
+    detail::soa_for_each<T>([&](auto i) {
+        using field_type = detail::soa_field_t<T, i>;
+
+        std::get<i>(_fields) = ndarray<field_type, N>{
+            shape_,
+            init.*std::get<i>(members)
+        };
+    });
+}
+
+
+template<typename T, std::size_t N>
+decltype(auto) soa_ndarray<T, N>::operator[](std::size_t idx) noexcept {
+    return this->view()[idx];
+}
+
+
+template<typename T, std::size_t N>
+decltype(auto) soa_ndarray<T, N>::operator[](
+    std::size_t idx
+) const noexcept {
+    return this->cview()[idx];
+}
+
+
+template<typename T, std::size_t N>
+soa_ndarray<T, N>::operator soa_ndview<T, N>() noexcept {
+    return this->view();
+}
+
+
+template<typename T, std::size_t N>
+soa_ndarray<T, N>::operator soa_ndview<const T, N>() const noexcept {
+    return this->cview();
+}
+
+
+template<typename T, std::size_t N>
+soa_ndview<T, N> soa_ndarray<T, N>::view() noexcept {
+    return make_view<T>(
+        _fields,
+        std::make_index_sequence<field_count>{}
+    );
+}
+
+
+template<typename T, std::size_t N>
+soa_ndview<const T, N> soa_ndarray<T, N>::view() const noexcept {
+    return this->cview();
+}
+
+
+template<typename T, std::size_t N>
+soa_ndview<const T, N> soa_ndarray<T, N>::cview() const noexcept {
+    return make_view<const T>(
+        _fields,
+        std::make_index_sequence<field_count>{}
+    );
+}
+
+
+template<typename T, std::size_t N>
+template<auto X>
+auto soa_ndarray<T, N>::field() noexcept {
+    return std::get<detail::soa_field_index<T, X>()>(_fields).view();
+}
+
+
+template<typename T, std::size_t N>
+template<auto X>
+auto soa_ndarray<T, N>::field() const noexcept {
+    return std::get<detail::soa_field_index<T, X>()>(_fields).cview();
+}
+
+
+template<typename T, std::size_t N>
+std::size_t soa_ndarray<T, N>::element_count() const noexcept {
+    return std::get<0>(_fields).element_count();
+}
+
+
+template<typename T, std::size_t N>
+const std::array<std::size_t, N>& soa_ndarray<T, N>::shape() const noexcept {
+    return std::get<0>(_fields).shape();
+}
+
+
+template<typename T, std::size_t N>
+std::size_t soa_ndarray<T, N>::shape(std::size_t dim) const noexcept {
+    return std::get<0>(_fields).shape(dim);
+}
+
+
+template<typename T, std::size_t N>
+template<typename U, typename Arrays, std::size_t... I>
+soa_ndview<U, N> soa_ndarray<T, N>::make_view(
+    Arrays& fields_,
+    std::index_sequence<I...>
+) noexcept {
+    return {
+        std::get<0>(fields_).shape(),
+        detail::soa_pointers_t<U>{std::get<I>(fields_).data()...}
+    };
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_SOA_IPP_
@@ -0,0 +1,797 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_SORT_IPP_
+#define VT_NDARRAY_IMPL_SORT_IPP_
+
+#include <vt/ndarray/impl/parallel.ipp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace vt {
+
+namespace detail {
+
+template<typename Index>
+constexpr Index to_index(std::size_t pos) noexcept {
+    if constexpr (std::is_same_v<Index, std::size_t>) {
+        return pos;
+    } else {
+        return static_cast<Index>(pos);
+    }
+}
+
+
+template<std::size_t Size>
+struct unsigned_of;
+
+template<>
+struct unsigned_of<1> {
+    using type = std::uint8_t;
+};
+
+template<>
+struct unsigned_of<2> {
+    using type = std::uint16_t;
+};
+
+template<>
+struct unsigned_of<4> {
+    using type = std::uint32_t;
+};
+
+template<>
+struct unsigned_of<8> {
+    using type = std::uint64_t;
+};
+
+
+// Lanes up to this length are sorted with a sorting network, applied to
+// network_lanes lanes at once, so that every compare-exchange becomes a
+// vector min and max.
+constexpr std::size_t network_max_length = 16;
+constexpr std::size_t network_lanes = 16;
+
+template<typename T>
+constexpr bool network_sortable_v = std::is_arithmetic_v<T> && sizeof(T) <= 8;
+
+
+struct sorting_network {
+    std::uint8_t pairs[64][2];
+    std::size_t size;
+};
+
+
+// Batcher's odd-even merge sort, which is valid for any length when the
+// comparators beyond the end are left out
+constexpr sorting_network make_sorting_network(std::size_t n) noexcept {
+    sorting_network network{};
+
+    for (std::size_t p = 1; p < n; p *= 2) {
+        for (std::size_t k = p; k >= 1; k /= 2) {
+            for (std::size_t j = k % p; j + k < n; j += 2 * k) {
+                for (std::size_t i = 0; i < std::min(k, n - j - k); ++i) {
+                    if ((i + j) / (2 * p) != (i + j + k) / (2 * p)) continue;
+
+                    auto& pair = network.pairs[network.size];
+                    pair[0] = static_cast<std::uint8_t>(i + j);
+                    pair[1] = static_cast<std::uint8_t>(i + j + k);
+                    ++network.size;
+                }
+            }
+        }
+    }
+
+    return network;
+}
+
+
+struct sorting_networks {
+    sorting_network networks[network_max_length + 1];
+
+    constexpr sorting_networks() noexcept : networks{} {
+        for (std::size_t n = 0; n <= network_max_length; ++n) {
+            networks[n] = make_sorting_network(n);
+        }
+    }
+};
+
+inline constexpr sorting_networks sorting_networks_v{};
+
+
+// Sorts the network_lanes columns of the row-major n x network_lanes array x
+template<typename T>
+void network_sort(T* x, std::size_t n) noexcept {
+    const sorting_network& network = sorting_networks_v.networks[n];
+
+    for (std::size_t c = 0; c < network.size; ++c) {
+        const std::size_t first = network.pairs[c][0];
+        const std::size_t second = network.pairs[c][1];
+        T* a = x + first * network_lanes;
+        T* b = x + second * network_lanes;
+
+        // Separate loads and stores, so that the compiler does not have to
+        // prove that a and b do not overlap
+        T lo[network_lanes];
+        T hi[network_lanes];
+        for (std::size_t l = 0; l < network_lanes; ++l) {
+            lo[l] = b[l] < a[l] ? b[l] : a[l];
+            hi[l] = b[l] < a[l] ? a[l] : b[l];
+        }
+
+        std::copy_n(lo, network_lanes, a);
+        std::copy_n(hi, network_lanes, b);
+    }
+}
+
+
+// As network_sort, but orders equal values by their index, which makes the
+// permutation stable
+template<typename T, typename Index>
+void network_argsort(T* x, Index* order, std::size_t n) noexcept {
+    const sorting_network& network = sorting_networks_v.networks[n];
+
+    for (std::size_t c = 0; c < network.size; ++c) {
+        const std::size_t i = network.pairs[c][0];
+        const std::size_t j = network.pairs[c][1];
+        T* a = x + i * network_lanes;
+        T* b = x + j * network_lanes;
+        Index* ia = order + i * network_lanes;
+        Index* ib = order + j * network_lanes;
+
+        T lo[network_lanes];
+        T hi[network_lanes];
+        Index ilo[network_lanes];
+        Index ihi[network_lanes];
+        for (std::size_t l = 0; l < network_lanes; ++l) {
+            const bool swap =
+                b[l] < a[l] || (!(a[l] < b[l]) && ib[l] < ia[l]);
+            lo[l] = swap ? b[l] : a[l];
+            hi[l] = swap ? a[l] : b[l];
+            ilo[l] = swap ? ib[l] : ia[l];
+            ihi[l] = swap ? ia[l] : ib[l];
+        }
+
+        std::copy_n(lo, network_lanes, a);
+        std::copy_n(hi, network_lanes, b);
+        std::copy_n(ilo, network_lanes, ia);
+        std::copy_n(ihi, network_lanes, ib);
+    }
+}
+
+
+template<typename T>
+void network_sort_lanes(
+    T* data,
+    const lane_layout& layout,
+    std::size_t first,
+    std::size_t last
+) noexcept {
+    const std::size_t n = layout.length;
+    T x[network_max_length * network_lanes]{};
+
+    for (std::size_t group = first; group < last; group += network_lanes) {
+        const std::size_t count = std::min(network_lanes, last - group);
+
+        for (std::size_t l = 0; l < count; ++l) {
+            const T* lane = data + layout.offset(group + l);
+            for (std::size_t i = 0; i < n; ++i) {
+                x[i * network_lanes + l] = lane[i * layout.inner];
+            }
+        }
+
+        network_sort(x, n);
+
+        for (std::size_t l = 0; l < count; ++l) {
+            T* lane = data + layout.offset(group + l);
+            for (std::size_t i = 0; i < n; ++i) {
+                lane[i * layout.inner] = x[i * network_lanes + l];
+            }
+        }
+    }
+}
+
+
+template<typename T, typename Index>
+void network_argsort_lanes(
+    const T* data,
+    Index* indices,
+    const lane_layout& layout,
+    std::size_t first,
+    std::size_t last
+) noexcept {
+    // Positions of the same width as the elements vectorize best
+    using position = typename unsigned_of<sizeof(T)>::type;
+
+    const std::size_t n = layout.length;
+    T x[network_max_length * network_lanes]{};
+    position order[network_max_length * network_lanes]{};
+
+    for (std::size_t group = first; group < last; group += network_lanes) {
+        const std::size_t count = std::min(network_lanes, last - group);
+
+        for (std::size_t l = 0; l < count; ++l) {
+            const T* lane = data + layout.offset(group + l);
+            for (std::size_t i = 0; i < n; ++i) {
+                x[i * network_lanes + l] = lane[i * layout.inner];
+            }
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            std::fill_n(
+                order + i * network_lanes, network_lanes,
+                to_index<position>(i)
+            );
+        }
+
+        network_argsort(x, order, n);
+
+        for (std::size_t l = 0; l < count; ++l) {
+            Index* lane = indices + layout.offset(group + l);
+            for (std::size_t i = 0; i < n; ++i) {
+                lane[i * layout.inner] =
+                    to_index<Index>(order[i * network_lanes + l]);
+            }
+        }
+    }
+}
+
+
+// Lanes from this length on are radix sorted when the element type allows
+template<typename T>
+constexpr bool radix_sortable_v =
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+    (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 &&
+        (sizeof(T) == 4 || sizeof(T) == 8));
+
+constexpr std::size_t radix_min_length = 256;
+constexpr std::size_t parallel_radix_min_length = std::size_t{1} << 16;
+
+
+// Unsigned integer whose order matches the order of T
+template<typename T>
+using radix_key_t = typename unsigned_of<sizeof(T)>::type;
+
+
+template<typename T>
+radix_key_t<T> to_radix_key(T value) noexcept {
+    using K = radix_key_t<T>;
+    constexpr K sign_bit = K(K{1} << (8 * sizeof(K) - 1));
+
+    K key;
+    std::memcpy(&key, &value, sizeof(key));
+
+    if constexpr (std::is_floating_point_v<T>) {
+        // -0 gets the key of +0, so that equal values keep their order.
+        // Negative values have their order reversed.
+        if (key == sign_bit) key = 0;
+        return (key & sign_bit) != 0 ? K(~key) : K(key | sign_bit);
+    } else if constexpr (std::is_signed_v<T>) {
+        return K(key ^ sign_bit);
+    } else {
+        return key;
+    }
+}
+
+
+// Inverse of to_radix_key for integers. Floating point keys lose the sign
+// of zero, so floating point values are sorted along with their keys.
+template<typename T>
+T from_radix_key(radix_key_t<T> key) noexcept {
+    static_assert(std::is_integral_v<T>);
+    using K = radix_key_t<T>;
+    constexpr K sign_bit = K(K{1} << (8 * sizeof(K) - 1));
+
+    if constexpr (std::is_signed_v<T>) {
+        key = K(key ^ sign_bit);
+    }
+
+    T value;
+    std::memcpy(&value, &key, sizeof(value));
+
+    return value;
+}
+
+
+template<typename K>
+std::size_t radix_digit(K key, std::size_t digit) noexcept {
+    return static_cast<std::size_t>(key >> (8 * digit)) & 0xff;
+}
+
+
+struct no_payload {};
+
+using radix_histogram = std::array<std::size_t, 256>;
+
+
+// Stable least-significant-digit radix sort of keys, which moves the payload
+// along. The temporaries are used as buffers, the result ends up in keys.
+// With more than one part, every pass is split between that many threads,
+// which use one of the part_count histograms in counts each.
+template<typename K, typename P>
+void radix_sort(
+    K* keys,
+    K* keys_tmp,
+    P* payload,
+    P* payload_tmp,
+    radix_histogram* counts,
+    std::size_t n,
+    std::size_t part_count
+) {
+    constexpr bool has_payload = !std::is_same_v<P, no_payload>;
+    assert(part_count > 0);
+
+    K* const keys_out = keys;
+    P* const payload_out = payload;
+
+    for (std::size_t digit = 0; digit < sizeof(K); ++digit) {
+        parallel_invoke(part_count, [&](std::size_t part) {
+            radix_histogram& count = counts[part];
+            count.fill(0);
+            for (std::size_t i = n * part / part_count;
+                    i < n * (part + 1) / part_count; ++i) {
+                ++count[radix_digit(keys[i], digit)];
+            }
+        });
+
+        // Nothing to do if all keys share this digit
+        std::size_t first_count = 0;
+        for (std::size_t part = 0; part < part_count; ++part) {
+            first_count += counts[part][radix_digit(keys[0], digit)];
+        }
+        if (first_count == n) continue;
+
+        // Every part writes its keys for a digit after those of the parts
+        // before it, which keeps the sort stable.
+        std::size_t offset = 0;
+        for (std::size_t bucket = 0; bucket < 256; ++bucket) {
+            for (std::size_t part = 0; part < part_count; ++part) {
+                const std::size_t bucket_count = counts[part][bucket];
+                counts[part][bucket] = offset;
+                offset += bucket_count;
+            }
+        }
+
+        parallel_invoke(part_count, [&](std::size_t part) {
+            radix_histogram& pos = counts[part];
+            for (std::size_t i = n * part / part_count;
+                    i < n * (part + 1) / part_count; ++i) {
+                const std::size_t j = pos[radix_digit(keys[i], digit)]++;
+                keys_tmp[j] = keys[i];
+                if constexpr (has_payload) {
+                    payload_tmp[j] = payload[i];
+                }
+            }
+        });
+
+        std::swap(keys, keys_tmp);
+        if constexpr (has_payload) {
+            std::swap(payload, payload_tmp);
+        }
+    }
+
+    // After an odd number of passes, the result is in the temporaries
+    if (keys == keys_out) return;
+
+    parallel_invoke(part_count, [&](std::size_t part) {
+        const std::size_t first = n * part / part_count;
+        const std::size_t last = n * (part + 1) / part_count;
+
+        std::copy(keys + first, keys + last, keys_out + first);
+        if constexpr (has_payload) {
+            std::copy(payload + first, payload + last, payload_out + first);
+        }
+    });
+}
+
+
+template<typename T, typename Index, bool = radix_sortable_v<T>>
+struct sort_buffers {
+    std::vector<T> values;
+    std::vector<Index> order;
+};
+
+template<typename T, typename Index>
+struct sort_buffers<T, Index, true> {
+    std::vector<T> values;
+    std::vector<T> values_tmp;
+    std::vector<Index> order;
+    std::vector<Index> order_tmp;
+    std::vector<radix_key_t<T>> keys;
+    std::vector<radix_key_t<T>> keys_tmp;
+    std::vector<radix_histogram> counts;
+};
+
+
+// Sizes the buffers that sort_row and argsort_row use for rows of length n
+// that are split into part_count parts. Lanes are sorted by worker threads,
+// which must not allocate, so this is done before they start.
+template<typename T, typename Index>
+void reserve_row_buffers(
+    sort_buffers<T, Index>& buffers,
+    std::size_t n,
+    std::size_t part_count,
+    bool with_order
+) {
+    if constexpr (radix_sortable_v<T>) {
+        if (n >= radix_min_length) {
+            buffers.keys.resize(n);
+            buffers.keys_tmp.resize(n);
+            buffers.counts.resize(part_count);
+            if (with_order) {
+                buffers.order_tmp.resize(n);
+            } else if constexpr (std::is_floating_point_v<T>) {
+                buffers.values_tmp.resize(n);
+            }
+        }
+    }
+}
+
+
+template<typename T, typename Index>
+void sort_row(
+    T* x,
+    std::size_t n,
+    sort_buffers<T, Index>& buffers,
+    std::size_t part_count
+) {
+    if constexpr (radix_sortable_v<T>) {
+        if (n >= radix_min_length) {
+            assert(buffers.keys.size() >= n);
+            auto* keys = buffers.keys.data();
+
+            parallel_for(n, part_count, [=](std::size_t i, std::size_t end) {
+                for (; i < end; ++i) keys[i] = to_radix_key(x[i]);
+            });
+
+            if constexpr (std::is_floating_point_v<T>) {
+                radix_sort(
+                    keys, buffers.keys_tmp.data(),
+                    x, buffers.values_tmp.data(),
+                    buffers.counts.data(), n, part_count
+                );
+            } else {
+                radix_sort<radix_key_t<T>, no_payload>(
+                    keys, buffers.keys_tmp.data(), nullptr, nullptr,
+                    buffers.counts.data(), n, part_count
+                );
+
+                parallel_for(
+                    n, part_count,
+                    [=](std::size_t i, std::size_t end) {
+                        for (; i < end; ++i) x[i] = from_radix_key<T>(keys[i]);
+                    }
+                );
+            }
+            return;
+        }
+    }
+
+    std::sort(x, x + n);
+}
+
+
+template<typename T, typename Index>
+void argsort_row(
+    const T* x,
+    std::size_t n,
+    Index* order,
+    sort_buffers<T, Index>& buffers,
+    std::size_t part_count
+) {
+    std::iota(order, order + n, Index{0});
+
+    if constexpr (radix_sortable_v<T>) {
+        if (n >= radix_min_length) {
+            assert(buffers.order_tmp.size() >= n);
+            auto* keys = buffers.keys.data();
+
+            parallel_for(n, part_count, [=](std::size_t i, std::size_t end) {
+                for (; i < end; ++i) keys[i] = to_radix_key(x[i]);
+            });
+
+            radix_sort(
+                keys, buffers.keys_tmp.data(),
+                order, buffers.order_tmp.data(),
+                buffers.counts.data(), n, part_count
+            );
+            return;
+        }
+    }
+
+    std::stable_sort(order, order + n, [x](Index a, Index b) {
+        return x[to_size(a)] < x[to_size(b)];
+    });
+}
+
+
+// Calls f(lane, buffers) for every lane, split between the threads. Every
+// thread reuses its own copy of buffers, which is made on the calling thread
+// so that the worker threads do not allocate.
+template<typename T, typename Index, typename F>
+void for_each_lane(
+    const lane_layout& layout,
+    std::size_t thread_count,
+    sort_buffers<T, Index> buffers,
+    F&& f
+) {
+    const std::size_t lane_count = layout.count();
+    const std::size_t part_count =
+        std::min(resolve_thread_count(thread_count), lane_count);
+    if (part_count == 0) return;
+
+    std::vector<sort_buffers<T, Index>> part_buffers(part_count - 1, buffers);
+    part_buffers.push_back(std::move(buffers));
+
+    parallel_invoke(part_count, [&](std::size_t part) {
+        for (std::size_t lane = lane_count * part / part_count;
+                lane < lane_count * (part + 1) / part_count; ++lane) {
+            f(lane, part_buffers[part]);
+        }
+    });
+}
+
+
+template<typename T, typename U>
+void copy_lane(
+    const T* src,
+    std::size_t src_stride,
+    U* dst,
+    std::size_t dst_stride,
+    std::size_t n
+) {
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i * dst_stride] = src[i * src_stride];
+    }
+}
+
+} // namespace detail
+
+
+template<typename T, std::size_t N>
+void sort(ndview<T, N> a, std::size_t axis, std::size_t thread_count) {
+    const detail::lane_layout layout = detail::get_lane_layout(a.shape(), axis);
+    const std::size_t n = layout.length;
+    const std::size_t lane_count = layout.count();
+    if (n < 2 || lane_count == 0) return;
+
+    T* data = a.data();
+
+    if constexpr (detail::network_sortable_v<T>) {
+        if (n <= detail::network_max_length) {
+            constexpr std::size_t lanes = detail::network_lanes;
+            detail::parallel_for(
+                (lane_count + lanes - 1) / lanes, thread_count,
+                [&](std::size_t first, std::size_t last) {
+                    detail::network_sort_lanes(
+                        data, layout,
+                        first * lanes, std::min(last * lanes, lane_count)
+                    );
+                }
+            );
+            return;
+        }
+    }
+
+    // With fewer lanes than threads, every lane is sorted by all threads
+    const std::size_t resolved = detail::resolve_thread_count(thread_count);
+    const bool split_lanes = detail::radix_sortable_v<T> &&
+        lane_count < resolved && n >= detail::parallel_radix_min_length;
+    const std::size_t part_count = split_lanes ? resolved : 1;
+
+    detail::sort_buffers<T, std::size_t> scratch;
+    if (layout.inner != 1) scratch.values.resize(n);
+    detail::reserve_row_buffers(scratch, n, part_count, false);
+
+    detail::for_each_lane(
+        layout, split_lanes ? 1 : thread_count, std::move(scratch),
+        [&](std::size_t lane, auto& buffers) {
+            T* x = data + layout.offset(lane);
+            if (layout.inner == 1) {
+                detail::sort_row(x, n, buffers, part_count);
+                return;
+            }
+
+            detail::copy_lane(x, layout.inner, buffers.values.data(), 1, n);
+            detail::sort_row(buffers.values.data(), n, buffers, part_count);
+            detail::copy_lane(buffers.values.data(), 1, x, layout.inner, n);
+        }
+    );
+}
+
+
+template<typename T, typename Index, std::size_t N>
+void argsort(
+    detail::nondeduced_t<ndview<const T, N>> a,
+    ndview<Index, N> indices,
+    std::size_t axis,
+    std::size_t thread_count
+) {
+    assert(indices.shape() == a.shape());
+
+    const detail::lane_layout layout = detail::get_lane_layout(a.shape(), axis);
+    const std::size_t n = layout.length;
+    const std::size_t lane_count = layout.count();
+    if (n == 0 || lane_count == 0) return;
+
+    assert(n - 1 <= detail::to_size(std::numeric_limits<Index>::max()));
+
+    const T* data = a.data();
+    Index* out = indices.data();
+
+    if constexpr (detail::network_sortable_v<T>) {
+        if (n <= detail::network_max_length) {
+            constexpr std::size_t lanes = detail::network_lanes;
+            detail::parallel_for(
+                (lane_count + lanes - 1) / lanes, thread_count,
+                [&](std::size_t first, std::size_t last) {
+                    detail::network_argsort_lanes(
+                        data, out, layout,
+                        first * lanes, std::min(last * lanes, lane_count)
+                    );
+                }
+            );
+            return;
+        }
+    }
+
+    const std::size_t resolved = detail::resolve_thread_count(thread_count);
+    const bool split_lanes = detail::radix_sortable_v<T> &&
+        lane_count < resolved && n >= detail::parallel_radix_min_length;
+    const std::size_t part_count = split_lanes ? resolved : 1;
+
+    detail::sort_buffers<T, Index> scratch;
+    if (layout.inner != 1) {
+        scratch.values.resize(n);
+        scratch.order.resize(n);
+    }
+    detail::reserve_row_buffers(scratch, n, part_count, true);
+
+    detail::for_each_lane(
+        layout, split_lanes ? 1 : thread_count, std::move(scratch),
+        [&](std::size_t lane, auto& buffers) {
+            const T* x = data + layout.offset(lane);
+            Index* order = out + layout.offset(lane);
+            if (layout.inner == 1) {
+                detail::argsort_row(x, n, order, buffers, part_count);
+                return;
+            }
+
+            detail::copy_lane(x, layout.inner, buffers.values.data(), 1, n);
+            detail::argsort_row(
+                buffers.values.data(), n, buffers.order.data(), buffers,
+                part_count
+            );
+            detail::copy_lane(
+                buffers.order.data(), 1, order, layout.inner, n
+            );
+        }
+    );
+}
+
+
+template<typename T, std::size_t N>
+void partial_sort(
+    ndview<T, N> a,
+    std::size_t k,
+    std::size_t axis,
+    std::size_t thread_count
+) {
+    const detail::lane_layout layout = detail::get_lane_layout(a.shape(), axis);
+    const std::size_t n = layout.length;
+    assert(k <= n);
+
+    T* data = a.data();
+
+    detail::sort_buffers<T, std::size_t> scratch;
+    if (layout.inner != 1) scratch.values.resize(n);
+
+    detail::for_each_lane(
+        layout, thread_count, std::move(scratch),
+        [&](std::size_t lane, auto& buffers) {
+            T* x = data + layout.offset(lane);
+            if (layout.inner == 1) {
+                std::partial_sort(x, x + k, x + n);
+                return;
+            }
+
+            T* values = buffers.values.data();
+            detail::copy_lane(x, layout.inner, values, 1, n);
+            std::partial_sort(values, values + k, values + n);
+            detail::copy_lane(values, 1, x, layout.inner, n);
+        }
+    );
+}
+
+
+template<typename T, typename Index, std::size_t N>
+void top_k(
+    detail::nondeduced_t<ndview<const T, N>> a,
+    detail::nondeduced_t<ndview<T, N>> values,
+    ndview<Index, N> indices,
+    std::size_t axis,
+    std::size_t thread_count
+) {
+    assert(indices.shape() == values.shape());
+
+    const detail::lane_layout layout = detail::get_lane_layout(a.shape(), axis);
+    const detail::lane_layout top_layout =
+        detail::get_lane_layout(values.shape(), axis);
+    const std::size_t n = layout.length;
+    const std::size_t k = top_layout.length;
+
+    assert(k <= n);
+    assert(layout.outer == top_layout.outer);
+    assert(layout.inner == top_layout.inner);
+    assert(
+        n == 0 || n - 1 <= detail::to_size(std::numeric_limits<Index>::max())
+    );
+
+    const T* data = a.data();
+
+    detail::sort_buffers<T, Index> scratch;
+    if (layout.inner != 1) scratch.values.resize(n);
+    scratch.order.resize(n);
+
+    detail::for_each_lane(
+        layout, thread_count, std::move(scratch),
+        [&](std::size_t lane, auto& buffers) {
+            const T* x = data + layout.offset(lane);
+            if (layout.inner != 1) {
+                detail::copy_lane(
+                    x, layout.inner, buffers.values.data(), 1, n
+                );
+                x = buffers.values.data();
+            }
+
+            Index* order = buffers.order.data();
+            std::iota(order, order + n, Index{0});
+
+            // Larger values first, equal values by position
+            std::partial_sort(order, order + k, order + n,
+                [x](Index i, Index j) {
+                    const T& xi = x[detail::to_size(i)];
+                    const T& xj = x[detail::to_size(j)];
+                    return xj < xi || (!(xi < xj) && i < j);
+                }
+            );
+
+            const std::size_t offset = top_layout.offset(lane);
+            for (std::size_t i = 0; i < k; ++i) {
+                const std::size_t pos = offset + i * layout.inner;
+                values.data()[pos] = x[detail::to_size(order[i])];
+                indices.data()[pos] = order[i];
+            }
+        }
+    );
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_SORT_IPP_
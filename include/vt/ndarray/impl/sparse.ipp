@@ -0,0 +1,557 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_SPARSE_IPP_
+#define VT_NDARRAY_IMPL_SPARSE_IPP_
+
+#include <vt/ndarray/impl/parallel.ipp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+
+namespace vt {
+
+namespace detail {
+
+template<typename T>
+bool is_zero(const T& x) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::fpclassify(x) == FP_ZERO;
+    } else {
+        return x == T{};
+    }
+}
+
+
+template<typename Index>
+constexpr Index to_index(std::size_t i) noexcept {
+    assert(i <= std::numeric_limits<Index>::max());
+
+    if constexpr (std::is_same_v<Index, std::size_t>) {
+        return i;
+    } else {
+        return static_cast<Index>(i);
+    }
+}
+
+
+// Returns the first row of part `part` out of `part_count`, such that all
+// parts hold about the same number of nonzeros.
+template<typename Index>
+std::size_t balanced_row(
+    const Index* row_offsets,
+    std::size_t row_count,
+    std::size_t part,
+    std::size_t part_count
+) noexcept {
+    if (part == part_count) return row_count;
+
+    const std::size_t target = row_offsets[row_count] * part / part_count;
+    const Index* row = std::lower_bound(
+        row_offsets,
+        row_offsets + row_count,
+        target,
+        [](Index offset, std::size_t value) { return offset < value; }
+    );
+
+    return static_cast<std::size_t>(row - row_offsets);
+}
+
+
+// Calls f(first_row, last_row) concurrently for ranges of rows with about
+// the same number of nonzeros.
+template<typename Index, typename F>
+void parallel_rows(
+    const Index* row_offsets,
+    std::size_t row_count,
+    std::size_t thread_count,
+    F&& f
+) {
+    const std::size_t part_count =
+        std::min(resolve_thread_count(thread_count), row_count);
+
+    if (part_count <= 1) {
+        f(std::size_t{0}, row_count);
+        return;
+    }
+
+    parallel_invoke(part_count, [&](std::size_t part) {
+        f(
+            balanced_row(row_offsets, row_count, part, part_count),
+            balanced_row(row_offsets, row_count, part + 1, part_count)
+        );
+    });
+}
+
+
+// Uses four independent partial sums, so that the gathered products of a row
+// are not serialized on a single accumulator.
+template<typename T, typename Index>
+void csr_mul_rows(
+    const Index* row_offsets,
+    const Index* col_indices,
+    const T* values,
+    const T* x,
+    T* y,
+    std::size_t first_row,
+    std::size_t last_row
+) noexcept {
+    for (std::size_t i = first_row; i < last_row; ++i) {
+        const std::size_t end = row_offsets[i + 1];
+        std::size_t k = row_offsets[i];
+
+        T sum0{};
+        T sum1{};
+        T sum2{};
+        T sum3{};
+        for (; k + 4 <= end; k += 4) {
+            sum0 += values[k] * x[col_indices[k]];
+            sum1 += values[k + 1] * x[col_indices[k + 1]];
+            sum2 += values[k + 2] * x[col_indices[k + 2]];
+            sum3 += values[k + 3] * x[col_indices[k + 3]];
+        }
+        for (; k < end; ++k) {
+            sum0 += values[k] * x[col_indices[k]];
+        }
+
+        y[i] = (sum0 + sum1) + (sum2 + sum3);
+    }
+}
+
+
+// Accumulates scaled rows of B into each row of C, so that the innermost loop
+// runs over contiguous memory.
+template<typename T, typename Index>
+void csr_mul_rows(
+    const Index* row_offsets,
+    const Index* col_indices,
+    const T* values,
+    const T* B,
+    T* C,
+    std::size_t p,
+    std::size_t first_row,
+    std::size_t last_row
+) noexcept {
+    for (std::size_t i = first_row; i < last_row; ++i) {
+        T* c = C + i * p;
+        std::fill(c, c + p, T{});
+
+        const std::size_t end = row_offsets[i + 1];
+        for (std::size_t k = row_offsets[i]; k < end; ++k) {
+            const T a = values[k];
+            const T* b = B + std::size_t{col_indices[k]} * p;
+            for (std::size_t j = 0; j < p; ++j) {
+                c[j] += a * b[j];
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+
+template<typename T, typename Index>
+coo_matrix<T, Index>::coo_matrix() noexcept :
+    _shape{},
+    _rows{},
+    _cols{},
+    _values{}
+{
+    static_assert(std::is_unsigned_v<Index>);
+}
+
+
+template<typename T, typename Index>
+coo_matrix<T, Index>::coo_matrix(
+    const std::array<std::size_t, 2>& shape_
+) noexcept :
+    _shape{shape_},
+    _rows{},
+    _cols{},
+    _values{}
+{
+    static_assert(std::is_unsigned_v<Index>);
+    assert(shape_[0] <= std::numeric_limits<Index>::max());
+    assert(shape_[1] <= std::numeric_limits<Index>::max());
+}
+
+
+template<typename T, typename Index>
+coo_matrix<T, Index>::coo_matrix(ndview<const T, 2> dense) :
+    coo_matrix(dense.shape())
+{
+    const std::size_t n = _shape[1];
+    const T* data = dense.data();
+
+    for (std::size_t i = 0; i < _shape[0]; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            if (!detail::is_zero(data[i * n + j])) {
+                this->insert(i, j, data[i * n + j]);
+            }
+        }
+    }
+}
+
+
+template<typename T, typename Index>
+void coo_matrix<T, Index>::reserve(std::size_t count) {
+    _rows.reserve(count);
+    _cols.reserve(count);
+    _values.reserve(count);
+}
+
+
+template<typename T, typename Index>
+void coo_matrix<T, Index>::insert(
+    std::size_t row,
+    std::size_t col,
+    const T& value
+) {
+    assert(row < _shape[0]);
+    assert(col < _shape[1]);
+
+    _rows.push_back(detail::to_index<Index>(row));
+    _cols.push_back(detail::to_index<Index>(col));
+    _values.push_back(value);
+}
+
+
+template<typename T, typename Index>
+void coo_matrix<T, Index>::clear() noexcept {
+    _rows.clear();
+    _cols.clear();
+    _values.clear();
+}
+
+
+template<typename T, typename Index>
+const std::array<std::size_t, 2>&
+coo_matrix<T, Index>::shape() const noexcept {
+    return _shape;
+}
+
+
+template<typename T, typename Index>
+std::size_t coo_matrix<T, Index>::shape(std::size_t dim) const noexcept {
+    assert(dim < 2);
+
+    return _shape[dim];
+}
+
+
+template<typename T, typename Index>
+std::size_t coo_matrix<T, Index>::nonzero_count() const noexcept {
+    return _values.size();
+}
+
+
+template<typename T, typename Index>
+ndview<const Index, 1> coo_matrix<T, Index>::rows() const noexcept {
+    return {{ _rows.size() }, _rows.data()};
+}
+
+
+template<typename T, typename Index>
+ndview<const Index, 1> coo_matrix<T, Index>::cols() const noexcept {
+    return {{ _cols.size() }, _cols.data()};
+}
+
+
+template<typename T, typename Index>
+ndview<const T, 1> coo_matrix<T, Index>::values() const noexcept {
+    return {{ _values.size() }, _values.data()};
+}
+
+
+template<typename T, typename Index>
+void coo_matrix<T, Index>::to_dense(ndview<T, 2> dst) const noexcept {
+    assert(dst.shape() == _shape);
+
+    std::fill(dst.begin(), dst.end(), T{});
+
+    const std::size_t n = _shape[1];
+    T* data = dst.data();
+    for (std::size_t k = 0; k < _values.size(); ++k) {
+        data[std::size_t{_rows[k]} * n + _cols[k]] += _values[k];
+    }
+}
+
+
+template<typename T, typename Index>
+ndarray<T, 2> coo_matrix<T, Index>::to_ndarray() const {
+    ndarray<T, 2> result{_shape};
+    this->to_dense(result);
+
+    return result;
+}
+
+
+template<typename T, typename Index>
+csr_matrix<T, Index>::csr_matrix() :
+    _shape{},
+    _row_offsets(1, Index{0}),
+    _col_indices{},
+    _values{}
+{
+    static_assert(std::is_unsigned_v<Index>);
+}
+
+
+template<typename T, typename Index>
+csr_matrix<T, Index>::csr_matrix(ndview<const T, 2> dense) :
+    _shape{dense.shape()},
+    _row_offsets{},
+    _col_indices{},
+    _values{}
+{
+    static_assert(std::is_unsigned_v<Index>);
+    assert(_shape[1] <= std::numeric_limits<Index>::max());
+
+    const std::size_t n = _shape[1];
+    const T* data = dense.data();
+
+    _row_offsets.reserve(_shape[0] + 1);
+    _row_offsets.push_back(Index{0});
+    for (std::size_t i = 0; i < _shape[0]; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            if (!detail::is_zero(data[i * n + j])) {
+                _col_indices.push_back(detail::to_index<Index>(j));
+                _values.push_back(data[i * n + j]);
+            }
+        }
+        _row_offsets.push_back(detail::to_index<Index>(_values.size()));
+    }
+}
+
+
+template<typename T, typename Index>
+csr_matrix<T, Index>::csr_matrix(const coo_matrix<T, Index>& coo) :
+    _shape{coo.shape()},
+    _row_offsets{},
+    _col_indices{},
+    _values{}
+{
+    const std::size_t m = _shape[0];
+    const std::size_t count = coo.nonzero_count();
+    const Index* rows = coo.rows().data();
+    const Index* cols = coo.cols().data();
+    const T* values = coo.values().data();
+
+    // Counting sort of the entries by row
+    std::vector<std::size_t> starts(m + 1, 0);
+    for (std::size_t k = 0; k < count; ++k) {
+        ++starts[std::size_t{rows[k]} + 1];
+    }
+    for (std::size_t i = 0; i < m; ++i) {
+        starts[i + 1] += starts[i];
+    }
+
+    std::vector<std::size_t> order(count);
+    {
+        std::vector<std::size_t> next(starts.begin(), starts.end() - 1);
+        for (std::size_t k = 0; k < count; ++k) {
+            order[next[rows[k]]++] = k;
+        }
+    }
+
+    _row_offsets.reserve(m + 1);
+    _col_indices.reserve(count);
+    _values.reserve(count);
+
+    _row_offsets.push_back(Index{0});
+    for (std::size_t i = 0; i < m; ++i) {
+        const auto first =
+            order.begin() + static_cast<std::ptrdiff_t>(starts[i]);
+        const auto last =
+            order.begin() + static_cast<std::ptrdiff_t>(starts[i + 1]);
+        std::stable_sort(first, last, [cols](std::size_t a, std::size_t b) {
+            return cols[a] < cols[b];
+        });
+
+        const std::size_t row_start = _values.size();
+        for (auto it = first; it != last; ++it) {
+            if (_values.size() > row_start &&
+                    _col_indices.back() == cols[*it]) {
+                _values.back() += values[*it];
+            } else {
+                _col_indices.push_back(cols[*it]);
+                _values.push_back(values[*it]);
+            }
+        }
+        _row_offsets.push_back(detail::to_index<Index>(_values.size()));
+    }
+}
+
+
+template<typename T, typename Index>
+const std::array<std::size_t, 2>&
+csr_matrix<T, Index>::shape() const noexcept {
+    return _shape;
+}
+
+
+template<typename T, typename Index>
+std::size_t csr_matrix<T, Index>::shape(std::size_t dim) const noexcept {
+    assert(dim < 2);
+
+    return _shape[dim];
+}
+
+
+template<typename T, typename Index>
+std::size_t csr_matrix<T, Index>::nonzero_count() const noexcept {
+    return _values.size();
+}
+
+
+template<typename T, typename Index>
+ndview<const Index, 1> csr_matrix<T, Index>::row_offsets() const noexcept {
+    return {{ _row_offsets.size() }, _row_offsets.data()};
+}
+
+
+template<typename T, typename Index>
+ndview<const Index, 1> csr_matrix<T, Index>::col_indices() const noexcept {
+    return {{ _col_indices.size() }, _col_indices.data()};
+}
+
+
+template<typename T, typename Index>
+ndview<T, 1> csr_matrix<T, Index>::values() noexcept {
+    return {{ _values.size() }, _values.data()};
+}
+
+
+template<typename T, typename Index>
+ndview<const T, 1> csr_matrix<T, Index>::values() const noexcept {
+    return {{ _values.size() }, _values.data()};
+}
+
+
+template<typename T, typename Index>
+void csr_matrix<T, Index>::to_dense(ndview<T, 2> dst) const noexcept {
+    assert(dst.shape() == _shape);
+
+    std::fill(dst.begin(), dst.end(), T{});
+
+    const std::size_t n = _shape[1];
+    T* data = dst.data();
+    for (std::size_t i = 0; i < _shape[0]; ++i) {
+        for (std::size_t k = _row_offsets[i]; k < _row_offsets[i + 1]; ++k) {
+            data[i * n + _col_indices[k]] = _values[k];
+        }
+    }
+}
+
+
+template<typename T, typename Index>
+ndarray<T, 2> csr_matrix<T, Index>::to_ndarray() const {
+    ndarray<T, 2> result{_shape};
+    this->to_dense(result);
+
+    return result;
+}
+
+
+template<typename T, typename Index>
+void mul(
+    const csr_matrix<T, Index>& A,
+    detail::nondeduced_t<ndview<const T, 1>> x,
+    detail::nondeduced_t<ndview<T, 1>> y,
+    std::size_t thread_count
+) {
+    assert(x.shape(0) == A.shape(1));
+    assert(y.shape(0) == A.shape(0));
+
+    const Index* row_offsets = A.row_offsets().data();
+    const Index* col_indices = A.col_indices().data();
+    const T* values = A.values().data();
+
+    detail::parallel_rows(
+        row_offsets,
+        A.shape(0),
+        thread_count,
+        [&](std::size_t first_row, std::size_t last_row) {
+            detail::csr_mul_rows(
+                row_offsets, col_indices, values,
+                x.data(), y.data(),
+                first_row, last_row
+            );
+        }
+    );
+}
+
+
+template<typename T, typename Index>
+void mul(
+    const csr_matrix<T, Index>& A,
+    detail::nondeduced_t<ndview<const T, 2>> B,
+    detail::nondeduced_t<ndview<T, 2>> C,
+    std::size_t thread_count
+) {
+    assert(B.shape(0) == A.shape(1));
+    assert(C.shape(0) == A.shape(0));
+    assert(C.shape(1) == B.shape(1));
+
+    const Index* row_offsets = A.row_offsets().data();
+    const Index* col_indices = A.col_indices().data();
+    const T* values = A.values().data();
+
+    detail::parallel_rows(
+        row_offsets,
+        A.shape(0),
+        thread_count,
+        [&](std::size_t first_row, std::size_t last_row) {
+            detail::csr_mul_rows(
+                row_offsets, col_indices, values,
+                B.data(), C.data(), B.shape(1),
+                first_row, last_row
+            );
+        }
+    );
+}
+
+
+template<typename T, typename Index>
+void mul(
+    const coo_matrix<T, Index>& A,
+    detail::nondeduced_t<ndview<const T, 1>> x,
+    detail::nondeduced_t<ndview<T, 1>> y
+) noexcept {
+    assert(x.shape(0) == A.shape(1));
+    assert(y.shape(0) == A.shape(0));
+
+    std::fill(y.begin(), y.end(), T{});
+
+    const Index* rows = A.rows().data();
+    const Index* cols = A.cols().data();
+    const T* values = A.values().data();
+    for (std::size_t k = 0; k < A.nonzero_count(); ++k) {
+        y[rows[k]] += values[k] * x[cols[k]];
+    }
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_SPARSE_IPP_
@@ -0,0 +1,330 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_TEXT_IPP_
+#define VT_NDARRAY_IMPL_TEXT_IPP_
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <ios>
+#include <locale>
+#include <ostream>
+#include <type_traits>
+
+
+namespace vt {
+
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_character_v =
+    std::is_same_v<T, char> ||
+    std::is_same_v<T, signed char> ||
+    std::is_same_v<T, unsigned char> ||
+    std::is_same_v<T, wchar_t> ||
+#if defined(__cpp_char8_t)
+    std::is_same_v<T, char8_t> ||
+#endif
+    std::is_same_v<T, char16_t> ||
+    std::is_same_v<T, char32_t>;
+
+
+// Types that can be formatted with std::to_chars. Characters and booleans
+// are excluded, since streams format them differently from numbers.
+template<typename T>
+inline constexpr bool is_chars_formattable_v =
+    (
+        std::is_integral_v<T> &&
+        !std::is_same_v<T, bool> &&
+        !is_character_v<T>
+    )
+#if defined(__cpp_lib_to_chars)
+    || std::is_floating_point_v<T>
+#endif
+    ;
+
+
+struct number_format {
+    std::chars_format format = std::chars_format::general;
+    // Negative for the shortest representation that round-trips
+    int precision = -1;
+};
+
+
+// Determines whether the formatting state of a stream can be reproduced with
+// std::to_chars, and if so, with which format.
+inline bool stream_number_format(const std::ios_base& os, number_format& fmt) {
+    const std::ios_base::fmtflags flags = os.flags();
+    const std::ios_base::fmtflags unsupported =
+        std::ios_base::showpos |
+        std::ios_base::showpoint |
+        std::ios_base::showbase |
+        std::ios_base::uppercase;
+
+    if (flags & unsupported) return false;
+    if (os.width() != 0) return false;
+    if (os.getloc() != std::locale::classic()) return false;
+
+    const std::ios_base::fmtflags base = flags & std::ios_base::basefield;
+    if (base != std::ios_base::dec && base != std::ios_base::fmtflags{}) {
+        return false;
+    }
+
+    const std::ios_base::fmtflags floatfield =
+        flags & std::ios_base::floatfield;
+    if (floatfield == std::ios_base::fixed) {
+        fmt.format = std::chars_format::fixed;
+    } else if (floatfield == std::ios_base::scientific) {
+        fmt.format = std::chars_format::scientific;
+    } else if (floatfield == std::ios_base::fmtflags{}) {
+        fmt.format = std::chars_format::general;
+    } else {
+        // Stream hexfloat output has a 0x-prefix, which to_chars omits
+        return false;
+    }
+    fmt.precision = static_cast<int>(os.precision());
+
+    return true;
+}
+
+
+// Collects formatted output in a local buffer, so that the stream is only
+// accessed once per few thousand characters instead of once per element.
+class buffered_text_sink {
+public:
+    buffered_text_sink(std::ostream& os, const number_format& fmt) noexcept;
+
+    buffered_text_sink(const buffered_text_sink&) = delete;
+    buffered_text_sink& operator=(const buffered_text_sink&) = delete;
+
+    void put(char c);
+    void put(const char* s, std::size_t n);
+
+    template<typename T>
+    void element(const T& value);
+
+    void flush();
+
+private:
+    static constexpr std::size_t capacity = 16384;
+    // Enough for the shortest representation of any arithmetic type
+    static constexpr std::size_t max_number_size = 128;
+
+    std::ostream& _os;
+    number_format _fmt;
+    std::size_t _size;
+    char _buffer[capacity];
+};
+
+
+class stream_text_sink {
+public:
+    explicit stream_text_sink(std::ostream& os) noexcept;
+
+    void put(char c);
+    void put(const char* s, std::size_t n);
+
+    template<typename T>
+    void element(const T& value);
+
+    void flush();
+
+private:
+    std::ostream& _os;
+};
+
+
+inline buffered_text_sink::buffered_text_sink(
+    std::ostream& os,
+    const number_format& fmt
+) noexcept :
+    _os{os},
+    _fmt{fmt},
+    _size{0}
+{
+}
+
+
+inline void buffered_text_sink::put(char c) {
+    if (_size == capacity) this->flush();
+
+    _buffer[_size++] = c;
+}
+
+
+inline void buffered_text_sink::put(const char* s, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        this->put(s[i]);
+    }
+}
+
+
+template<typename T>
+void buffered_text_sink::element(const T& value) {
+    static_assert(is_chars_formattable_v<T>);
+
+    if (capacity - _size < max_number_size) this->flush();
+
+    char* first = _buffer + _size;
+    char* last = _buffer + capacity;
+
+    std::to_chars_result result;
+    if constexpr (std::is_floating_point_v<T>) {
+        result = _fmt.precision < 0 ?
+            std::to_chars(first, last, value, _fmt.format) :
+            std::to_chars(first, last, value, _fmt.format, _fmt.precision);
+    } else {
+        result = std::to_chars(first, last, value);
+    }
+
+    if (result.ec == std::errc{}) {
+        _size = static_cast<std::size_t>(result.ptr - _buffer);
+    } else {
+        // Only happens for very large precisions in fixed notation
+        this->flush();
+        _os << value;
+    }
+}
+
+
+inline void buffered_text_sink::flush() {
+    _os.write(_buffer, static_cast<std::streamsize>(_size));
+    _size = 0;
+}
+
+
+inline stream_text_sink::stream_text_sink(std::ostream& os) noexcept :
+    _os{os}
+{
+}
+
+
+inline void stream_text_sink::put(char c) {
+    _os.put(c);
+}
+
+
+inline void stream_text_sink::put(const char* s, std::size_t n) {
+    _os.write(s, static_cast<std::streamsize>(n));
+}
+
+
+template<typename T>
+void stream_text_sink::element(const T& value) {
+    _os << value;
+}
+
+
+inline void stream_text_sink::flush() {
+}
+
+
+// Writes nested, bracketed output by walking the data with offsets instead of
+// creating sub-views. The innermost dimension is a contiguous run of
+// elements. Dimensions longer than 2 * edge_items are summarized with "..."
+// if summarize is set.
+template<typename T, std::size_t N, typename Sink>
+void write_nested(
+    Sink& sink,
+    const T* data,
+    const std::array<std::size_t, N>& shape,
+    const std::array<std::size_t, N>& strides,
+    std::size_t dim,
+    bool summarize,
+    std::size_t edge_items
+) {
+    const std::size_t n = shape[dim];
+    const bool skip = summarize && n > 2 * edge_items;
+
+    sink.put('[');
+
+    if (skip && edge_items == 0) {
+        sink.put("...", 3);
+        sink.put(']');
+        return;
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        if (i > 0) sink.put(',');
+        if (skip && i == edge_items) {
+            sink.put("...,", 4);
+            i = n - edge_items;
+        }
+
+        if (dim + 1 == N) {
+            sink.element(data[i]);
+        } else {
+            write_nested(
+                sink,
+                data + i * strides[dim],
+                shape,
+                strides,
+                dim + 1,
+                summarize,
+                edge_items
+            );
+        }
+    }
+
+    sink.put(']');
+}
+
+
+template<std::size_t N>
+std::array<std::size_t, N> row_major_strides(
+    const std::array<std::size_t, N>& shape
+) noexcept {
+    std::array<std::size_t, N> strides;
+    std::size_t stride = 1;
+    for (std::size_t i = N; i-- > 0;) {
+        strides[i] = stride;
+        stride *= shape[i];
+    }
+
+    return strides;
+}
+
+
+template<typename T, std::size_t N, typename Sink>
+void write_text(
+    Sink& sink,
+    const T* data,
+    const std::array<std::size_t, N>& shape,
+    bool summarize,
+    std::size_t edge_items
+) {
+    write_nested(
+        sink,
+        data,
+        shape,
+        row_major_strides(shape),
+        0,
+        summarize,
+        edge_items
+    );
+    sink.flush();
+}
+
+} // namespace detail
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_TEXT_IPP_
@@ -0,0 +1,351 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_IMPL_TOPOLOGY_IPP_
+#define VT_NDARRAY_IMPL_TOPOLOGY_IPP_
+
+#include <vt/ndarray/allocator.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <thread>
+
+#if defined(__APPLE__)
+#   include <sys/sysctl.h>
+#   include <sys/types.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#   include <cpuid.h>
+#   define VT_NDARRAY_CPUID
+#endif
+
+
+namespace vt {
+
+namespace detail {
+
+// Typical sizes, for when the caches cannot be probed
+inline constexpr std::size_t default_l1d_cache_size = 32 * 1024;
+inline constexpr std::size_t default_l2_cache_size = 256 * 1024;
+inline constexpr std::size_t default_l3_cache_size = 8 * 1024 * 1024;
+
+
+constexpr bool is_pow2(std::size_t x) noexcept {
+    return x != 0 && (x & (x - 1)) == 0;
+}
+
+
+// Parses the decimal number that c points to, and moves c past it. Returns
+// false if there is no number, or if it does not fit in a std::size_t.
+inline bool parse_number(const char*& c, std::size_t& value) noexcept {
+    const char* first = c;
+
+    value = 0;
+    for (; *c >= '0' && *c <= '9'; ++c) {
+        const std::size_t digit = static_cast<std::size_t>(*c - '0');
+        if (value > (std::numeric_limits<std::size_t>::max() - digit) / 10) {
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+
+    return c != first;
+}
+
+
+// Parses a byte count with an optional K, M or G suffix, as in sysfs. Returns
+// 0 if the text is not a valid count, or if the count does not fit in a
+// std::size_t.
+inline std::size_t parse_size(const char* text) noexcept {
+    if (text == nullptr) return 0;
+
+    std::size_t value = 0;
+    const char* c = text;
+    if (!parse_number(c, value)) return 0;
+
+    std::size_t unit = 1;
+    switch (*c) {
+        case 'K': case 'k': unit = 1024; ++c; break;
+        case 'M': case 'm': unit = 1024 * 1024; ++c; break;
+        case 'G': case 'g': unit = 1024 * 1024 * 1024; ++c; break;
+        default: break;
+    }
+    if (value > std::numeric_limits<std::size_t>::max() / unit) return 0;
+    value *= unit;
+
+    // Trailing whitespace, such as the newline of a sysfs file, is allowed
+    while (*c == ' ' || *c == '\n' || *c == '\t') {
+        ++c;
+    }
+
+    return *c == '\0' ? value : 0;
+}
+
+
+// Reads the first line of a small text file. Returns false if the file cannot
+// be read.
+template<std::size_t Size>
+bool read_line(const char* path, char (&buffer)[Size]) noexcept {
+    std::FILE* file = std::fopen(path, "r");
+    if (file == nullptr) return false;
+
+    const bool success =
+        std::fgets(buffer, static_cast<int>(Size), file) != nullptr;
+    std::fclose(file);
+
+    return success;
+}
+
+
+// Calls f for each CPU in a list such as "0-3,8,10-11", the format of
+// /sys/devices/system/cpu/online. Returns false if the list is malformed.
+template<typename F>
+bool for_each_cpu(const char* list, F&& f) noexcept {
+    const char* c = list;
+
+    while (true) {
+        std::size_t first = 0;
+        if (!parse_number(c, first)) return false;
+
+        std::size_t last = first;
+        if (*c == '-') {
+            ++c;
+            if (!parse_number(c, last) || last < first) return false;
+        }
+
+        for (std::size_t cpu = first; cpu <= last; ++cpu) {
+            f(cpu);
+        }
+
+        if (*c != ',') break;
+        ++c;
+    }
+
+    return *c == '\0' || *c == '\n';
+}
+
+
+// Fills in the caches described in /sys/devices/system/cpu/cpu0/cache, and
+// counts cores as the online CPUs that come first among their thread
+// siblings.
+inline void probe_sysfs(cpu_topology& topology) noexcept {
+    char path[128];
+    char line[256];
+
+    for (int i = 0; i < 16; ++i) {
+        const char* format = "/sys/devices/system/cpu/cpu0/cache/index%d/%s";
+
+        std::snprintf(path, sizeof(path), format, i, "type");
+        if (!read_line(path, line)) break;
+        if (line[0] == 'I') continue;
+
+        std::snprintf(path, sizeof(path), format, i, "level");
+        if (!read_line(path, line)) continue;
+        const std::size_t level = parse_size(line);
+
+        std::snprintf(path, sizeof(path), format, i, "size");
+        const std::size_t size = read_line(path, line) ? parse_size(line) : 0;
+
+        std::snprintf(path, sizeof(path), format, i, "coherency_line_size");
+        if (read_line(path, line) && level == 1) {
+            topology.cache_line_size = parse_size(line);
+        }
+
+        if (level == 1) topology.l1d_cache_size = size;
+        if (level == 2) topology.l2_cache_size = size;
+        if (level == 3) topology.l3_cache_size = size;
+    }
+
+    char online[256];
+    if (!read_line("/sys/devices/system/cpu/online", online)) return;
+
+    std::size_t core_count = 0;
+    const bool valid = for_each_cpu(online, [&](std::size_t cpu) {
+        std::snprintf(
+            path, sizeof(path),
+            "/sys/devices/system/cpu/cpu%zu/topology/thread_siblings_list",
+            cpu
+        );
+        if (!read_line(path, line)) return;
+
+        const char* c = line;
+        std::size_t first_sibling = 0;
+        if (parse_number(c, first_sibling) && first_sibling == cpu) {
+            ++core_count;
+        }
+    });
+    if (valid) topology.core_count = core_count;
+}
+
+
+#if defined(__APPLE__)
+
+inline std::size_t sysctl_value(const char* name) noexcept {
+    std::int64_t value = 0;
+    std::size_t size = sizeof(value);
+    if (::sysctlbyname(name, &value, &size, nullptr, 0) != 0) return 0;
+
+    return value > 0 ? static_cast<std::size_t>(value) : 0;
+}
+
+
+inline void probe_sysctl(cpu_topology& topology) noexcept {
+    topology.cache_line_size = sysctl_value("hw.cachelinesize");
+    topology.l1d_cache_size = sysctl_value("hw.l1dcachesize");
+    topology.l2_cache_size = sysctl_value("hw.l2cachesize");
+    topology.l3_cache_size = sysctl_value("hw.l3cachesize");
+    topology.core_count = sysctl_value("hw.physicalcpu");
+}
+
+#endif
+
+
+#ifdef VT_NDARRAY_CPUID
+
+// Reads the deterministic cache parameters of CPUID leaf 4 (Intel) or
+// 0x8000001D (AMD), which share a layout.
+inline void probe_cpuid(cpu_topology& topology) noexcept {
+    const unsigned leaves[] = { 4, 0x8000001D };
+
+    for (const unsigned leaf : leaves) {
+        if (__get_cpuid_max(leaf & 0x80000000, nullptr) < leaf) continue;
+
+        for (unsigned i = 0; i < 16; ++i) {
+            unsigned eax, ebx, ecx, edx;
+            __cpuid_count(leaf, i, eax, ebx, ecx, edx);
+
+            const unsigned type = eax & 0x1F;
+            if (type == 0) break;
+            if (type == 2) continue;
+
+            const std::size_t level = (eax >> 5) & 0x7;
+            const std::size_t line_size = (ebx & 0xFFF) + 1;
+            const std::size_t size =
+                (((ebx >> 22) & 0x3FF) + 1) *
+                (((ebx >> 12) & 0x3FF) + 1) *
+                line_size *
+                (std::size_t{ecx} + 1);
+
+            if (level == 1) {
+                topology.cache_line_size = line_size;
+                topology.l1d_cache_size = size;
+            }
+            if (level == 2) topology.l2_cache_size = size;
+            if (level == 3) topology.l3_cache_size = size;
+        }
+
+        if (topology.l1d_cache_size != 0) return;
+    }
+}
+
+#endif
+
+
+// Replaces probed values with those of the environment variables that are
+// set, and falls back to defaults for values that remain unknown.
+template<typename Getenv>
+void finish_topology(cpu_topology& topology, Getenv&& getenv) noexcept {
+    const struct {
+        const char* name;
+        std::size_t cpu_topology::* member;
+    } overrides[] = {
+        { "VT_NDARRAY_CACHE_LINE_SIZE", &cpu_topology::cache_line_size },
+        { "VT_NDARRAY_L1D_CACHE_SIZE", &cpu_topology::l1d_cache_size },
+        { "VT_NDARRAY_L2_CACHE_SIZE", &cpu_topology::l2_cache_size },
+        { "VT_NDARRAY_L3_CACHE_SIZE", &cpu_topology::l3_cache_size },
+        { "VT_NDARRAY_CORE_COUNT", &cpu_topology::core_count },
+        { "VT_NDARRAY_THREAD_COUNT", &cpu_topology::thread_count }
+    };
+
+    for (const auto& entry : overrides) {
+        const std::size_t value = parse_size(getenv(entry.name));
+        if (value != 0) topology.*entry.member = value;
+    }
+
+    // The line size becomes an allocation alignment, which must be a power
+    // of two
+    if (!is_pow2(topology.cache_line_size) ||
+        topology.cache_line_size > 4096) {
+        topology.cache_line_size = cache_line_size;
+    }
+    if (topology.l1d_cache_size == 0) {
+        topology.l1d_cache_size = default_l1d_cache_size;
+    }
+    if (topology.l2_cache_size == 0) {
+        topology.l2_cache_size = default_l2_cache_size;
+    }
+    if (topology.l3_cache_size == 0) {
+        topology.l3_cache_size = default_l3_cache_size;
+    }
+    if (topology.thread_count == 0) {
+        topology.thread_count = 1;
+    }
+    if (topology.core_count == 0 ||
+        topology.core_count > topology.thread_count) {
+        topology.core_count = topology.thread_count;
+    }
+}
+
+} // namespace detail
+
+
+inline cpu_topology cpu_topology::probe() noexcept {
+    cpu_topology topology{};
+    topology.thread_count = std::thread::hardware_concurrency();
+
+#if defined(__linux__)
+    detail::probe_sysfs(topology);
+#elif defined(__APPLE__)
+    detail::probe_sysctl(topology);
+#endif
+
+#ifdef VT_NDARRAY_CPUID
+    if (topology.l1d_cache_size == 0) {
+        detail::probe_cpuid(topology);
+    }
+#endif
+
+    detail::finish_topology(topology, [](const char*) {
+        return static_cast<const char*>(nullptr);
+    });
+
+    return topology;
+}
+
+
+inline const cpu_topology& cpu_topology::get() noexcept {
+    static const cpu_topology topology = [] {
+        cpu_topology result = cpu_topology::probe();
+        detail::finish_topology(result, [](const char* name) {
+            return static_cast<const char*>(std::getenv(name));
+        });
+
+        return result;
+    }();
+
+    return topology;
+}
+
+} // namespace vt
+
+#endif // VT_NDARRAY_IMPL_TOPOLOGY_IPP_
@@ -21,7 +21,11 @@
 #ifndef VT_NDARRAY_IMPL_VIEW_IPP_
 #define VT_NDARRAY_IMPL_VIEW_IPP_
 
+#include <vt/ndarray/impl/text.ipp>
+
 #include <cassert>
+#include <sstream>
+#include <type_traits>
 #include <utility>
 
 
@@ -59,6 +63,62 @@ constexpr std::array<std::size_t, N> to_array(
     return to_array_impl(shape, std::make_index_sequence<N>{});
 }
 
+
+// Excludes a function parameter from template argument deduction, so that
+// arrays convert to views of the type deduced from the other parameters.
+template<typename T>
+struct nondeduced {
+    using type = T;
+};
+
+template<typename T>
+using nondeduced_t = typename nondeduced<T>::type;
+
+
+// Converts an element of an index array to a position
+template<typename Index>
+constexpr std::size_t to_size(Index idx) noexcept {
+    if constexpr (std::is_same_v<Index, std::size_t>) {
+        return idx;
+    } else {
+        return static_cast<std::size_t>(idx);
+    }
+}
+
+
+// Lanes of length `length` along an axis. The elements of a lane are `inner`
+// apart.
+struct lane_layout {
+    std::size_t outer;
+    std::size_t length;
+    std::size_t inner;
+
+    std::size_t count() const noexcept {
+        return outer * inner;
+    }
+
+    std::size_t offset(std::size_t lane) const noexcept {
+        return lane / inner * length * inner + lane % inner;
+    }
+};
+
+
+template<std::size_t N>
+lane_layout get_lane_layout(
+    const std::array<std::size_t, N>& shape,
+    std::size_t axis
+) noexcept {
+    assert(axis < N);
+
+    lane_layout layout{1, shape[axis], 1};
+    for (std::size_t i = 0; i < N; ++i) {
+        if (i < axis) layout.outer *= shape[i];
+        if (i > axis) layout.inner *= shape[i];
+    }
+
+    return layout;
+}
+
 } // namespace detail
 
 
@@ -74,8 +134,12 @@ constexpr ndview<T, N>::ndview(
 
 
 template<typename T, std::size_t N>
-decltype(auto) ndview<T, N>::operator[](std::size_t idx) const noexcept {
-    assert(idx < _shape[0]);
+constexpr decltype(auto) ndview<T, N>::operator[](
+    std::size_t idx
+) const noexcept {
+    detail::check_index(
+        "vt::ndview::operator[]: index out of range", idx, _shape
+    );
 
     if constexpr (N > 1) {
         const std::array<std::size_t, N - 1> subshape_ = this->subshape();
@@ -122,7 +186,11 @@ template<std::size_t M>
 constexpr ndview<T, M> ndview<T, N>::reshape(
     const std::array<std::size_t, M>& new_shape
 ) const noexcept {
-    assert(detail::count_elements(new_shape) == this->element_count());
+    detail::check_reshape(
+        "vt::ndview::reshape: element count mismatch",
+        this->element_count(),
+        new_shape
+    );
 
     return { new_shape, this->data() };
 }
@@ -158,8 +226,9 @@ constexpr ndview<T, N> ndview<T, N>::slice(std::size_t offset) const noexcept {
 template<typename T, std::size_t N>
 constexpr ndview<T, N>
 ndview<T, N>::slice(std::size_t offset, std::size_t count) const noexcept {
-    assert(offset <= _shape[0]);
-    assert(offset + count <= _shape[0]);
+    detail::check_slice(
+        "vt::ndview::slice: range out of bounds", offset, count, _shape
+    );
 
     if constexpr (N > 1) {
         auto slice_shape = _shape;
@@ -229,8 +298,9 @@ constexpr typename ndview<T, N>::const_reverse_iterator ndview<T, N>::crend(
 
 
 template<typename T, std::size_t N>
-std::array<std::size_t, N - 1> ndview<T, N>::subshape() const noexcept {
-    std::array<std::size_t, N - 1> subshape_;
+constexpr std::array<std::size_t, N - 1> ndview<T, N>::subshape(
+) const noexcept {
+    std::array<std::size_t, N - 1> subshape_{};
     for (std::size_t i = 0; i < N - 1; ++i) {
         subshape_[i] = _shape[i + 1];
     }
@@ -241,14 +311,32 @@ std::array<std::size_t, N - 1> ndview<T, N>::subshape() const noexcept {
 
 template<typename T, std::size_t N>
 std::ostream& operator<<(std::ostream& os, ndview<const T, N> a) {
-    const std::size_t n = a.shape(0);
+    using value_type = std::remove_cv_t<T>;
 
-    os << '[';
-    if (n > 0) os << a[0];
-    for (std::size_t i = 1; i < n; ++i) {
-        os << ',' << a[i];
+    // A field width applies to the output as a whole
+    if (os.width() != 0) {
+        std::ostringstream ss;
+        ss.copyfmt(os);
+        ss.width(0);
+        ss << a;
+
+        return os << ss.str();
     }
-    os << ']';
+
+    // Numbers are formatted with std::to_chars into a local buffer whenever
+    // that gives the same output as the stream would.
+    if constexpr (detail::is_chars_formattable_v<value_type>) {
+        detail::number_format fmt;
+        if (detail::stream_number_format(os, fmt)) {
+            detail::buffered_text_sink sink{os, fmt};
+            detail::write_text(sink, a.data(), a.shape(), false, 0);
+
+            return os;
+        }
+    }
+
+    detail::stream_text_sink sink{os};
+    detail::write_text(sink, a.data(), a.shape(), false, 0);
 
     return os;
 }
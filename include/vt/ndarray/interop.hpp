@@ -0,0 +1,186 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_INTEROP_HPP_
+#define VT_NDARRAY_INTEROP_HPP_
+
+#include <vt/ndarray/allocator.hpp>
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if __has_include(<version>)
+#   include <version>
+#endif
+
+#if defined(__cpp_lib_mdspan)
+#   include <mdspan>
+#endif
+
+#if !defined(DLPACK_DLPACK_H_) && __has_include(<dlpack/dlpack.h>)
+#   include <dlpack/dlpack.h>
+#endif
+
+// Without <dlpack/dlpack.h>, the subset of DLPack 0.8 that is used here is
+// declared with the same include guard and layout, so that tensors can be
+// exchanged with any other implementation of the ABI.
+#ifndef DLPACK_DLPACK_H_
+#define DLPACK_DLPACK_H_
+
+#define DLPACK_VERSION 80
+#define DLPACK_ABI_VERSION 1
+
+extern "C" {
+
+typedef enum : std::int32_t {
+    kDLCPU = 1,
+    kDLCUDA = 2,
+    kDLCUDAHost = 3,
+    kDLOpenCL = 4,
+    kDLVulkan = 7,
+    kDLMetal = 8,
+    kDLVPI = 9,
+    kDLROCM = 10,
+    kDLROCMHost = 11,
+    kDLExtDev = 12,
+    kDLCUDAManaged = 13,
+    kDLOneAPI = 14,
+    kDLWebGPU = 15,
+    kDLHexagon = 16
+} DLDeviceType;
+
+typedef struct {
+    DLDeviceType device_type;
+    std::int32_t device_id;
+} DLDevice;
+
+typedef enum {
+    kDLInt = 0U,
+    kDLUInt = 1U,
+    kDLFloat = 2U,
+    kDLOpaqueHandle = 3U,
+    kDLBfloat = 4U,
+    kDLComplex = 5U,
+    kDLBool = 6U
+} DLDataTypeCode;
+
+typedef struct {
+    std::uint8_t code;
+    std::uint8_t bits;
+    std::uint16_t lanes;
+} DLDataType;
+
+typedef struct {
+    void* data;
+    DLDevice device;
+    std::int32_t ndim;
+    DLDataType dtype;
+    std::int64_t* shape;
+    std::int64_t* strides;
+    std::uint64_t byte_offset;
+} DLTensor;
+
+typedef struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(struct DLManagedTensor* self);
+} DLManagedTensor;
+
+} // extern "C"
+
+#endif // DLPACK_DLPACK_H_
+
+
+namespace vt {
+
+#if defined(__cpp_lib_mdspan)
+
+template<typename T, std::size_t N>
+std::mdspan<T, std::dextents<std::size_t, N>> to_mdspan(
+    ndview<T, N> view
+) noexcept;
+
+template<typename T, typename Extents>
+ndview<T, Extents::rank()> from_mdspan(
+    std::mdspan<T, Extents, std::layout_right> span
+) noexcept;
+
+#endif
+
+
+template<typename T, std::size_t N, typename Allocator>
+DLManagedTensor* to_dlpack(ndarray<T, N, Allocator>&& array);
+
+
+// Owner of a DLPack tensor that is viewed as an ndview
+template<typename T, std::size_t N>
+class dlpack_tensor {
+public:
+    explicit dlpack_tensor(DLManagedTensor* tensor);
+    dlpack_tensor(const dlpack_tensor&) = delete;
+    dlpack_tensor(dlpack_tensor&& other) noexcept;
+
+    ~dlpack_tensor();
+
+    dlpack_tensor& operator=(const dlpack_tensor&) = delete;
+    dlpack_tensor& operator=(dlpack_tensor&& other) noexcept;
+
+    ndview<T, N> view() noexcept;
+    ndview<const T, N> view() const noexcept;
+
+    const std::array<std::size_t, N>& shape() const noexcept;
+
+    DLManagedTensor* release() noexcept;
+
+private:
+    DLManagedTensor* _tensor;
+    ndview<T, N> _view;
+};
+
+
+// Same fields as Py_buffer, so that a getbufferproc can fill it in without
+// copying. The shape and strides are in elements and bytes respectively.
+template<std::size_t N>
+struct buffer_info {
+    void* buf;
+    std::ptrdiff_t len;
+    std::ptrdiff_t itemsize;
+    bool readonly;
+    int ndim;
+    const char* format;
+    std::array<std::ptrdiff_t, N> shape;
+    std::array<std::ptrdiff_t, N> strides;
+};
+
+
+template<typename T, std::size_t N>
+buffer_info<N> to_buffer(ndview<T, N> view) noexcept;
+
+template<typename T, std::size_t N>
+ndview<T, N> from_buffer(const buffer_info<N>& info);
+
+} // namespace vt
+
+#include <vt/ndarray/impl/interop.ipp>
+
+#endif // VT_NDARRAY_INTEROP_HPP_
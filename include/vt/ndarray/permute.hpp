@@ -0,0 +1,50 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_PERMUTE_HPP_
+#define VT_NDARRAY_PERMUTE_HPP_
+
+#include <vt/ndarray/topology.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+
+
+namespace vt {
+
+// Copies src into dst with its axes permuted, such that axis i of dst is
+// axis axes[i] of src.
+template<typename T, std::size_t N>
+void permute_copy(
+    detail::nondeduced_t<ndview<const T, N>> src,
+    ndview<T, N> dst,
+    const std::array<std::size_t, N>& axes
+) noexcept;
+
+// Transposes a square matrix in place.
+template<typename T>
+void transpose(ndview<T, 2> a) noexcept;
+
+} // namespace vt
+
+#include <vt/ndarray/impl/permute.ipp>
+
+#endif // VT_NDARRAY_PERMUTE_HPP_
@@ -0,0 +1,211 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_PIPELINE_HPP_
+#define VT_NDARRAY_PIPELINE_HPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace vt {
+
+namespace detail {
+
+template<typename T, std::size_t N>
+struct ndarray_pool_state;
+
+
+// Fixed set of worker threads executing submitted tasks in order of
+// submission. The tasks are kept in a ring buffer that only grows, so that
+// submitting small tasks does not allocate once it is large enough.
+class thread_pool {
+public:
+    explicit thread_pool(std::size_t thread_count);
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool();
+
+    void submit(std::function<void()> task);
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _ready;
+    std::vector<std::function<void()>> _tasks;
+    std::size_t _first_task;
+    std::size_t _task_count;
+    bool _stopping;
+    std::vector<std::thread> _threads;
+
+    void grow();
+    void run() noexcept;
+};
+
+} // namespace detail
+
+
+// An ndarray borrowed from an ndarray_pool, which is handed back to the pool
+// when it is destroyed or reset.
+template<typename T, std::size_t N>
+class pooled_ndarray {
+public:
+    pooled_ndarray() noexcept;
+    pooled_ndarray(pooled_ndarray&& other) noexcept;
+
+    ~pooled_ndarray();
+
+    pooled_ndarray& operator=(pooled_ndarray&& other) noexcept;
+
+    operator ndview<T, N>() noexcept;
+    operator ndview<const T, N>() const noexcept;
+
+    ndview<T, N> view() noexcept;
+    ndview<const T, N> view() const noexcept;
+    ndview<const T, N> cview() const noexcept;
+
+    const std::array<std::size_t, N>& shape() const noexcept;
+
+    explicit operator bool() const noexcept;
+
+    void reset() noexcept;
+
+private:
+    template<typename, std::size_t>
+    friend class ndarray_pool;
+
+    std::shared_ptr<detail::ndarray_pool_state<T, N>> _pool;
+    ndarray<T, N> _array;
+
+    pooled_ndarray(
+        std::shared_ptr<detail::ndarray_pool_state<T, N>> pool,
+        ndarray<T, N>&& array
+    ) noexcept;
+};
+
+
+// Recycles ndarrays by shape. At most `capacity` idle arrays are kept per
+// shape; arrays handed back beyond that are freed.
+template<typename T, std::size_t N>
+class ndarray_pool {
+public:
+    explicit ndarray_pool(std::size_t capacity);
+
+    pooled_ndarray<T, N> acquire(const std::array<std::size_t, N>& shape);
+
+    std::size_t capacity() const noexcept;
+    std::size_t idle_count() const;
+    std::size_t allocation_count() const noexcept;
+
+    void clear();
+
+private:
+    std::shared_ptr<detail::ndarray_pool_state<T, N>> _state;
+};
+
+
+struct pipeline_stage_stats {
+    std::string name;
+    std::size_t frame_count;
+    std::chrono::nanoseconds total_time;
+    std::chrono::nanoseconds min_time;
+    std::chrono::nanoseconds max_time;
+
+    std::chrono::nanoseconds mean_time() const noexcept;
+    double throughput() const noexcept;
+};
+
+
+// Chain of stages that each transform a frame into a new frame of a fixed
+// shape. Frames move through the stages concurrently, in order, with
+// buffers taken from an ndarray_pool.
+template<typename T, std::size_t N>
+class pipeline {
+public:
+    using stage_function =
+        std::function<void(ndview<const T, N>, ndview<T, N>)>;
+    using sink_function = std::function<void(ndview<const T, N>)>;
+
+    explicit pipeline(
+        ndarray_pool<T, N>& pool,
+        std::size_t queue_capacity = 2,
+        std::size_t thread_count = 0
+    );
+
+    pipeline(const pipeline&) = delete;
+    pipeline& operator=(const pipeline&) = delete;
+
+    ~pipeline();
+
+    pipeline& add_stage(
+        std::string name,
+        const std::array<std::size_t, N>& output_shape,
+        stage_function function
+    );
+    pipeline& set_sink(sink_function sink);
+
+    void push(ndview<const T, N> frame);
+    void push(pooled_ndarray<T, N>&& frame);
+
+    void finish();
+
+    std::vector<pipeline_stage_stats> stats() const;
+
+private:
+    struct stage;
+
+    ndarray_pool<T, N>& _pool;
+    std::size_t _queue_capacity;
+    std::vector<std::unique_ptr<stage>> _stages;
+    sink_function _sink;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _changed;
+    std::size_t _active_count;
+    std::exception_ptr _error;
+
+    // Declared last, so that the workers are joined before anything they
+    // use is destroyed
+    detail::thread_pool _threads;
+
+    void wait_for_space(std::unique_lock<std::mutex>& lock);
+    void enqueue(pooled_ndarray<T, N>&& frame);
+    void schedule(std::size_t i) noexcept;
+    void run_stage(std::size_t i) noexcept;
+};
+
+} // namespace vt
+
+#include <vt/ndarray/impl/pipeline.ipp>
+
+#endif // VT_NDARRAY_PIPELINE_HPP_
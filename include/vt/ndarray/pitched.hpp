@@ -0,0 +1,149 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_PITCHED_HPP_
+#define VT_NDARRAY_PITCHED_HPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/topology.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+
+namespace vt {
+
+// Row length, in elements, that starts every row on a cache line and makes
+// consecutive rows fall into different cache sets
+template<typename T>
+std::size_t padded_pitch(std::size_t row_length) noexcept;
+
+
+// View of an array whose rows along the last dimension are `pitch` elements
+// apart. The elements between the end of a row and the next row are padding.
+template<typename T, std::size_t N>
+class pitched_ndview {
+    static_assert(N > 1);
+
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using index_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+
+    static constexpr std::size_t dim_count = N;
+
+    constexpr pitched_ndview(
+        const std::array<std::size_t, N>& shape_,
+        std::size_t pitch_,
+        T* data_
+    ) noexcept;
+    constexpr pitched_ndview(ndview<T, N> dense) noexcept;
+
+    constexpr decltype(auto) operator[](std::size_t idx) const noexcept;
+
+    constexpr operator pitched_ndview<const T, N>() const noexcept;
+
+    constexpr std::size_t element_count() const noexcept;
+
+    constexpr const std::array<std::size_t, N>& shape() const noexcept;
+    constexpr std::size_t shape(std::size_t dim) const noexcept;
+
+    constexpr std::size_t pitch() const noexcept;
+
+    constexpr std::size_t row_count() const noexcept;
+    constexpr ndview<T, 1> row(std::size_t idx) const noexcept;
+
+    constexpr T* data() const noexcept;
+
+    constexpr pitched_ndview<T, N> slice(std::size_t offset) const noexcept;
+    constexpr pitched_ndview<T, N> slice(
+        std::size_t offset,
+        std::size_t count
+    ) const noexcept;
+
+private:
+    std::array<std::size_t, N> _shape;
+    std::size_t _pitch;
+    T* _data;
+
+    constexpr std::size_t rows_per_index() const noexcept;
+};
+
+
+// N-dimensional array with rows padded to padded_pitch<T>()
+template<typename T, std::size_t N>
+class pitched_ndarray {
+    static_assert(std::is_same_v<std::remove_cv_t<T>, T>);
+    static_assert(N > 1);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    static constexpr std::size_t dim_count = N;
+
+    pitched_ndarray() noexcept;
+    explicit pitched_ndarray(const std::array<std::size_t, N>& shape_);
+    pitched_ndarray(const std::array<std::size_t, N>& shape_, const T& init);
+    explicit pitched_ndarray(ndview<const T, N> src);
+
+    decltype(auto) operator[](std::size_t idx) noexcept;
+    decltype(auto) operator[](std::size_t idx) const noexcept;
+
+    operator pitched_ndview<T, N>() noexcept;
+    operator pitched_ndview<const T, N>() const noexcept;
+
+    pitched_ndview<T, N> view() noexcept;
+    pitched_ndview<const T, N> view() const noexcept;
+    pitched_ndview<const T, N> cview() const noexcept;
+
+    std::size_t element_count() const noexcept;
+
+    const std::array<std::size_t, N>& shape() const noexcept;
+    std::size_t shape(std::size_t dim) const noexcept;
+
+    std::size_t pitch() const noexcept;
+
+    std::size_t row_count() const noexcept;
+    ndview<T, 1> row(std::size_t idx) noexcept;
+    ndview<const T, 1> row(std::size_t idx) const noexcept;
+
+    T* data() noexcept;
+    const T* data() const noexcept;
+
+private:
+    std::array<std::size_t, N> _shape;
+    std::size_t _pitch;
+    ndarray<T, 1> _storage;
+};
+
+} // namespace vt
+
+#include <vt/ndarray/impl/pitched.ipp>
+
+#endif // VT_NDARRAY_PITCHED_HPP_
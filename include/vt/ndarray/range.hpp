@@ -0,0 +1,117 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_RANGE_HPP_
+#define VT_NDARRAY_RANGE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+
+
+namespace vt {
+
+// Multi-index of an element together with its offset in a contiguous,
+// row-major array of the iterated shape.
+template<std::size_t N>
+struct ndindex {
+    std::array<std::size_t, N> index;
+    std::size_t offset;
+
+    constexpr std::size_t operator[](std::size_t dim) const noexcept;
+};
+
+
+// Range over all multi-indices of a shape, optionally visited tile by tile.
+template<std::size_t N>
+class ndrange {
+    static_assert(N > 0);
+
+public:
+    class iterator;
+    using const_iterator = iterator;
+
+    static constexpr std::size_t dim_count = N;
+
+    constexpr explicit ndrange(
+        const std::array<std::size_t, N>& shape_
+    ) noexcept;
+    constexpr ndrange(
+        const std::array<std::size_t, N>& shape_,
+        const std::array<std::size_t, N>& tile_
+    ) noexcept;
+
+    constexpr const std::array<std::size_t, N>& shape() const noexcept;
+    constexpr const std::array<std::size_t, N>& tile() const noexcept;
+    constexpr const std::array<std::size_t, N>& strides() const noexcept;
+    constexpr std::size_t element_count() const noexcept;
+
+    constexpr iterator begin() const noexcept;
+    constexpr iterator end() const noexcept;
+
+private:
+    std::array<std::size_t, N> _shape;
+    std::array<std::size_t, N> _tile;
+    std::array<std::size_t, N> _strides;
+};
+
+
+template<std::size_t N>
+class ndrange<N>::iterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ndindex<N>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const ndindex<N>*;
+    using reference = const ndindex<N>&;
+
+    constexpr iterator() noexcept = default;
+
+    constexpr reference operator*() const noexcept;
+    constexpr pointer operator->() const noexcept;
+
+    constexpr iterator& operator++() noexcept;
+    constexpr iterator operator++(int) noexcept;
+
+    constexpr bool operator==(const iterator& other) const noexcept;
+    constexpr bool operator!=(const iterator& other) const noexcept;
+
+private:
+    friend class ndrange;
+
+    const ndrange* _range = nullptr;
+    ndindex<N> _current{};
+    std::array<std::size_t, N> _tile_first{};
+    std::array<std::size_t, N> _tile_last{};
+    std::size_t _position = 0;
+};
+
+
+template<std::size_t N, typename F>
+constexpr void for_each_row(const ndrange<N>& range, F&& f);
+
+template<std::size_t N, typename F>
+constexpr void for_each_index(const ndrange<N>& range, F&& f);
+
+} // namespace vt
+
+#include <vt/ndarray/impl/range.ipp>
+
+#endif // VT_NDARRAY_RANGE_HPP_
@@ -0,0 +1,207 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_RING_HPP_
+#define VT_NDARRAY_RING_HPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+
+namespace vt {
+
+namespace detail {
+
+// Distance between atomics that are written by different threads, so that
+// they are not on the same cache line, or on an adjacent line that is
+// prefetched along with it.
+constexpr std::size_t ring_line_size = 128;
+
+struct alignas(ring_line_size) padded_counter {
+    std::atomic<std::uint64_t> value{0};
+};
+
+
+// Producer and consumer positions of a single-producer, single-consumer
+// ring, stored elsewhere. Each side caches the last seen position of the
+// other, so that it only reads the other side's cache line when the ring
+// looks full or empty.
+class spsc_positions {
+public:
+    spsc_positions(
+        std::atomic<std::uint64_t>* head,
+        std::atomic<std::uint64_t>* tail,
+        std::size_t capacity
+    ) noexcept;
+
+    std::optional<std::uint64_t> try_begin_write() noexcept;
+    void end_write() noexcept;
+
+    std::optional<std::uint64_t> try_begin_read() noexcept;
+    void end_read() noexcept;
+
+    std::size_t capacity() const noexcept;
+
+private:
+    std::atomic<std::uint64_t>* _head;
+    std::atomic<std::uint64_t>* _tail;
+    std::size_t _capacity;
+    std::uint64_t _cached_head;
+    std::uint64_t _cached_tail;
+};
+
+
+// Preallocated frames of a ring. Every frame starts on a new cache line.
+template<typename T, std::size_t N>
+class ring_frames {
+public:
+    ring_frames(
+        const std::array<std::size_t, N>& frame_shape,
+        std::size_t capacity
+    );
+
+    ndview<T, N> operator[](std::uint64_t position) noexcept;
+
+    const std::array<std::size_t, N>& frame_shape() const noexcept;
+
+private:
+    std::array<std::size_t, N> _frame_shape;
+    std::size_t _capacity;
+    std::size_t _frame_stride;
+    ndarray<T, 1> _elements;
+};
+
+} // namespace detail
+
+
+// Ring of preallocated frames for passing frames from one producer thread to
+// one consumer thread
+template<typename T, std::size_t N>
+class spsc_frame_ring {
+public:
+    using value_type = T;
+
+    static constexpr std::size_t dim_count = N;
+
+    spsc_frame_ring(
+        const std::array<std::size_t, N>& frame_shape_,
+        std::size_t capacity_
+    );
+    spsc_frame_ring(const spsc_frame_ring&) = delete;
+
+    spsc_frame_ring& operator=(const spsc_frame_ring&) = delete;
+
+    // Producer
+    std::optional<ndview<T, N>> try_begin_write() noexcept;
+    ndview<T, N> begin_write() noexcept;
+    void end_write() noexcept;
+
+    // Consumer
+    std::optional<ndview<const T, N>> try_begin_read() noexcept;
+    ndview<const T, N> begin_read() noexcept;
+    void end_read() noexcept;
+
+    std::size_t capacity() const noexcept;
+    const std::array<std::size_t, N>& frame_shape() const noexcept;
+
+private:
+    detail::padded_counter _head;
+    detail::padded_counter _tail;
+    alignas(detail::ring_line_size) detail::spsc_positions _producer;
+    alignas(detail::ring_line_size) detail::spsc_positions _consumer;
+    detail::ring_frames<T, N> _frames;
+};
+
+
+template<typename T, std::size_t N>
+class mpmc_frame_ring;
+
+
+// A frame of an mpmc_frame_ring that is being written or read
+template<typename T, std::size_t N>
+class ring_frame {
+public:
+    operator ndview<T, N>() const noexcept;
+
+    ndview<T, N> view() const noexcept;
+
+private:
+    template<typename, std::size_t>
+    friend class mpmc_frame_ring;
+
+    ndview<T, N> _view;
+    std::uint64_t _position;
+
+    ring_frame(ndview<T, N> view_, std::uint64_t position) noexcept;
+};
+
+
+// Ring of preallocated frames for passing frames from any number of producer
+// threads to any number of consumer threads
+template<typename T, std::size_t N>
+class mpmc_frame_ring {
+public:
+    using value_type = T;
+
+    static constexpr std::size_t dim_count = N;
+
+    mpmc_frame_ring(
+        const std::array<std::size_t, N>& frame_shape_,
+        std::size_t capacity_
+    );
+    mpmc_frame_ring(const mpmc_frame_ring&) = delete;
+
+    mpmc_frame_ring& operator=(const mpmc_frame_ring&) = delete;
+
+    // Producers
+    std::optional<ring_frame<T, N>> try_begin_write() noexcept;
+    ring_frame<T, N> begin_write() noexcept;
+    void end_write(const ring_frame<T, N>& frame) noexcept;
+
+    // Consumers
+    std::optional<ring_frame<const T, N>> try_begin_read() noexcept;
+    ring_frame<const T, N> begin_read() noexcept;
+    void end_read(const ring_frame<const T, N>& frame) noexcept;
+
+    std::size_t capacity() const noexcept;
+    const std::array<std::size_t, N>& frame_shape() const noexcept;
+
+private:
+    detail::padded_counter _head;
+    detail::padded_counter _tail;
+    // Per frame: the position that may write it next, plus one once it has
+    // been written
+    std::unique_ptr<detail::padded_counter[]> _sequences;
+    std::size_t _capacity;
+    detail::ring_frames<T, N> _frames;
+};
+
+} // namespace vt
+
+#include <vt/ndarray/impl/ring.ipp>
+
+#endif // VT_NDARRAY_RING_HPP_
@@ -0,0 +1,68 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_SCAN_HPP_
+#define VT_NDARRAY_SCAN_HPP_
+
+#include <vt/ndarray/view.hpp>
+
+#include <cstddef>
+
+
+namespace vt {
+
+template<typename T, typename Source = T, std::size_t N>
+void inclusive_scan(
+    detail::nondeduced_t<ndview<const Source, N>> src,
+    ndview<T, N> dst,
+    std::size_t axis = N - 1,
+    std::size_t thread_count = 1
+);
+
+template<typename T, typename Source = T, std::size_t N>
+void exclusive_scan(
+    detail::nondeduced_t<ndview<const Source, N>> src,
+    ndview<T, N> dst,
+    detail::nondeduced_t<T> init = T{},
+    std::size_t axis = N - 1,
+    std::size_t thread_count = 1
+);
+
+template<typename T, typename Source = T>
+void integral_image(
+    detail::nondeduced_t<ndview<const Source, 2>> src,
+    ndview<T, 2> dst,
+    std::size_t thread_count = 1
+);
+
+template<typename T>
+T box_sum(
+    detail::nondeduced_t<ndview<const T, 2>> integral,
+    std::size_t row_begin,
+    std::size_t col_begin,
+    std::size_t row_end,
+    std::size_t col_end
+) noexcept;
+
+} // namespace vt
+
+#include <vt/ndarray/impl/scan.ipp>
+
+#endif // VT_NDARRAY_SCAN_HPP_
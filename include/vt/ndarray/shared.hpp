@@ -0,0 +1,158 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_SHARED_HPP_
+#define VT_NDARRAY_SHARED_HPP_
+
+#include <vt/ndarray/allocator.hpp>
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <ostream>
+#include <type_traits>
+
+
+namespace vt {
+
+template<typename T, std::size_t N, typename Allocator = ndarray_allocator<T>>
+class shared_ndarray {
+    static_assert(std::is_same_v<std::remove_cv_t<T>, T>);
+    static_assert(std::is_same_v<T, typename Allocator::value_type>);
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using array_type = ndarray<T, N, Allocator>;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = typename ndview<T, N>::iterator;
+    using const_iterator = typename ndview<T, N>::const_iterator;
+    using reverse_iterator = typename ndview<T, N>::reverse_iterator;
+    using const_reverse_iterator =
+        typename ndview<T, N>::const_reverse_iterator;
+
+    static constexpr std::size_t dim_count = N;
+
+    shared_ndarray() noexcept;
+    explicit shared_ndarray(
+        const std::array<std::size_t, N>& shape_,
+        const Allocator& alloc = Allocator{}
+    );
+    shared_ndarray(
+        const std::array<std::size_t, N>& shape_, const T& init,
+        const Allocator& alloc = Allocator{}
+    );
+    shared_ndarray(
+        const std::array<std::size_t, N>& shape_,
+        std::initializer_list<T> init,
+        const Allocator& alloc = Allocator{}
+    );
+    explicit shared_ndarray(array_type&& array);
+    shared_ndarray(const shared_ndarray& other) noexcept;
+    shared_ndarray(shared_ndarray&& other) noexcept;
+
+    ~shared_ndarray();
+
+    shared_ndarray& operator=(const shared_ndarray& other) noexcept;
+    shared_ndarray& operator=(shared_ndarray&& other) noexcept;
+
+    decltype(auto) operator[](std::size_t idx);
+    decltype(auto) operator[](std::size_t idx) const noexcept;
+
+    operator ndview<const T, N>() const noexcept;
+
+    ndview<T, N> view();
+    ndview<const T, N> view() const noexcept;
+    ndview<const T, N> cview() const noexcept;
+
+    std::size_t element_count() const noexcept;
+
+    const std::array<std::size_t, N>& shape() const noexcept;
+    std::size_t shape(std::size_t dim) const noexcept;
+
+    T* data();
+    const T* data() const noexcept;
+
+    iterator begin();
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+
+    iterator end();
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    std::size_t use_count() const noexcept;
+    bool unique() const noexcept;
+
+    void detach();
+
+    array_type to_ndarray() const;
+
+    void swap(shared_ndarray& other) noexcept;
+
+private:
+    struct block;
+
+    block* _block;
+    // Cached copy of the view into the shared buffer, so that the read path
+    // does not have to go through the control block.
+    ndview<const T, N> _view;
+
+    void release() noexcept;
+};
+
+
+template<typename T, std::size_t N, typename Allocator>
+shared_ndarray(ndarray<T, N, Allocator>&&) -> shared_ndarray<T, N, Allocator>;
+
+template<typename T, std::size_t N, typename Allocator>
+bool operator==(
+    const shared_ndarray<T, N, Allocator>& a,
+    const shared_ndarray<T, N, Allocator>& b
+);
+template<typename T, std::size_t N, typename Allocator>
+bool operator!=(
+    const shared_ndarray<T, N, Allocator>& a,
+    const shared_ndarray<T, N, Allocator>& b
+);
+
+template<typename T, std::size_t N, typename Allocator>
+std::ostream& operator<<(
+    std::ostream& os,
+    const shared_ndarray<T, N, Allocator>& a
+);
+
+template<typename T, std::size_t N, typename Allocator>
+void swap(
+    shared_ndarray<T, N, Allocator>& a,
+    shared_ndarray<T, N, Allocator>& b
+) noexcept;
+
+} // namespace vt
+
+#include <vt/ndarray/impl/shared.ipp>
+
+#endif // VT_NDARRAY_SHARED_HPP_
@@ -0,0 +1,169 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_SHM_HPP_
+#define VT_NDARRAY_SHM_HPP_
+
+#include <vt/ndarray/impl/config.ipp>
+#include <vt/ndarray/ring.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#if VT_NDARRAY_POSIX
+
+namespace vt {
+
+namespace detail {
+
+// Shared memory object mapped into the address space of this process. The
+// creator removes the name again when the mapping is destroyed.
+class shm_mapping {
+public:
+    shm_mapping() noexcept;
+    shm_mapping(const shm_mapping&) = delete;
+    shm_mapping(shm_mapping&& other) noexcept;
+
+    ~shm_mapping();
+
+    shm_mapping& operator=(const shm_mapping&) = delete;
+    shm_mapping& operator=(shm_mapping&& other) noexcept;
+
+    static shm_mapping create(const std::string& name, std::size_t size);
+    static shm_mapping open(const std::string& name, bool writable);
+
+    unsigned char* data() const noexcept;
+    std::size_t size() const noexcept;
+    const std::string& name() const noexcept;
+
+private:
+    std::string _name;
+    void* _data;
+    std::size_t _size;
+    bool _owner;
+
+    void release() noexcept;
+};
+
+} // namespace detail
+
+
+// Array in a named POSIX shared memory object, which other processes can
+// attach to. A const element type attaches read-only.
+template<typename T, std::size_t N>
+class shm_ndarray {
+public:
+    using value_type = std::remove_cv_t<T>;
+
+    static constexpr std::size_t dim_count = N;
+
+    static shm_ndarray create(
+        const std::string& name,
+        const std::array<std::size_t, N>& shape_
+    );
+    static shm_ndarray open(const std::string& name);
+
+    shm_ndarray(shm_ndarray&& other) noexcept = default;
+    shm_ndarray& operator=(shm_ndarray&& other) noexcept = default;
+
+    operator ndview<const T, N>() const noexcept;
+
+    ndview<T, N> view() noexcept;
+    ndview<const T, N> view() const noexcept;
+    ndview<const T, N> cview() const noexcept;
+
+    std::size_t element_count() const noexcept;
+
+    const std::array<std::size_t, N>& shape() const noexcept;
+    std::size_t shape(std::size_t dim) const noexcept;
+
+    T* data() noexcept;
+    const T* data() const noexcept;
+
+    const std::string& name() const noexcept;
+
+private:
+    detail::shm_mapping _mapping;
+    ndview<T, N> _view;
+
+    shm_ndarray(detail::shm_mapping&& mapping, ndview<T, N> view_) noexcept;
+};
+
+
+// Ring of fixed-shape frames in a named POSIX shared memory object, for
+// passing frames from one producer to one consumer, each of which may be in
+// another process.
+template<typename T, std::size_t N>
+class shm_frame_ring {
+public:
+    using value_type = T;
+
+    static constexpr std::size_t dim_count = N;
+
+    static shm_frame_ring create(
+        const std::string& name,
+        const std::array<std::size_t, N>& frame_shape_,
+        std::size_t capacity_
+    );
+    static shm_frame_ring open(const std::string& name);
+
+    shm_frame_ring(shm_frame_ring&& other) noexcept = default;
+    shm_frame_ring& operator=(shm_frame_ring&& other) noexcept = default;
+
+    // Producer
+    std::optional<ndview<T, N>> try_begin_write() noexcept;
+    void end_write() noexcept;
+
+    // Consumer
+    std::optional<ndview<const T, N>> try_begin_read() noexcept;
+    void end_read() noexcept;
+
+    std::size_t capacity() const noexcept;
+    const std::array<std::size_t, N>& frame_shape() const noexcept;
+
+    const std::string& name() const noexcept;
+
+private:
+    detail::shm_mapping _mapping;
+    std::array<std::size_t, N> _frame_shape;
+    std::size_t _frame_stride;
+    T* _frames;
+    detail::spsc_positions _positions;
+
+    shm_frame_ring(detail::shm_mapping&& mapping) noexcept;
+};
+
+
+// Removes a shared memory name left behind by a process that did not exit
+// cleanly. Returns false if the name did not exist.
+bool remove_shm(const std::string& name) noexcept;
+
+} // namespace vt
+
+#include <vt/ndarray/impl/shm.ipp>
+
+#endif // VT_NDARRAY_POSIX
+
+#endif // VT_NDARRAY_SHM_HPP_
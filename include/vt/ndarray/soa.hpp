@@ -0,0 +1,233 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_SOA_HPP_
+#define VT_NDARRAY_SOA_HPP_
+
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace vt {
+
+// Specialize this for record types that should be stored as a structure of
+// arrays, e.g.:
+//     template<> struct soa_traits<particle> {
+//         static constexpr auto members =
+//             std::make_tuple(&particle::x, &particle::v, &particle::m);
+//     };
+template<typename T>
+struct soa_traits;
+
+
+namespace detail {
+
+template<typename M>
+struct soa_member_traits;
+
+template<typename C, typename F>
+struct soa_member_traits<F C::*> {
+    using field_type = F;
+};
+
+
+template<typename T>
+using soa_members_t = std::remove_cv_t<
+    decltype(soa_traits<std::remove_cv_t<T>>::members)
+>;
+
+template<typename T>
+inline constexpr std::size_t soa_field_count =
+    std::tuple_size_v<soa_members_t<T>>;
+
+template<typename T, std::size_t I>
+using soa_field_t = std::conditional_t<
+    std::is_const_v<T>,
+    const typename soa_member_traits<
+        std::tuple_element_t<I, soa_members_t<T>>
+    >::field_type,
+    typename soa_member_traits<
+        std::tuple_element_t<I, soa_members_t<T>>
+    >::field_type
+>;
+
+
+template<typename T, typename Seq>
+struct soa_pointers;
+
+template<typename T, std::size_t... I>
+struct soa_pointers<T, std::index_sequence<I...>> {
+    using type = std::tuple<soa_field_t<T, I>*...>;
+};
+
+template<typename T>
+using soa_pointers_t = typename soa_pointers<
+    T,
+    std::make_index_sequence<soa_field_count<T>>
+>::type;
+
+
+template<typename T, std::size_t N, typename Seq>
+struct soa_arrays;
+
+template<typename T, std::size_t N, std::size_t... I>
+struct soa_arrays<T, N, std::index_sequence<I...>> {
+    using type = std::tuple<ndarray<soa_field_t<T, I>, N>...>;
+};
+
+template<typename T, std::size_t N>
+using soa_arrays_t = typename soa_arrays<
+    T,
+    N,
+    std::make_index_sequence<soa_field_count<T>>
+>::type;
+
+
+template<typename T, auto X>
+constexpr std::size_t soa_field_index() noexcept;
+
+} // namespace detail
+
+
+template<typename T>
+class soa_reference {
+public:
+    using value_type = std::remove_cv_t<T>;
+
+    explicit soa_reference(
+        const detail::soa_pointers_t<T>& fields_
+    ) noexcept;
+    soa_reference(const soa_reference& other) = default;
+
+    const soa_reference& operator=(const value_type& value) const;
+    const soa_reference& operator=(const soa_reference& other) const;
+
+    operator value_type() const;
+
+    template<auto X>
+    decltype(auto) get() const noexcept;
+
+private:
+    detail::soa_pointers_t<T> _fields;
+};
+
+
+template<typename T, std::size_t N>
+class soa_ndview {
+    static_assert(N > 0);
+    static_assert(detail::soa_field_count<T> > 0);
+
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using index_type = std::size_t;
+    using reference = soa_reference<T>;
+
+    static constexpr std::size_t dim_count = N;
+    static constexpr std::size_t field_count = detail::soa_field_count<T>;
+
+    constexpr soa_ndview(
+        const std::array<std::size_t, N>& shape_,
+        const detail::soa_pointers_t<T>& fields_
+    ) noexcept;
+
+    decltype(auto) operator[](std::size_t idx) const noexcept;
+
+    constexpr operator soa_ndview<const T, N>() const noexcept;
+
+    constexpr std::size_t element_count() const noexcept;
+
+    constexpr const std::array<std::size_t, N>& shape() const noexcept;
+    constexpr std::size_t shape(std::size_t dim) const noexcept;
+
+    template<auto X>
+    constexpr auto field() const noexcept;
+
+    constexpr soa_ndview<T, N> slice(std::size_t offset) const noexcept;
+    constexpr soa_ndview<T, N> slice(
+        std::size_t offset,
+        std::size_t count
+    ) const noexcept;
+
+private:
+    std::array<std::size_t, N> _shape;
+    detail::soa_pointers_t<T> _fields;
+};
+
+
+template<typename T, std::size_t N>
+class soa_ndarray {
+    static_assert(std::is_same_v<std::remove_cv_t<T>, T>);
+    static_assert(detail::soa_field_count<T> > 0);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = soa_reference<T>;
+    using const_reference = soa_reference<const T>;
+
+    static constexpr std::size_t dim_count = N;
+    static constexpr std::size_t field_count = detail::soa_field_count<T>;
+
+    soa_ndarray() noexcept;
+    explicit soa_ndarray(const std::array<std::size_t, N>& shape_);
+    soa_ndarray(const std::array<std::size_t, N>& shape_, const T& init);
+
+    decltype(auto) operator[](std::size_t idx) noexcept;
+    decltype(auto) operator[](std::size_t idx) const noexcept;
+
+    operator soa_ndview<T, N>() noexcept;
+    operator soa_ndview<const T, N>() const noexcept;
+
+    soa_ndview<T, N> view() noexcept;
+    soa_ndview<const T, N> view() const noexcept;
+    soa_ndview<const T, N> cview() const noexcept;
+
+    template<auto X>
+    auto field() noexcept;
+    template<auto X>
+    auto field() const noexcept;
+
+    std::size_t element_count() const noexcept;
+
+    const std::array<std::size_t, N>& shape() const noexcept;
+    std::size_t shape(std::size_t dim) const noexcept;
+
+private:
+    detail::soa_arrays_t<T, N> _fields;
+
+    template<typename U, typename Arrays, std::size_t... I>
+    static soa_ndview<U, N> make_view(
+        Arrays& fields_,
+        std::index_sequence<I...>
+    ) noexcept;
+};
+
+} // namespace vt
+
+#include <vt/ndarray/impl/soa.ipp>
+
+#endif // VT_NDARRAY_SOA_HPP_
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_SORT_HPP_
+#define VT_NDARRAY_SORT_HPP_
+
+#include <vt/ndarray/view.hpp>
+
+#include <cstddef>
+
+
+namespace vt {
+
+// Sorts every lane of a along axis in ascending order.
+template<typename T, std::size_t N>
+void sort(
+    ndview<T, N> a,
+    std::size_t axis = N - 1,
+    std::size_t thread_count = 1
+);
+
+// Stores in indices the positions that sort every lane of a along axis. Equal
+// elements keep their relative order.
+template<typename T, typename Index, std::size_t N>
+void argsort(
+    detail::nondeduced_t<ndview<const T, N>> a,
+    ndview<Index, N> indices,
+    std::size_t axis = N - 1,
+    std::size_t thread_count = 1
+);
+
+// Moves the k smallest elements of every lane of a along axis to its front, in
+// ascending order. The order of the remaining elements is unspecified.
+template<typename T, std::size_t N>
+void partial_sort(
+    ndview<T, N> a,
+    std::size_t k,
+    std::size_t axis = N - 1,
+    std::size_t thread_count = 1
+);
+
+// Stores the values.shape(axis) largest elements of every lane of a along
+// axis in values, in descending order, and their positions in indices.
+template<typename T, typename Index, std::size_t N>
+void top_k(
+    detail::nondeduced_t<ndview<const T, N>> a,
+    detail::nondeduced_t<ndview<T, N>> values,
+    ndview<Index, N> indices,
+    std::size_t axis = N - 1,
+    std::size_t thread_count = 1
+);
+
+} // namespace vt
+
+#include <vt/ndarray/impl/sort.ipp>
+
+#endif // VT_NDARRAY_SORT_HPP_
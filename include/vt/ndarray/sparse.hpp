@@ -0,0 +1,129 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_SPARSE_HPP_
+#define VT_NDARRAY_SPARSE_HPP_
+
+#include <vt/ndarray/allocator.hpp>
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+
+namespace vt {
+
+// Sparse matrix in coordinate format: an unordered list of (row, column,
+// value) triplets. Duplicate entries are summed.
+template<typename T, typename Index = std::size_t>
+class coo_matrix {
+public:
+    using value_type = T;
+    using index_type = Index;
+
+    coo_matrix() noexcept;
+    explicit coo_matrix(const std::array<std::size_t, 2>& shape_) noexcept;
+    explicit coo_matrix(ndview<const T, 2> dense);
+
+    void reserve(std::size_t count);
+    void insert(std::size_t row, std::size_t col, const T& value);
+    void clear() noexcept;
+
+    const std::array<std::size_t, 2>& shape() const noexcept;
+    std::size_t shape(std::size_t dim) const noexcept;
+    std::size_t nonzero_count() const noexcept;
+
+    ndview<const Index, 1> rows() const noexcept;
+    ndview<const Index, 1> cols() const noexcept;
+    ndview<const T, 1> values() const noexcept;
+
+    void to_dense(ndview<T, 2> dst) const noexcept;
+    ndarray<T, 2> to_ndarray() const;
+
+private:
+    std::array<std::size_t, 2> _shape;
+    std::vector<Index, ndarray_allocator<Index>> _rows;
+    std::vector<Index, ndarray_allocator<Index>> _cols;
+    std::vector<T, ndarray_allocator<T>> _values;
+};
+
+
+// Sparse matrix in compressed sparse row format. The entries of each row are
+// stored consecutively, sorted by column, without duplicates.
+template<typename T, typename Index = std::size_t>
+class csr_matrix {
+public:
+    using value_type = T;
+    using index_type = Index;
+
+    csr_matrix();
+    explicit csr_matrix(ndview<const T, 2> dense);
+    explicit csr_matrix(const coo_matrix<T, Index>& coo);
+
+    const std::array<std::size_t, 2>& shape() const noexcept;
+    std::size_t shape(std::size_t dim) const noexcept;
+    std::size_t nonzero_count() const noexcept;
+
+    ndview<const Index, 1> row_offsets() const noexcept;
+    ndview<const Index, 1> col_indices() const noexcept;
+    ndview<T, 1> values() noexcept;
+    ndview<const T, 1> values() const noexcept;
+
+    void to_dense(ndview<T, 2> dst) const noexcept;
+    ndarray<T, 2> to_ndarray() const;
+
+private:
+    std::array<std::size_t, 2> _shape;
+    std::vector<Index, ndarray_allocator<Index>> _row_offsets;
+    std::vector<Index, ndarray_allocator<Index>> _col_indices;
+    std::vector<T, ndarray_allocator<T>> _values;
+};
+
+
+template<typename T, typename Index>
+void mul(
+    const csr_matrix<T, Index>& A,
+    detail::nondeduced_t<ndview<const T, 1>> x,
+    detail::nondeduced_t<ndview<T, 1>> y,
+    std::size_t thread_count = 1
+);
+
+template<typename T, typename Index>
+void mul(
+    const csr_matrix<T, Index>& A,
+    detail::nondeduced_t<ndview<const T, 2>> B,
+    detail::nondeduced_t<ndview<T, 2>> C,
+    std::size_t thread_count = 1
+);
+
+template<typename T, typename Index>
+void mul(
+    const coo_matrix<T, Index>& A,
+    detail::nondeduced_t<ndview<const T, 1>> x,
+    detail::nondeduced_t<ndview<T, 1>> y
+) noexcept;
+
+} // namespace vt
+
+#include <vt/ndarray/impl/sparse.ipp>
+
+#endif // VT_NDARRAY_SPARSE_HPP_
@@ -0,0 +1,48 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_TOPOLOGY_HPP_
+#define VT_NDARRAY_TOPOLOGY_HPP_
+
+#include <cstddef>
+
+
+namespace vt {
+
+// Cache and core counts of the machine, from which the library derives
+// default alignments and tile sizes. All members are non-zero.
+struct cpu_topology {
+    std::size_t cache_line_size;
+    std::size_t l1d_cache_size;
+    std::size_t l2_cache_size;
+    std::size_t l3_cache_size;
+    std::size_t core_count;
+    std::size_t thread_count;
+
+    static const cpu_topology& get() noexcept;
+
+    static cpu_topology probe() noexcept;
+};
+
+} // namespace vt
+
+#include <vt/ndarray/impl/topology.ipp>
+
+#endif // VT_NDARRAY_TOPOLOGY_HPP_
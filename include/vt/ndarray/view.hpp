@@ -21,6 +21,8 @@
 #ifndef VT_NDARRAY_VIEW_HPP_
 #define VT_NDARRAY_VIEW_HPP_
 
+#include <vt/ndarray/check.hpp>
+
 #include <array>
 #include <cstddef>
 #include <iterator>
@@ -52,7 +54,7 @@ public:
         T* data_
     ) noexcept;
 
-    decltype(auto) operator[](std::size_t idx) const noexcept;
+    constexpr decltype(auto) operator[](std::size_t idx) const noexcept;
 
     constexpr operator ndview<const T, N>() const noexcept;
 
@@ -96,7 +98,7 @@ private:
     std::array<std::size_t, N> _shape;
     T* _data;
 
-    std::array<std::size_t, N - 1> subshape() const noexcept;
+    constexpr std::array<std::size_t, N - 1> subshape() const noexcept;
 };
 
 
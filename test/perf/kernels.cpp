@@ -0,0 +1,186 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "kernels.hpp"
+
+#include <vt/ndarray/range.hpp>
+#include <vt/ndarray/view.hpp>
+
+
+void vt_perf_scale_1d_pointer(std::size_t n, const float* x, float* y) {
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] = 2.0f * x[i];
+    }
+}
+
+
+void vt_perf_scale_1d_ndview(std::size_t n, const float* x_, float* y_) {
+    const vt::ndview<const float, 1> x{{ n }, x_};
+    const vt::ndview<float, 1> y{{ n }, y_};
+
+    for (std::size_t i = 0; i < x.shape(0); ++i) {
+        y[i] = 2.0f * x[i];
+    }
+}
+
+
+void vt_perf_axpy_2d_pointer(std::size_t n, const float* x, float* y) {
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            y[i * n + j] += 2.0f * x[i * n + j];
+        }
+    }
+}
+
+
+void vt_perf_axpy_2d_ndview(std::size_t n, const float* x_, float* y_) {
+    const vt::ndview<const float, 2> x{{ n, n }, x_};
+    const vt::ndview<float, 2> y{{ n, n }, y_};
+
+    for (std::size_t i = 0; i < x.shape(0); ++i) {
+        for (std::size_t j = 0; j < x.shape(1); ++j) {
+            y[i][j] += 2.0f * x[i][j];
+        }
+    }
+}
+
+
+void vt_perf_axpy_3d_pointer(std::size_t n, const float* x, float* y) {
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            for (std::size_t k = 0; k < n; ++k) {
+                y[(i * n + j) * n + k] += 2.0f * x[(i * n + j) * n + k];
+            }
+        }
+    }
+}
+
+
+void vt_perf_axpy_3d_ndview(std::size_t n, const float* x_, float* y_) {
+    const vt::ndview<const float, 3> x{{ n, n, n }, x_};
+    const vt::ndview<float, 3> y{{ n, n, n }, y_};
+
+    for (std::size_t i = 0; i < x.shape(0); ++i) {
+        for (std::size_t j = 0; j < x.shape(1); ++j) {
+            for (std::size_t k = 0; k < x.shape(2); ++k) {
+                y[i][j][k] += 2.0f * x[i][j][k];
+            }
+        }
+    }
+}
+
+
+void vt_perf_axpy_iter_pointer(std::size_t n, const float* x, float* y) {
+    const float* const x_end = x + n * n;
+    while (x != x_end) {
+        *y++ += 2.0f * *x++;
+    }
+}
+
+
+void vt_perf_axpy_iter_ndview(std::size_t n, const float* x_, float* y_) {
+    const vt::ndview<const float, 2> x{{ n, n }, x_};
+    const vt::ndview<float, 2> y{{ n, n }, y_};
+
+    auto y_it = y.begin();
+    for (float elem : x) {
+        *y_it++ += 2.0f * elem;
+    }
+}
+
+
+void vt_perf_axpy_range_pointer(std::size_t n, const float* x, float* y) {
+    vt_perf_axpy_3d_pointer(n, x, y);
+}
+
+
+void vt_perf_axpy_range_ndview(std::size_t n, const float* x_, float* y_) {
+    const vt::ndview<const float, 3> x{{ n, n, n }, x_};
+    const vt::ndview<float, 3> y{{ n, n, n }, y_};
+
+    vt::for_each_index(vt::ndrange{x.shape()}, [&](const vt::ndindex<3>& idx) {
+        y.data()[idx.offset] += 2.0f * x.data()[idx.offset];
+    });
+}
+
+
+void vt_perf_laplacian_pointer(std::size_t n, const float* x, float* y) {
+    for (std::size_t i = 1; i < n - 1; ++i) {
+        for (std::size_t j = 1; j < n - 1; ++j) {
+            y[i * n + j] =
+                x[(i - 1) * n + j] + x[(i + 1) * n + j] +
+                x[i * n + j - 1] + x[i * n + j + 1] - 4.0f * x[i * n + j];
+        }
+    }
+}
+
+
+void vt_perf_laplacian_ndview(std::size_t n, const float* x_, float* y_) {
+    const vt::ndview<const float, 2> x{{ n, n }, x_};
+    const vt::ndview<float, 2> y_interior =
+        vt::ndview<float, 2>{{ n, n }, y_}.slice(1, n - 2);
+
+    for (std::size_t i = 0; i < y_interior.shape(0); ++i) {
+        const vt::ndview<const float, 1> up = x[i];
+        const vt::ndview<const float, 1> mid = x[i + 1];
+        const vt::ndview<const float, 1> down = x[i + 2];
+        const vt::ndview<float, 1> out = y_interior[i];
+
+        for (std::size_t j = 1; j < n - 1; ++j) {
+            out[j] = up[j] + down[j] + mid[j - 1] + mid[j + 1] - 4.0f * mid[j];
+        }
+    }
+}
+
+
+void vt_perf_matmul_pointer(std::size_t n, const float* x, float* y) {
+    const float* A = x;
+    const float* B = x + n * n;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            y[i * n + j] = 0.0f;
+        }
+        for (std::size_t k = 0; k < n; ++k) {
+            for (std::size_t j = 0; j < n; ++j) {
+                y[i * n + j] += A[i * n + k] * B[k * n + j];
+            }
+        }
+    }
+}
+
+
+void vt_perf_matmul_ndview(std::size_t n, const float* x_, float* y_) {
+    const vt::ndview<const float, 3> x{{ 2, n, n }, x_};
+    const vt::ndview<const float, 2> A = x[0];
+    const vt::ndview<const float, 2> B = x[1];
+    const vt::ndview<float, 2> C{{ n, n }, y_};
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            C[i][j] = 0.0f;
+        }
+        for (std::size_t k = 0; k < n; ++k) {
+            for (std::size_t j = 0; j < n; ++j) {
+                C[i][j] += A[i][k] * B[k][j];
+            }
+        }
+    }
+}
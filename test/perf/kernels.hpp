@@ -0,0 +1,62 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VT_NDARRAY_PERF_KERNELS_HPP_
+#define VT_NDARRAY_PERF_KERNELS_HPP_
+
+#include <cstddef>
+
+// Every kernel has a raw-pointer variant and an ndview variant with identical
+// loops. They have C linkage so that run_perf_check.cmake can find them by
+// name in the generated assembly. Both take the extent n of each dimension, an
+// input buffer x and an output buffer y.
+extern "C" {
+
+// y[i] = 2 x[i], with shape {n}
+void vt_perf_scale_1d_pointer(std::size_t n, const float* x, float* y);
+void vt_perf_scale_1d_ndview(std::size_t n, const float* x, float* y);
+
+// y[i][j] += 2 x[i][j], with shape {n, n}
+void vt_perf_axpy_2d_pointer(std::size_t n, const float* x, float* y);
+void vt_perf_axpy_2d_ndview(std::size_t n, const float* x, float* y);
+
+// y[i][j][k] += 2 x[i][j][k], with shape {n, n, n}
+void vt_perf_axpy_3d_pointer(std::size_t n, const float* x, float* y);
+void vt_perf_axpy_3d_ndview(std::size_t n, const float* x, float* y);
+
+// As axpy_2d, but traversing the view with iterators
+void vt_perf_axpy_iter_pointer(std::size_t n, const float* x, float* y);
+void vt_perf_axpy_iter_ndview(std::size_t n, const float* x, float* y);
+
+// As axpy_3d, but looping with vt::for_each_index over an ndrange
+void vt_perf_axpy_range_pointer(std::size_t n, const float* x, float* y);
+void vt_perf_axpy_range_ndview(std::size_t n, const float* x, float* y);
+
+// 5-point Laplacian of the interior of an {n, n} grid, using slices
+void vt_perf_laplacian_pointer(std::size_t n, const float* x, float* y);
+void vt_perf_laplacian_ndview(std::size_t n, const float* x, float* y);
+
+// y = A B, where x holds the {n, n} matrices A and B back to back
+void vt_perf_matmul_pointer(std::size_t n, const float* x, float* y);
+void vt_perf_matmul_ndview(std::size_t n, const float* x, float* y);
+
+}
+
+#endif // VT_NDARRAY_PERF_KERNELS_HPP_
@@ -0,0 +1,165 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "kernels.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+using kernel_function = void (*)(std::size_t n, const float* x, float* y);
+
+struct kernel {
+    const char* name;
+    std::size_t n;
+    std::size_t x_size;
+    std::size_t y_size;
+    kernel_function pointer_variant;
+    kernel_function ndview_variant;
+};
+
+
+// Problem sizes are chosen to fit in L2, so that memory bandwidth does not
+// hide overhead in the address computations.
+const kernel kernels[] = {
+    {
+        "scale_1d", 65536, 65536, 65536,
+        vt_perf_scale_1d_pointer, vt_perf_scale_1d_ndview
+    },
+    {
+        "axpy_2d", 256, 65536, 65536,
+        vt_perf_axpy_2d_pointer, vt_perf_axpy_2d_ndview
+    },
+    {
+        "axpy_3d", 40, 64000, 64000,
+        vt_perf_axpy_3d_pointer, vt_perf_axpy_3d_ndview
+    },
+    {
+        "axpy_iter", 256, 65536, 65536,
+        vt_perf_axpy_iter_pointer, vt_perf_axpy_iter_ndview
+    },
+    {
+        "axpy_range", 40, 64000, 64000,
+        vt_perf_axpy_range_pointer, vt_perf_axpy_range_ndview
+    },
+    {
+        "laplacian", 256, 65536, 65536,
+        vt_perf_laplacian_pointer, vt_perf_laplacian_ndview
+    },
+    {
+        "matmul", 96, 2 * 9216, 9216,
+        vt_perf_matmul_pointer, vt_perf_matmul_ndview
+    }
+};
+
+
+// Returns the time of one call in nanoseconds, averaged over enough calls to
+// cover about a millisecond.
+static double time_call(
+    const kernel& k, kernel_function f, const float* x, float* y
+) {
+    using clock = std::chrono::steady_clock;
+
+    std::size_t call_count = 1;
+    for (;;) {
+        const clock::time_point start = clock::now();
+        for (std::size_t i = 0; i < call_count; ++i) {
+            f(k.n, x, y);
+        }
+        const std::chrono::duration<double, std::nano> elapsed =
+            clock::now() - start;
+
+        if (elapsed.count() >= 1e6) {
+            return elapsed.count() / static_cast<double>(call_count);
+        }
+        call_count *= 2;
+    }
+}
+
+
+static bool same_results(const kernel& k, const std::vector<float>& x) {
+    std::vector<float> y_pointer(k.y_size, 1.0f);
+    std::vector<float> y_ndview(k.y_size, 1.0f);
+    k.pointer_variant(k.n, x.data(), y_pointer.data());
+    k.ndview_variant(k.n, x.data(), y_ndview.data());
+
+    return y_pointer == y_ndview;
+}
+
+
+// Usage: vt-ndarray-perf [tolerance] [repeat-count]
+//
+// Fails when the ndview variant of a kernel is more than the tolerance
+// (default 0.1) slower than its raw-pointer variant. The best time out of the
+// repeats is compared, since the minimum is the least sensitive to noise from
+// other processes.
+int main(int argc, char** argv) {
+    const double tolerance = argc > 1 ? std::atof(argv[1]) : 0.1;
+    const int repeat_count = argc > 2 ? std::atoi(argv[2]) : 15;
+
+    bool success = true;
+    std::printf(
+        "%-12s %14s %14s %8s\n", "kernel", "pointer (ns)", "ndview (ns)",
+        "ratio"
+    );
+
+    for (const kernel& k : kernels) {
+        std::vector<float> x(k.x_size);
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            x[i] = static_cast<float>(i % 7) * 0.25f;
+        }
+        std::vector<float> y(k.y_size, 0.0f);
+
+        if (!same_results(k, x)) {
+            std::printf("%-12s results differ\n", k.name);
+            success = false;
+            continue;
+        }
+
+        // The variants are interleaved, so that they see the same changes in
+        // clock frequency and machine load.
+        double pointer_time = 0.0;
+        double ndview_time = 0.0;
+        for (int r = 0; r < repeat_count; ++r) {
+            const double t_pointer =
+                time_call(k, k.pointer_variant, x.data(), y.data());
+            const double t_ndview =
+                time_call(k, k.ndview_variant, x.data(), y.data());
+
+            pointer_time =
+                r == 0 ? t_pointer : std::min(pointer_time, t_pointer);
+            ndview_time = r == 0 ? t_ndview : std::min(ndview_time, t_ndview);
+        }
+
+        const double ratio = ndview_time / pointer_time;
+        const bool within_tolerance = ratio <= 1.0 + tolerance;
+        success = success && within_tolerance;
+
+        std::printf(
+            "%-12s %14.1f %14.1f %8.3f%s\n", k.name, pointer_time, ndview_time,
+            ratio, within_tolerance ? "" : "  FAILED"
+        );
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
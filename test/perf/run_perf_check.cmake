@@ -0,0 +1,136 @@
+# Performance regression check for a single compiler and optimization level.
+#
+# Compiles the kernels in kernels.cpp, verifies that every ndview variant is
+# vectorized whenever its raw-pointer variant is, and then runs
+# vt-ndarray-perf to compare their run times. Invoked by CTest as:
+#
+#   cmake -DCOMPILER=<c++> -DOPTIMIZATION=<-O2|-O3> -DFLAGS=<list>
+#         -DTOLERANCE=<fraction> -DINCLUDE_DIR=<dir> -DSOURCE_DIR=<dir>
+#         -DBINARY_DIR=<dir> -P run_perf_check.cmake
+#
+# The assembly inspection expects ELF output from GCC or Clang on x86-64 or
+# AArch64.
+
+cmake_minimum_required(VERSION 3.8)
+
+foreach(variable COMPILER OPTIMIZATION INCLUDE_DIR SOURCE_DIR BINARY_DIR)
+    if(NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} is not set")
+    endif()
+endforeach()
+
+if(NOT DEFINED TOLERANCE)
+    set(TOLERANCE 0.1)
+endif()
+
+# Identical loops can differ in speed depending on where they end up in
+# memory, so code is aligned to keep both variants on equal footing.
+set(
+    compile_flags
+    -std=c++17
+    ${OPTIMIZATION}
+    -DNDEBUG
+    -falign-functions=64
+    -falign-loops=64
+    ${FLAGS}
+    "-I${INCLUDE_DIR}"
+)
+
+file(MAKE_DIRECTORY "${BINARY_DIR}")
+
+
+# Assembly inspection
+#####################
+
+execute_process(
+    COMMAND
+        "${COMPILER}" ${compile_flags} -S "${SOURCE_DIR}/kernels.cpp"
+        -o "${BINARY_DIR}/kernels.s"
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Compiling kernels.cpp to assembly failed")
+endif()
+
+file(READ "${BINARY_DIR}/kernels.s" assembly)
+
+# Packed floating-point arithmetic for SSE/AVX and NEON
+string(
+    CONCAT vector_instruction_regex
+    "[\t ]("
+    "v?(add|sub|mul|div|fn?m(add|sub)[0-9]+)p[sd]|"
+    "f(add|sub|mul|mla|div)[\t ]+v[0-9]+\\.[0-9]+[sd]"
+    ")[\t ]"
+)
+
+# Sets result_var to the number of vector instructions in a function, or to
+# -1 if the function is not found.
+function(count_vector_instructions function_name result_var)
+    string(FIND "${assembly}" "\n${function_name}:" begin)
+    string(FIND "${assembly}" ".size\t${function_name}," end)
+    if(begin EQUAL -1 OR end EQUAL -1)
+        set(${result_var} -1 PARENT_SCOPE)
+        return()
+    endif()
+
+    math(EXPR length "${end} - ${begin}")
+    string(SUBSTRING "${assembly}" ${begin} ${length} body)
+    string(REGEX MATCHALL "${vector_instruction_regex}" matches "${body}")
+    list(LENGTH matches count)
+    set(${result_var} ${count} PARENT_SCOPE)
+endfunction()
+
+string(
+    REGEX MATCHALL "\nvt_perf_[a-z0-9_]+_pointer:" pointer_labels "${assembly}"
+)
+if(NOT pointer_labels)
+    message(FATAL_ERROR "No kernels found in the assembly")
+endif()
+
+set(failed_kernels)
+foreach(label IN LISTS pointer_labels)
+    string(
+        REGEX REPLACE "\n(vt_perf_[a-z0-9_]+)_pointer:" "\\1"
+        kernel "${label}"
+    )
+
+    count_vector_instructions(${kernel}_pointer pointer_count)
+    count_vector_instructions(${kernel}_ndview ndview_count)
+    message(
+        STATUS
+        "${kernel}: ${pointer_count} vector instructions with pointers, "
+        "${ndview_count} with ndview"
+    )
+
+    if(ndview_count EQUAL -1 OR
+       (pointer_count GREATER 0 AND ndview_count EQUAL 0))
+        list(APPEND failed_kernels ${kernel})
+    endif()
+endforeach()
+
+if(failed_kernels)
+    message(FATAL_ERROR "Not vectorized with ndview: ${failed_kernels}")
+endif()
+
+
+# Run-time comparison
+#####################
+
+execute_process(
+    COMMAND
+        "${COMPILER}" ${compile_flags}
+        "${SOURCE_DIR}/kernels.cpp" "${SOURCE_DIR}/perf_main.cpp"
+        -o "${BINARY_DIR}/vt-ndarray-perf"
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Compiling vt-ndarray-perf failed")
+endif()
+
+execute_process(
+    COMMAND "${BINARY_DIR}/vt-ndarray-perf" ${TOLERANCE}
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "ndview variants exceed the tolerance of ${TOLERANCE}")
+endif()
@@ -0,0 +1,77 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/async_io.hpp>
+#include <vt/ndarray/format.hpp>
+
+#include <catch2/catch.hpp>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <string>
+#include <vector>
+
+
+TEST_CASE("Benchmark loading files", "[ndarray][async_io][!benchmark]") {
+    const std::size_t file_count = 64;
+    const std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "vt-ndarray-async-io-bench";
+    std::filesystem::create_directory(dir);
+
+    std::vector<std::string> paths;
+    const vt::ndarray<float, 2> a{{ 512, 512 }, 1.0f};
+    {
+        vt::io_context io;
+        for (std::size_t i = 0; i < file_count; ++i) {
+            paths.push_back((dir / std::to_string(i)).string());
+            io.store<float, 2>(paths.back(), a);
+        }
+    }
+
+    BENCHMARK("read_binary, one file after another") {
+        float sum = 0.0f;
+        for (const std::string& path : paths) {
+            std::ifstream is{path, std::ios::binary};
+            sum += vt::read_binary<float, 2>(is)[0][0];
+        }
+        return sum;
+    };
+
+    for (bool fallback : { false, true }) {
+        for (bool direct : { false, true }) {
+            vt::io_options options;
+            options.force_fallback = fallback;
+            options.direct = direct;
+            vt::io_context io{options};
+
+            const std::string suffix = std::string{fallback
+                ? ", thread pool" : ""} + (direct ? ", O_DIRECT" : "");
+            BENCHMARK("io_context" + suffix) {
+                float sum = 0.0f;
+                for (auto& load : io.load<float, 2>(paths)) {
+                    sum += load.get()[0][0];
+                }
+                return sum;
+            };
+        }
+    }
+
+    std::filesystem::remove_all(dir);
+}
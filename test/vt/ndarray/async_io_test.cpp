@@ -0,0 +1,214 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <vt/ndarray/async_io.hpp>
+#include <vt/ndarray/format.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+
+// Removes its directory of test files when destroyed
+class scratch_directory {
+public:
+    scratch_directory() :
+        _path{std::filesystem::temp_directory_path() /
+            ("vt-ndarray-async-io-" + std::to_string(std::random_device{}()))}
+    {
+        std::filesystem::create_directory(_path);
+    }
+
+    ~scratch_directory() {
+        std::filesystem::remove_all(_path);
+    }
+
+    std::string file(const std::string& name) const {
+        return (_path / name).string();
+    }
+
+private:
+    std::filesystem::path _path;
+};
+
+
+static vt::io_options make_options(bool fallback) {
+    vt::io_options options;
+    options.queue_depth = 4;
+    options.thread_count = 2;
+    options.force_fallback = fallback;
+    return options;
+}
+
+
+TEST_CASE(
+    "A vt::io_context can store and load arrays",
+    "[ndarray][async_io]"
+) {
+    const bool fallback = GENERATE(false, true);
+    vt::io_context io{make_options(fallback)};
+    if (fallback) CHECK(!io.uses_io_uring());
+    const scratch_directory dir;
+
+    // Empty, less than a block, a whole number of blocks, and blocks and a
+    // remainder
+    const std::vector<std::size_t> lengths{ 0, 5, 2048, 3000 };
+    std::vector<vt::ndarray<std::int16_t, 2>> arrays;
+    std::vector<std::future<void>> stores;
+    for (std::size_t length : lengths) {
+        arrays.emplace_back(std::array<std::size_t, 2>{ 2, length });
+        std::iota(arrays.back().begin(), arrays.back().end(), -100);
+    }
+    for (std::size_t i = 0; i < arrays.size(); ++i) {
+        stores.push_back(io.store<std::int16_t, 2>(
+            dir.file(std::to_string(i)), arrays[i]
+        ));
+    }
+    for (std::future<void>& store : stores) {
+        store.get();
+    }
+
+    for (std::size_t i = 0; i < arrays.size(); ++i) {
+        vt::ndarray<std::int16_t, 2> b =
+            io.load<std::int16_t, 2>(dir.file(std::to_string(i))).get();
+        CHECK(b == arrays[i]);
+        const auto address = reinterpret_cast<std::uintptr_t>(b.data());
+        CHECK(address % vt::io_block_size == 0);
+
+        // Same format as write_binary, with the elements at a whole block
+        std::ifstream is{dir.file(std::to_string(i)), std::ios::binary};
+        CHECK(vt::read_binary<std::int16_t, 2>(is) == arrays[i]);
+        CHECK(std::filesystem::file_size(dir.file(std::to_string(i))) ==
+            vt::io_block_size + arrays[i].element_count() * 2);
+    }
+}
+
+
+TEST_CASE(
+    "A vt::io_context can load files written by vt::write_binary",
+    "[ndarray][async_io]"
+) {
+    const bool fallback = GENERATE(false, true);
+    vt::io_context io{make_options(fallback)};
+    const scratch_directory dir;
+
+    vt::ndarray<double, 3> a{{ 3, 40, 50 }};
+    std::iota(a.begin(), a.end(), 0.0);
+    {
+        std::ofstream os{dir.file("a"), std::ios::binary};
+        vt::write_binary(os, a);
+    }
+
+    CHECK(io.load<double, 3>(dir.file("a")).get() == a);
+}
+
+
+TEST_CASE(
+    "A vt::io_context can load many files at once",
+    "[ndarray][async_io]"
+) {
+    const bool fallback = GENERATE(false, true);
+    vt::io_context io{make_options(fallback)};
+    const scratch_directory dir;
+
+    std::vector<std::string> paths;
+    for (int i = 0; i < 20; ++i) {
+        vt::ndarray<float, 1> a(
+            std::array<std::size_t, 1>{ 1000 }, static_cast<float>(i)
+        );
+        paths.push_back(dir.file(std::to_string(i)));
+        io.store<float, 1>(paths.back(), a).get();
+    }
+
+    std::vector<std::future<vt::ndarray<float, 1>>> loads =
+        io.load<float, 1>(paths);
+    REQUIRE(loads.size() == paths.size());
+    for (std::size_t i = 0; i < loads.size(); ++i) {
+        const vt::ndarray<float, 1> a = loads[i].get();
+        CHECK(a.shape(0) == 1000);
+        CHECK(a[999] == Approx(static_cast<float>(i)));
+    }
+
+    io.wait();
+    const vt::io_stats stats = io.stats();
+    CHECK(stats.request_count == 40);
+    CHECK(stats.byte_count == 40 * 1000 * sizeof(float));
+    CHECK(stats.seconds > 0.0);
+    CHECK(stats.bandwidth() > 0.0);
+}
+
+
+TEST_CASE(
+    "A vt::io_context reports errors through futures",
+    "[ndarray][async_io]"
+) {
+    const bool fallback = GENERATE(false, true);
+    vt::io_context io{make_options(fallback)};
+    const scratch_directory dir;
+
+    CHECK_THROWS_AS(
+        (io.load<float, 1>(dir.file("missing")).get()), std::system_error
+    );
+
+    vt::ndarray<float, 1> a(std::array<std::size_t, 1>{ 5000 }, 1.0f);
+    CHECK_THROWS_AS(
+        (io.store<float, 1>(dir.file("missing/a"), a).get()),
+        std::system_error
+    );
+    io.store<float, 1>(dir.file("a"), a).get();
+    CHECK_THROWS_AS(
+        (io.load<double, 1>(dir.file("a")).get()), std::runtime_error
+    );
+    CHECK_THROWS_AS(
+        (io.load<float, 2>(dir.file("a")).get()), std::runtime_error
+    );
+
+    // A shape whose size in bytes overflows
+    {
+        std::fstream file{dir.file("a"),
+            std::ios::in | std::ios::out | std::ios::binary};
+        const char huge[8] = { 0, 0, 0, 0, 0, 0, 0, 0x40 };
+        file.seekp(16);
+        file.write(huge, sizeof(huge));
+    }
+    CHECK_THROWS_AS(
+        (io.load<float, 1>(dir.file("a")).get()), std::runtime_error
+    );
+
+    std::filesystem::resize_file(dir.file("a"), vt::io_block_size + 100);
+    CHECK_THROWS_AS(
+        (io.load<float, 1>(dir.file("a")).get()), std::runtime_error
+    );
+
+    std::filesystem::resize_file(dir.file("a"), 10);
+    CHECK_THROWS_AS(
+        (io.load<float, 1>(dir.file("a")).get()), std::runtime_error
+    );
+}
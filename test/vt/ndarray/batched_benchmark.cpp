@@ -0,0 +1,87 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/batched.hpp>
+
+#include <catch2/catch.hpp>
+#include <string>
+
+
+static void mul(
+    vt::ndview<const float, 2> A,
+    vt::ndview<const float, 2> B,
+    vt::ndview<float, 2> C
+) {
+    const std::size_t n = A.shape(0);
+    const std::size_t m = A.shape(1);
+    const std::size_t p = B.shape(1);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < p; ++j) {
+            C[i][j] = 0.0f;
+            for (std::size_t k = 0; k < m; ++k) {
+                C[i][j] += A[i][k] * B[k][j];
+            }
+        }
+    }
+}
+
+
+TEST_CASE(
+    "Benchmark batched small matrix multiplication",
+    "[ndarray][batched][!benchmark]"
+) {
+    const std::size_t n = GENERATE(as<std::size_t>{}, 4, 8, 16, 32);
+    const std::size_t batch = 4096;
+    const std::string suffix = ", n = " + std::to_string(n);
+
+    const vt::ndarray<float, 3> A{{ batch, n, n }, 1.0f};
+    const vt::ndarray<float, 3> B{{ batch, n, n }, 0.5f};
+    vt::ndarray<float, 3> C{{ batch, n, n }};
+
+    const vt::ndarray<float, 3> A_interleaved{{ n, n, batch }, 1.0f};
+    const vt::ndarray<float, 3> B_interleaved{{ n, n, batch }, 0.5f};
+    vt::ndarray<float, 3> C_interleaved{{ n, n, batch }};
+
+    BENCHMARK("One by one" + suffix) {
+        for (std::size_t b = 0; b < batch; ++b) {
+            mul(A[b], B[b], C[b]);
+        }
+    };
+
+    BENCHMARK("Leading layout" + suffix) {
+        vt::batched_mul<float>(A, B, C.view());
+    };
+
+    BENCHMARK("Interleaved layout" + suffix) {
+        vt::batched_mul<float>(
+            A_interleaved, B_interleaved, C_interleaved.view(),
+            vt::batch_layout::interleaved
+        );
+    };
+
+    BENCHMARK("Interleaved layout, all threads" + suffix) {
+        vt::batched_mul<float>(
+            A_interleaved, B_interleaved, C_interleaved.view(),
+            vt::batch_layout::interleaved, 0
+        );
+    };
+}
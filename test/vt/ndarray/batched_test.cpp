@@ -0,0 +1,287 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/batched.hpp>
+#include <vt/ndarray/container.hpp>
+
+#include <catch2/catch.hpp>
+#include <random>
+
+
+static vt::ndarray<double, 3> random_batch(
+    std::size_t batch,
+    std::size_t m,
+    std::size_t n,
+    unsigned seed
+) {
+    std::mt19937 engine{seed};
+    std::uniform_real_distribution<double> value{-1.0, 1.0};
+
+    vt::ndarray<double, 3> a{{ batch, m, n }};
+    for (double& x : a) x = value(engine);
+
+    return a;
+}
+
+
+// Symmetric positive definite: A A^T + n I
+static vt::ndarray<double, 3> random_spd_batch(
+    std::size_t batch,
+    std::size_t n,
+    unsigned seed
+) {
+    const vt::ndarray<double, 3> a = random_batch(batch, n, n, seed);
+
+    vt::ndarray<double, 3> spd{{ batch, n, n }, 0.0};
+    for (std::size_t b = 0; b < batch; ++b) {
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                for (std::size_t k = 0; k < n; ++k) {
+                    spd[b][i][j] += a[b][i][k] * a[b][j][k];
+                }
+            }
+            spd[b][i][i] += static_cast<double>(n);
+        }
+    }
+
+    return spd;
+}
+
+
+static vt::ndarray<double, 3> reference_mul(
+    const vt::ndarray<double, 3>& A,
+    const vt::ndarray<double, 3>& B
+) {
+    vt::ndarray<double, 3> C{{ A.shape(0), A.shape(1), B.shape(2) }, 0.0};
+    for (std::size_t b = 0; b < A.shape(0); ++b) {
+        for (std::size_t i = 0; i < A.shape(1); ++i) {
+            for (std::size_t j = 0; j < B.shape(2); ++j) {
+                for (std::size_t k = 0; k < A.shape(2); ++k) {
+                    C[b][i][j] += A[b][i][k] * B[b][k][j];
+                }
+            }
+        }
+    }
+
+    return C;
+}
+
+
+static void require_close(
+    const vt::ndarray<double, 3>& actual,
+    const vt::ndarray<double, 3>& expected
+) {
+    REQUIRE(actual.shape() == expected.shape());
+    for (std::size_t i = 0; i < actual.element_count(); ++i) {
+        REQUIRE(actual.data()[i] == Approx(expected.data()[i]).margin(1e-10));
+    }
+}
+
+
+static vt::ndarray<double, 3> interleaved(const vt::ndarray<double, 3>& a) {
+    vt::ndarray<double, 3> result{{ a.shape(1), a.shape(2), a.shape(0) }};
+    vt::interleave<double>(a, result.view());
+
+    return result;
+}
+
+
+static vt::ndarray<double, 3> deinterleaved(const vt::ndarray<double, 3>& a) {
+    vt::ndarray<double, 3> result{{ a.shape(2), a.shape(0), a.shape(1) }};
+    vt::deinterleave<double>(a, result.view());
+
+    return result;
+}
+
+
+TEST_CASE(
+    "vt::interleave and vt::deinterleave transpose the batch dimension",
+    "[ndarray][batched]"
+) {
+    const vt::ndarray<int, 3> a{{ 2, 1, 3 }, { 1, 2, 3, 4, 5, 6 }};
+    vt::ndarray<int, 3> b{{ 1, 3, 2 }};
+    vt::interleave<int>(a, b.view());
+    CHECK(b == vt::ndarray<int, 3>{{ 1, 3, 2 }, { 1, 4, 2, 5, 3, 6 }});
+
+    vt::ndarray<int, 3> c{{ 2, 1, 3 }};
+    vt::deinterleave<int>(b, c.view());
+    CHECK(c == a);
+}
+
+
+TEST_CASE(
+    "vt::batched_mul multiplies each matrix in the batch",
+    "[ndarray][batched]"
+) {
+    // Not a multiple of the lane count, to cover the remainder
+    const std::size_t batch = 37;
+    const vt::ndarray<double, 3> A = random_batch(batch, 3, 5, 1);
+    const vt::ndarray<double, 3> B = random_batch(batch, 5, 4, 2);
+    const vt::ndarray<double, 3> expected = reference_mul(A, B);
+
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    SECTION("Leading layout") {
+        vt::ndarray<double, 3> C{{ batch, 3, 4 }};
+        vt::batched_mul<double>(
+            A, B, C.view(), vt::batch_layout::leading, thread_count
+        );
+        require_close(C, expected);
+    }
+
+    SECTION("Interleaved layout") {
+        vt::ndarray<double, 3> C{{ 3, 4, batch }};
+        vt::batched_mul<double>(
+            interleaved(A), interleaved(B), C.view(),
+            vt::batch_layout::interleaved, thread_count
+        );
+        require_close(deinterleaved(C), expected);
+    }
+}
+
+
+TEST_CASE(
+    "vt::batched_cholesky factors and solves each matrix in the batch",
+    "[ndarray][batched]"
+) {
+    const std::size_t batch = 21;
+    const std::size_t n = 6;
+    const vt::ndarray<double, 3> A = random_spd_batch(batch, n, 3);
+    const vt::ndarray<double, 3> X = random_batch(batch, n, 2, 4);
+    const vt::ndarray<double, 3> B = reference_mul(A, X);
+
+    SECTION("Leading layout") {
+        vt::ndarray<double, 3> L = A;
+        REQUIRE(vt::batched_cholesky(L.view()));
+
+        vt::ndarray<double, 3> L_T{{ batch, n, n }};
+        for (std::size_t b = 0; b < batch; ++b) {
+            for (std::size_t i = 0; i < n; ++i) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    L_T[b][i][j] = L[b][j][i];
+                }
+            }
+        }
+        require_close(reference_mul(L, L_T), A);
+
+        vt::ndarray<double, 3> solution = B;
+        vt::batched_cholesky_solve<double>(L, solution.view());
+        require_close(solution, X);
+    }
+
+    SECTION("Interleaved layout") {
+        vt::ndarray<double, 3> L = interleaved(A);
+        REQUIRE(vt::batched_cholesky(
+            L.view(), vt::batch_layout::interleaved, 2
+        ));
+
+        vt::ndarray<double, 3> solution = interleaved(B);
+        vt::batched_cholesky_solve<double>(
+            L, solution.view(), vt::batch_layout::interleaved, 2
+        );
+        require_close(deinterleaved(solution), X);
+    }
+
+    SECTION("Not positive definite") {
+        vt::ndarray<double, 3> L = A;
+        L[batch - 1][2][2] = -1.0;
+        REQUIRE_FALSE(vt::batched_cholesky(L.view()));
+    }
+}
+
+
+TEST_CASE(
+    "vt::batched_lu factors and solves each matrix in the batch",
+    "[ndarray][batched]"
+) {
+    const std::size_t batch = 19;
+    const std::size_t n = 5;
+    const vt::ndarray<double, 3> A = random_batch(batch, n, n, 5);
+    const vt::ndarray<double, 3> X = random_batch(batch, n, 3, 6);
+    const vt::ndarray<double, 3> B = reference_mul(A, X);
+
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 2);
+
+    SECTION("Leading layout") {
+        vt::ndarray<double, 3> LU = A;
+        vt::ndarray<std::size_t, 2> pivots{{ batch, n }};
+        REQUIRE(vt::batched_lu(
+            LU.view(), pivots.view(), vt::batch_layout::leading, thread_count
+        ));
+
+        vt::ndarray<double, 3> solution = B;
+        vt::batched_lu_solve<double>(
+            LU, pivots, solution.view(),
+            vt::batch_layout::leading, thread_count
+        );
+        require_close(solution, X);
+    }
+
+    SECTION("Interleaved layout") {
+        vt::ndarray<double, 3> LU = interleaved(A);
+        vt::ndarray<std::size_t, 2> pivots{{ n, batch }};
+        REQUIRE(vt::batched_lu(
+            LU.view(), pivots.view(),
+            vt::batch_layout::interleaved, thread_count
+        ));
+
+        vt::ndarray<double, 3> solution = interleaved(B);
+        vt::batched_lu_solve<double>(
+            LU, pivots, solution.view(),
+            vt::batch_layout::interleaved, thread_count
+        );
+        require_close(deinterleaved(solution), X);
+    }
+
+    SECTION("Singular") {
+        vt::ndarray<double, 3> LU{{ 1, 2, 2 }, { 1.0, 2.0, 2.0, 4.0 }};
+        vt::ndarray<std::size_t, 2> pivots{{ 1, 2 }};
+        REQUIRE_FALSE(vt::batched_lu(LU.view(), pivots.view()));
+    }
+}
+
+
+TEST_CASE(
+    "vt::batched_inverse inverts each matrix in the batch",
+    "[ndarray][batched]"
+) {
+    const std::size_t batch = 17;
+    const std::size_t n = 4;
+    const vt::ndarray<double, 3> A = random_batch(batch, n, n, 7);
+
+    vt::ndarray<double, 3> identity{{ batch, n, n }, 0.0};
+    for (std::size_t b = 0; b < batch; ++b) {
+        for (std::size_t i = 0; i < n; ++i) identity[b][i][i] = 1.0;
+    }
+
+    SECTION("Leading layout") {
+        vt::ndarray<double, 3> A_inv{{ batch, n, n }};
+        REQUIRE(vt::batched_inverse<double>(A, A_inv.view()));
+        require_close(reference_mul(A, A_inv), identity);
+    }
+
+    SECTION("Interleaved layout") {
+        vt::ndarray<double, 3> A_inv{{ n, n, batch }};
+        REQUIRE(vt::batched_inverse<double>(
+            interleaved(A), A_inv.view(), vt::batch_layout::interleaved
+        ));
+        require_close(reference_mul(A, deinterleaved(A_inv)), identity);
+    }
+}
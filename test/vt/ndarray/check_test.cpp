@@ -0,0 +1,243 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/check.hpp>
+#include <vt/ndarray/container.hpp>
+#include <vt/ndarray/pipeline.hpp>
+#include <vt/ndarray/view.hpp>
+
+#include <catch2/catch.hpp>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if (defined(__unix__) || defined(__APPLE__)) && VT_NDARRAY_CHECK_LEVEL >= 1
+#   include <sys/wait.h>
+#   include <unistd.h>
+#   define VT_NDARRAY_TEST_FORK
+#endif
+
+
+static void ignore_failure(const char* /* message */) noexcept {
+}
+
+
+#ifdef VT_NDARRAY_TEST_FORK
+
+struct child_result {
+    int status;
+    std::string output;
+};
+
+
+static void exit_with_message(const char* message) noexcept {
+    const ssize_t written =
+        ::write(STDERR_FILENO, message, std::strlen(message));
+    (void)written;
+    std::_Exit(3);
+}
+
+
+// Runs the function in a child process, so that a failing check can be
+// observed without ending the test run. Returns the exit status together with
+// everything the child wrote to stderr.
+template<typename F>
+static child_result run_in_child(vt::check_handler handler, F f) {
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+
+    const pid_t pid = ::fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0) {
+        ::close(fds[0]);
+        ::dup2(fds[1], STDERR_FILENO);
+        // The test framework reports signals as failures of its own
+        std::signal(SIGABRT, SIG_DFL);
+        vt::set_check_handler(handler);
+        f();
+        std::_Exit(0);
+    }
+
+    ::close(fds[1]);
+    child_result result{0, {}};
+    char buffer[256];
+    ssize_t count;
+    while ((count = ::read(fds[0], buffer, sizeof(buffer))) > 0) {
+        result.output.append(buffer, static_cast<std::size_t>(count));
+    }
+    ::close(fds[0]);
+    ::waitpid(pid, &result.status, 0);
+
+    return result;
+}
+
+#endif
+
+
+TEST_CASE(
+    "vt::set_check_handler returns the previous handler",
+    "[ndarray][check]"
+) {
+    const vt::check_handler original = vt::get_check_handler();
+
+    CHECK(vt::set_check_handler(ignore_failure) == original);
+    CHECK(vt::get_check_handler() == ignore_failure);
+    CHECK(vt::set_check_handler(original) == ignore_failure);
+    CHECK(vt::get_check_handler() == original);
+}
+
+
+TEST_CASE(
+    "Checked accesses at the bounds of a vt::ndview are accepted",
+    "[ndarray][check]"
+) {
+    vt::ndarray<int, 2> a{{ 3, 4 }, 7};
+    vt::ndview<int, 2> v = a;
+
+    CHECK(v[2][3] == 7);
+    CHECK(v.slice(3).shape(0) == 0);
+    CHECK(v.slice(0, 3).shape(0) == 3);
+    CHECK(v.slice(1, 2)[1][0] == 7);
+    CHECK(v.reshape({ 2, 6 }).shape(1) == 6);
+    CHECK(v.reshape({ 12 })[11] == 7);
+}
+
+
+#ifdef VT_NDARRAY_TEST_FORK
+
+TEST_CASE(
+    "A failing index check reports the offending access",
+    "[ndarray][check]"
+) {
+    vt::ndarray<int, 2> a{{ 3, 4 }, 0};
+    vt::ndview<int, 2> v = a;
+    volatile std::size_t idx = 4;
+
+    SECTION("first dimension") {
+        const child_result result = run_in_child(exit_with_message, [&] {
+            v[idx][0] = 1;
+        });
+
+        CHECK(WIFEXITED(result.status));
+        CHECK(WEXITSTATUS(result.status) == 3);
+        CHECK_THAT(
+            result.output,
+            Catch::StartsWith("vt::ndview::operator[]: index out of range")
+        );
+#if VT_NDARRAY_CHECK_LEVEL >= 2
+        CHECK_THAT(result.output, Catch::EndsWith("(index 4, shape [3, 4])"));
+#endif
+    }
+
+    SECTION("last dimension") {
+        const child_result result = run_in_child(exit_with_message, [&] {
+            v[0][idx] = 1;
+        });
+
+        CHECK(WEXITSTATUS(result.status) == 3);
+#if VT_NDARRAY_CHECK_LEVEL >= 2
+        CHECK_THAT(result.output, Catch::EndsWith("(index 4, shape [4])"));
+#endif
+    }
+
+    SECTION("without a handler the program aborts") {
+        const child_result result = run_in_child(nullptr, [&] {
+            v[idx][0] = 1;
+        });
+
+        CHECK(WTERMSIG(result.status) == SIGABRT);
+        CHECK_THAT(
+            result.output,
+            Catch::StartsWith("vt::ndview::operator[]: index out of range")
+        );
+    }
+}
+
+
+TEST_CASE(
+    "Slice checks of a vt::ndview do not wrap around",
+    "[ndarray][check]"
+) {
+    vt::ndarray<int, 1> a{{ 5 }, 0};
+    vt::ndview<int, 1> v = a;
+    volatile std::size_t count = static_cast<std::size_t>(-1);
+
+    const child_result result = run_in_child(exit_with_message, [&] {
+        (void)v.slice(2, count);
+    });
+
+    CHECK(WEXITSTATUS(result.status) == 3);
+    CHECK_THAT(
+        result.output,
+        Catch::StartsWith("vt::ndview::slice: range out of bounds")
+    );
+}
+
+#endif
+
+
+#if defined(VT_NDARRAY_TEST_FORK) && VT_NDARRAY_CHECK_LEVEL >= 2
+
+TEST_CASE(
+    "Reshape checks of a vt::ndview compare element counts",
+    "[ndarray][check]"
+) {
+    vt::ndarray<int, 2> a{{ 3, 4 }, 0};
+    vt::ndview<int, 2> v = a;
+
+    const child_result result = run_in_child(exit_with_message, [&] {
+        (void)v.reshape({ 5, 2 });
+    });
+
+    CHECK(WEXITSTATUS(result.status) == 3);
+    CHECK_THAT(
+        result.output,
+        Catch::EndsWith("(12 elements, new shape [5, 2])")
+    );
+}
+
+#endif
+
+
+#ifdef VT_NDARRAY_ASAN
+
+TEST_CASE(
+    "A vt::ndarray_pool poisons idle arrays",
+    "[ndarray][check]"
+) {
+    vt::ndarray_pool<float, 1> pool{2};
+
+    const float* data;
+    {
+        vt::pooled_ndarray<float, 1> a = pool.acquire({ 16 });
+        data = a.view().data();
+        CHECK(__asan_address_is_poisoned(data) == 0);
+    }
+    CHECK(__asan_address_is_poisoned(data) != 0);
+    CHECK(__asan_address_is_poisoned(data + 15) != 0);
+
+    vt::pooled_ndarray<float, 1> b = pool.acquire({ 16 });
+    CHECK(b.view().data() == data);
+    CHECK(__asan_address_is_poisoned(data) == 0);
+    CHECK(__asan_address_is_poisoned(data + 15) == 0);
+}
+
+#endif
@@ -0,0 +1,152 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/compressed.hpp>
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+
+TEST_CASE(
+    "A vt::compressed_ndarray reproduces integer data exactly",
+    "[ndarray][compressed]"
+) {
+    vt::ndarray<std::int32_t, 2> a{{ 300, 50 }};
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<std::int32_t> noise{-3, 3};
+    for (std::size_t i = 0; i < a.shape(0); ++i) {
+        for (std::size_t j = 0; j < a.shape(1); ++j) {
+            a[i][j] = static_cast<std::int32_t>(i * j) + noise(rng);
+        }
+    }
+
+    const vt::compressed_ndarray<std::int32_t, 2> c{a, { 64, 2, 0.0 }};
+
+    REQUIRE(c.shape() == a.shape());
+    REQUIRE(c.chunk_rows() == 64);
+    REQUIRE(c.chunk_count() == 5);
+    REQUIRE(c.compressed_size() < a.element_count() * sizeof(std::int32_t));
+
+    REQUIRE(c.decompress() == a);
+}
+
+
+TEST_CASE(
+    "A vt::compressed_ndarray stores incompressible data without loss",
+    "[ndarray][compressed]"
+) {
+    vt::ndarray<std::uint8_t, 1> a{{ 10000 }};
+    std::mt19937 rng{7};
+    for (auto& x : a) x = static_cast<std::uint8_t>(rng());
+
+    const vt::compressed_ndarray<std::uint8_t, 1> c{a};
+
+    REQUIRE(c.decompress() == a);
+}
+
+
+TEST_CASE(
+    "A vt::compressed_ndarray compresses floating-point data losslessly by "
+    "default",
+    "[ndarray][compressed]"
+) {
+    vt::ndarray<float, 3> a{{ 20, 8, 8 }};
+    std::size_t i = 0;
+    for (auto& x : a) x = std::sin(0.01f * static_cast<float>(i++));
+
+    const vt::compressed_ndarray<float, 3> c{a, { 3, 4, 0.0 }};
+
+    const vt::ndarray<float, 3> b = c.decompress();
+
+    REQUIRE(std::equal(
+        a.begin(), a.end(), b.begin(),
+        [](float x, float y) { return std::memcmp(&x, &y, sizeof(x)) == 0; }
+    ));
+}
+
+
+TEST_CASE(
+    "A vt::compressed_ndarray can compress floating-point data within an "
+    "error bound",
+    "[ndarray][compressed]"
+) {
+    vt::ndarray<double, 2> a{{ 100, 100 }};
+    std::size_t i = 0;
+    for (auto& x : a) x = std::sin(0.001 * static_cast<double>(i++));
+
+    const double error_bound = 1e-4;
+    const vt::compressed_ndarray<double, 2> lossless{a};
+    const vt::compressed_ndarray<double, 2> lossy{a, { 0, 4, error_bound }};
+
+    REQUIRE(lossy.compressed_size() < lossless.compressed_size());
+
+    const vt::ndarray<double, 2> b = lossy.decompress();
+    double max_error = 0.0;
+    for (std::size_t k = 0; k < a.element_count(); ++k) {
+        max_error = std::max(max_error, std::abs(a.data()[k] - b.data()[k]));
+    }
+
+    REQUIRE(max_error <= error_bound);
+}
+
+
+TEST_CASE(
+    "Chunks of a vt::compressed_ndarray are decompressed on demand into a "
+    "bounded cache",
+    "[ndarray][compressed]"
+) {
+    vt::ndarray<std::int64_t, 2> a{{ 10, 3 }};
+    std::int64_t k = 0;
+    for (auto& x : a) x = k++;
+
+    vt::compressed_ndarray<std::int64_t, 2> c{a, { 4, 2, 0.0 }};
+
+    REQUIRE(c.chunk_count() == 3);
+
+    const vt::ndview<const std::int64_t, 2> first = c.chunk(0);
+
+    REQUIRE(first.shape(0) == 4);
+    REQUIRE(first.shape(1) == 3);
+    CHECK(first[3][2] == 11);
+
+    // The last chunk has the remaining rows
+    REQUIRE(c.chunk(2).shape(0) == 2);
+    CHECK(c.chunk(2)[1][2] == 29);
+
+    // Rows are accessed through the chunk that contains them
+    CHECK(c[5][1] == 16);
+    CHECK(c[0][0] == 0);
+    CHECK(c[9][0] == 27);
+
+    // Rows are copies, which outlive the eviction of their chunk
+    const vt::ndarray<std::int64_t, 1> row = c[1];
+    c.chunk(1);
+    c.chunk(2);
+    c.clear_cache();
+    CHECK(row == vt::ndarray<std::int64_t, 1>{{ 3 }, { 3, 4, 5 }});
+
+    vt::compressed_ndarray<std::int64_t, 1> flat{a.flatten()};
+
+    CHECK(flat[17] == 17);
+}
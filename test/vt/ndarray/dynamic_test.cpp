@@ -0,0 +1,217 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/dynamic.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+
+TEST_CASE(
+    "vt::dtype_of maps arithmetic types to their runtime type",
+    "[ndarray][dynamic]"
+) {
+    CHECK(vt::dtype_of<std::int8_t> == vt::dtype::int8);
+    CHECK(vt::dtype_of<std::uint16_t> == vt::dtype::uint16);
+    CHECK(vt::dtype_of<const std::int32_t> == vt::dtype::int32);
+    CHECK(vt::dtype_of<std::uint64_t> == vt::dtype::uint64);
+    CHECK(vt::dtype_of<float> == vt::dtype::float32);
+    CHECK(vt::dtype_of<double> == vt::dtype::float64);
+
+    CHECK(vt::dtype_size(vt::dtype::int16) == 2);
+    CHECK(vt::dtype_size(vt::dtype::float64) == 8);
+}
+
+
+TEST_CASE(
+    "vt::visit calls a function with a tag of the type matching a vt::dtype",
+    "[ndarray][dynamic]"
+) {
+    const std::size_t size = vt::visit(vt::dtype::int32, [](auto tag) {
+        return sizeof(typename decltype(tag)::type);
+    });
+
+    REQUIRE(size == 4);
+}
+
+
+TEST_CASE(
+    "vt::visit calls a function with a vt::dynamic_ndview as a statically "
+    "shaped vt::ndview",
+    "[ndarray][dynamic]"
+) {
+    std::int32_t data[24] = {};
+    data[23] = 7;
+
+    const vt::dynamic_ndview<void> view{
+        vt::dtype::int32, { 2, 3, 4 }, data
+    };
+    const std::size_t rank = vt::visit(view, [](auto a) {
+        using view_type = decltype(a);
+        if constexpr (
+            std::is_same_v<view_type, vt::ndview<std::int32_t, 3>>
+        ) {
+            a[1][2][3] += 1;
+        }
+
+        return view_type::dim_count;
+    });
+    CHECK(rank == 3);
+    CHECK(data[23] == 8);
+
+    const vt::dynamic_ndview<const void> cview = view;
+    const bool is_const = vt::visit(cview, [](auto a) {
+        return std::is_const_v<typename decltype(a)::element_type>;
+    });
+    CHECK(is_const);
+
+    const vt::dynamic_ndview<void> rank_8{
+        vt::dtype::int32, { 1, 1, 1, 2, 1, 3, 1, 4 }, data
+    };
+    CHECK(vt::visit(rank_8, [](auto a) { return a.element_count(); }) == 24);
+
+    const vt::dynamic_ndview<void> too_large{
+        vt::dtype::int32, { 1, 1, 1, 1, 1, 1, 1, 1, 1 }, data
+    };
+    CHECK_THROWS_AS(
+        vt::visit(too_large, [](auto) {}),
+        std::invalid_argument
+    );
+}
+
+
+TEST_CASE(
+    "A vt::dynamic_shape stores its extents without heap allocation up to "
+    "the inline capacity",
+    "[ndarray][dynamic]"
+) {
+    vt::dynamic_shape small{ 2, 3, 4 };
+    vt::dynamic_shape large{ 1, 2, 3, 4, 5, 6 };
+
+    REQUIRE(small.rank() == 3);
+    REQUIRE(small.element_count() == 24);
+    REQUIRE(large.rank() == 6);
+    REQUIRE(large.element_count() == 720);
+
+    vt::dynamic_shape copy = large;
+    CHECK(copy == large);
+    CHECK(copy != small);
+
+    vt::dynamic_shape moved = std::move(copy);
+    CHECK(moved == large);
+    CHECK(copy.rank() == 0);
+}
+
+
+TEST_CASE(
+    "A vt::dynamic_ndview can be created from a statically shaped vt::ndview",
+    "[ndarray][dynamic]"
+) {
+    float data[6] = { 3, 1, 4, 1, 5, 9 };
+    const vt::ndview<float, 2> view{{ 2, 3 }, data};
+
+    const vt::dynamic_ndview<void> dview = view;
+
+    REQUIRE(dview.type() == vt::dtype::float32);
+    REQUIRE(dview.rank() == 2);
+    REQUIRE(dview.shape(0) == 2);
+    REQUIRE(dview.shape(1) == 3);
+    REQUIRE(dview.byte_size() == sizeof(data));
+    REQUIRE(dview.data() == data);
+}
+
+
+TEST_CASE(
+    "A vt::dynamic_ndview can be converted back to a statically shaped "
+    "vt::ndview",
+    "[ndarray][dynamic]"
+) {
+    const int data[6] = { 3, 1, 4, 1, 5, 9 };
+    const vt::dynamic_ndview<const void> dview{
+        vt::dtype_of<int>, { 2, 3 }, data
+    };
+
+    REQUIRE((dview.holds<int, 2>()));
+    REQUIRE_FALSE((dview.holds<int, 3>()));
+    REQUIRE_FALSE((dview.holds<float, 2>()));
+
+    const vt::ndview<const int, 2> view = dview.as<const int, 2>();
+
+    CHECK(view.data() == data);
+    CHECK(view[1][2] == 9);
+
+    const vt::ndview<const int, 1> flat = dview.flatten<const int>();
+
+    CHECK(flat.shape(0) == 6);
+}
+
+
+TEST_CASE(
+    "A vt::dynamic_ndarray allocates storage for a runtime type and shape",
+    "[ndarray][dynamic]"
+) {
+    vt::dynamic_ndarray a{vt::dtype::int16, { 2, 2, 2, 2, 2 }};
+
+    REQUIRE(a.type() == vt::dtype::int16);
+    REQUIRE(a.rank() == 5);
+    REQUIRE(a.element_count() == 32);
+    REQUIRE(a.byte_size() == 64);
+    REQUIRE(
+        reinterpret_cast<std::uintptr_t>(a.data()) %
+            a.get_allocator().align_val() == 0
+    );
+
+    auto flat = a.flatten<std::int16_t>();
+    std::iota(flat.begin(), flat.end(), std::int16_t{0});
+
+    const vt::ndview<std::int16_t, 5> view = a.as<std::int16_t, 5>();
+
+    CHECK(view[1][1][1][1][1] == 31);
+}
+
+
+TEST_CASE(
+    "A vt::dynamic_ndarray deep copies its elements",
+    "[ndarray][dynamic]"
+) {
+    const std::int64_t data[3] = { 3, 1, 4 };
+    const vt::dynamic_ndarray a{vt::ndview<const std::int64_t, 1>{{ 3 }, data}};
+
+    REQUIRE(a.data() != data);
+    REQUIRE(a.as<std::int64_t, 1>()[2] == 4);
+
+    vt::dynamic_ndarray b = a;
+
+    REQUIRE(b.data() != a.data());
+    REQUIRE(b.shape() == a.shape());
+
+    b.as<std::int64_t, 1>()[2] = 5;
+
+    CHECK(a.as<std::int64_t, 1>()[2] == 4);
+
+    const vt::dynamic_ndarray c = std::move(b);
+
+    CHECK(c.as<std::int64_t, 1>()[2] == 5);
+    CHECK(b.data() == nullptr);
+    CHECK(b.element_count() == 0);
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/fft.hpp>
+
+#include <catch2/catch.hpp>
+#include <complex>
+#include <string>
+
+
+TEST_CASE("Benchmark 1D FFT", "[ndarray][fft][!benchmark]") {
+    const std::size_t n = GENERATE(as<std::size_t>{}, 1024, 1000, 4096);
+    const std::string suffix = ", n = " + std::to_string(n);
+
+    const std::complex<float> value{1.0f, 0.5f};
+    vt::ndarray<std::complex<float>, 1> x{{ n }, value};
+    vt::ndarray<std::complex<float>, 1> y{{ n }};
+    vt::ndarray<float, 1> r{{ n }, 1.0f};
+    vt::ndarray<std::complex<float>, 1> y_half{{ n / 2 + 1 }};
+
+    BENCHMARK("Complex" + suffix) {
+        vt::fft<float>(x, y.view());
+    };
+
+    BENCHMARK("Real" + suffix) {
+        vt::rfft<float>(r, y_half.view());
+    };
+}
+
+
+TEST_CASE("Benchmark 2D FFT", "[ndarray][fft][!benchmark]") {
+    const std::size_t n = 512;
+
+    const std::complex<float> value{1.0f, 0.5f};
+    const vt::ndarray<std::complex<float>, 2> x{{ n, n }, value};
+    vt::ndarray<std::complex<float>, 2> y{{ n, n }};
+
+    BENCHMARK("Last axis") {
+        vt::fft<float>(x, y.view(), { 1 });
+    };
+
+    BENCHMARK("First axis") {
+        vt::fft<float>(x, y.view(), { 0 });
+    };
+
+    BENCHMARK("Both axes") {
+        vt::fft<float>(x, y.view());
+    };
+
+    BENCHMARK("Both axes, all threads") {
+        vt::fft<float>(x, y.view(), {}, 0);
+    };
+}
@@ -0,0 +1,260 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/fft.hpp>
+#include <vt/ndarray/container.hpp>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <complex>
+#include <random>
+
+
+using cdouble = std::complex<double>;
+
+
+static vt::ndarray<cdouble, 1> random_signal(std::size_t n, unsigned seed) {
+    std::mt19937 engine{seed};
+    std::uniform_real_distribution<double> value{-1.0, 1.0};
+
+    vt::ndarray<cdouble, 1> x{{ n }};
+    for (cdouble& z : x) z = {value(engine), value(engine)};
+
+    return x;
+}
+
+
+static vt::ndarray<cdouble, 1> naive_dft(
+    vt::ndview<const cdouble, 1> x,
+    double sign
+) {
+    const std::size_t n = x.shape(0);
+    const double pi = 3.14159265358979323846;
+
+    vt::ndarray<cdouble, 1> y{{ n }, cdouble{}};
+    for (std::size_t k = 0; k < n; ++k) {
+        for (std::size_t t = 0; t < n; ++t) {
+            const double angle = sign * 2.0 * pi *
+                static_cast<double>(k * t % n) / static_cast<double>(n);
+            y[k] += x[t] * cdouble{std::cos(angle), std::sin(angle)};
+        }
+    }
+
+    return y;
+}
+
+
+static double max_difference(
+    vt::ndview<const cdouble, 1> a,
+    vt::ndview<const cdouble, 1> b
+) {
+    double result = 0.0;
+    for (std::size_t i = 0; i < a.shape(0); ++i) {
+        result = std::max(result, std::abs(a[i] - b[i]));
+    }
+
+    return result;
+}
+
+
+TEST_CASE(
+    "vt::fft matches a direct DFT",
+    "[ndarray][fft]"
+) {
+    const std::size_t n = GENERATE(as<std::size_t>{},
+        1, 2, 3, 4, 5, 6, 7, 8, 12, 15, 16, 30, 49, 60, 64, 97, 120, 256
+    );
+
+    const vt::ndarray<cdouble, 1> x = random_signal(n, 1);
+    const double scale = static_cast<double>(n);
+
+    vt::ndarray<cdouble, 1> y{{ n }};
+    vt::fft(x, y.view());
+    CHECK(max_difference(y, naive_dft(x, -1.0)) < 1e-12 * scale);
+
+    vt::ndarray<cdouble, 1> z{{ n }};
+    vt::ifft(y, z.view());
+    CHECK(max_difference(z, x) < 1e-14 * scale);
+}
+
+
+TEST_CASE(
+    "vt::fft can transform an array in place",
+    "[ndarray][fft]"
+) {
+    const vt::ndarray<cdouble, 1> x = random_signal(60, 2);
+
+    vt::ndarray<cdouble, 1> y = x;
+    vt::fft<double>(y, y.view());
+
+    CHECK(max_difference(y, naive_dft(x, -1.0)) < 1e-12);
+}
+
+
+TEST_CASE(
+    "vt::fft transforms along selected axes",
+    "[ndarray][fft]"
+) {
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    const std::size_t n0 = 6;
+    const std::size_t n1 = 5;
+    const std::size_t n2 = 70;
+    const vt::ndarray<cdouble, 1> flat = random_signal(n0 * n1 * n2, 3);
+    const vt::ndarray<cdouble, 3> x{{ n0, n1, n2 }, flat.begin(), flat.end()};
+
+    SECTION("middle axis") {
+        vt::ndarray<cdouble, 3> y{{ n0, n1, n2 }};
+        vt::fft(x, y.view(), { 1 }, thread_count);
+
+        for (std::size_t i = 0; i < n0; ++i) {
+            for (std::size_t k = 0; k < n2; ++k) {
+                vt::ndarray<cdouble, 1> line{{ n1 }};
+                vt::ndarray<cdouble, 1> expected{{ n1 }};
+                for (std::size_t j = 0; j < n1; ++j) line[j] = x[i][j][k];
+                expected = naive_dft(line, -1.0);
+                for (std::size_t j = 0; j < n1; ++j) line[j] = y[i][j][k];
+                CHECK(max_difference(line, expected) < 1e-12);
+            }
+        }
+    }
+
+    SECTION("all axes and back") {
+        vt::ndarray<cdouble, 3> y{{ n0, n1, n2 }};
+        vt::fft(x, y.view(), {}, thread_count);
+
+        // The zero frequency is the sum of all elements
+        cdouble sum{};
+        for (const cdouble& z : x) sum += z;
+        CHECK(std::abs(y[0][0][0] - sum) < 1e-10);
+
+        vt::ndarray<cdouble, 3> z{{ n0, n1, n2 }};
+        vt::ifft(y, z.view(), { 2, 0, 1 }, thread_count);
+        double error = 0.0;
+        for (std::size_t i = 0; i < flat.element_count(); ++i) {
+            error = std::max(error, std::abs(z.data()[i] - x.data()[i]));
+        }
+        CHECK(error < 1e-12);
+    }
+}
+
+
+TEST_CASE(
+    "vt::rfft matches the complex transform of real input",
+    "[ndarray][fft]"
+) {
+    const std::size_t n = GENERATE(as<std::size_t>{},
+        1, 2, 3, 4, 7, 10, 15, 16, 36, 97, 128
+    );
+    const std::size_t rows = 3;
+
+    std::mt19937 engine{4};
+    std::uniform_real_distribution<double> value{-1.0, 1.0};
+    vt::ndarray<double, 2> x{{ rows, n }};
+    for (double& v : x) v = value(engine);
+
+    const double scale = static_cast<double>(n);
+
+    vt::ndarray<cdouble, 2> y{{ rows, n / 2 + 1 }};
+    vt::rfft(x, y.view(), { 1 });
+
+    for (std::size_t i = 0; i < rows; ++i) {
+        vt::ndarray<cdouble, 1> line{{ n }};
+        for (std::size_t t = 0; t < n; ++t) line[t] = x[i][t];
+        const vt::ndarray<cdouble, 1> expected = naive_dft(line, -1.0);
+
+        for (std::size_t k = 0; k <= n / 2; ++k) {
+            CHECK(std::abs(y[i][k] - expected[k]) < 1e-12 * scale);
+        }
+    }
+
+    vt::ndarray<double, 2> z{{ rows, n }};
+    vt::irfft(y, z.view(), { 1 });
+    for (std::size_t i = 0; i < x.element_count(); ++i) {
+        CHECK(std::abs(z.data()[i] - x.data()[i]) < 1e-14 * scale);
+    }
+}
+
+
+TEST_CASE(
+    "vt::rfft transforms multiple axes",
+    "[ndarray][fft]"
+) {
+    const std::size_t n0 = GENERATE(as<std::size_t>{}, 8, 9);
+    const std::size_t n1 = 12;
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 2);
+
+    std::mt19937 engine{5};
+    std::uniform_real_distribution<double> value{-1.0, 1.0};
+    vt::ndarray<double, 2> x{{ n0, n1 }};
+    for (double& v : x) v = value(engine);
+
+    // Real axis 0, so the output is halved along the first axis
+    vt::ndarray<cdouble, 2> y{{ n0 / 2 + 1, n1 }};
+    vt::rfft(x, y.view(), { 1, 0 }, thread_count);
+
+    vt::ndarray<cdouble, 2> expected{{ n0, n1 }, x.begin(), x.end()};
+    vt::fft<double>(expected, expected.view(), {}, thread_count);
+    for (std::size_t i = 0; i <= n0 / 2; ++i) {
+        for (std::size_t j = 0; j < n1; ++j) {
+            CHECK(std::abs(y[i][j] - expected[i][j]) < 1e-12);
+        }
+    }
+
+    vt::ndarray<double, 2> z{{ n0, n1 }};
+    vt::irfft(y, z.view(), { 1, 0 }, thread_count);
+    for (std::size_t i = 0; i < x.element_count(); ++i) {
+        CHECK(std::abs(z.data()[i] - x.data()[i]) < 1e-14);
+    }
+}
+
+
+TEST_CASE(
+    "vt::fft supports single precision",
+    "[ndarray][fft]"
+) {
+    const std::size_t n = 120;
+    const vt::ndarray<cdouble, 1> x = random_signal(n, 6);
+
+    vt::ndarray<std::complex<float>, 1> xf{{ n }};
+    for (std::size_t i = 0; i < n; ++i) xf[i] = std::complex<float>{x[i]};
+
+    vt::ndarray<std::complex<float>, 1> yf{{ n }};
+    vt::fft(xf, yf.view());
+
+    const vt::ndarray<cdouble, 1> expected = naive_dft(x, -1.0);
+    for (std::size_t k = 0; k < n; ++k) {
+        CHECK(std::abs(cdouble(yf[k]) - expected[k]) < 1e-4);
+    }
+}
+
+
+TEST_CASE(
+    "vt::fft caches its plans per length",
+    "[ndarray][fft]"
+) {
+    const auto a = vt::fft_plan<double>::get(48);
+    const auto b = vt::fft_plan<double>::get(48);
+    CHECK(a == b);
+    CHECK(a->size() == 48);
+
+    vt::fft_plan<double>::clear_cache();
+    CHECK(vt::fft_plan<double>::get(48) != a);
+}
@@ -0,0 +1,154 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/fixed.hpp>
+
+#include <catch2/catch.hpp>
+#include <sstream>
+#include <type_traits>
+
+
+// Weights of the 2D 5-point Laplacian stencil
+static constexpr vt::fixed_ndarray<int, 3, 3> laplacian() {
+    vt::fixed_ndarray<int, 3, 3> w;
+    w[0][1] = 1;
+    w[1][0] = 1;
+    w[1][1] = -4;
+    w[1][2] = 1;
+    w[2][1] = 1;
+
+    return w;
+}
+
+
+// Binomial coefficients, filled row by row from the previous row
+static constexpr vt::fixed_ndarray<long, 8, 8> pascal() {
+    vt::fixed_ndarray<long, 8, 8> c;
+    for (std::size_t n = 0; n < 8; ++n) {
+        c[n][0] = 1;
+        for (std::size_t k = 1; k <= n; ++k) {
+            c[n][k] = c[n - 1][k - 1] + c[n - 1][k];
+        }
+    }
+
+    return c;
+}
+
+
+static constexpr vt::fixed_ndarray<int, 3, 3> laplacian_table = laplacian();
+static constexpr vt::fixed_ndarray<long, 8, 8> pascal_table = pascal();
+
+
+static constexpr int sum(vt::ndview<const int, 2> a) {
+    int result = 0;
+    for (int x : a) result += x;
+
+    return result;
+}
+
+
+TEST_CASE(
+    "A vt::fixed_ndarray can be built in constant expressions",
+    "[ndarray][fixed]"
+) {
+    static_assert(laplacian_table[1][1] == -4);
+    static_assert(laplacian_table[0][0] == 0);
+    static_assert(pascal_table[7][3] == 35);
+    static_assert(sum(laplacian_table) == 0);
+
+    constexpr vt::fixed_ndarray<int, 2, 3> a{ 1, 2, 3, 4, 5, 6 };
+    static_assert(a[1][2] == 6);
+    static_assert(a.element_count() == 6);
+    static_assert(a.shape(1) == 3);
+    static_assert(a == vt::fixed_ndarray<int, 2, 3>{ 1, 2, 3, 4, 5, 6 });
+    static_assert(a != vt::fixed_ndarray<int, 2, 3>::filled(0));
+
+    CHECK(laplacian_table[2][1] == 1);
+    CHECK(pascal_table[6][2] == 15);
+}
+
+
+TEST_CASE(
+    "A vt::fixed_ndarray is initialized with braces from exactly one value "
+    "per element",
+    "[ndarray][fixed]"
+) {
+    using array_type = vt::fixed_ndarray<int, 3>;
+
+    static_assert(std::is_constructible_v<array_type, int, int, int>);
+    static_assert(!std::is_constructible_v<array_type, int>);
+    static_assert(!std::is_constructible_v<array_type, int, int>);
+    static_assert(!std::is_constructible_v<array_type, int, int, int, int>);
+
+    constexpr vt::fixed_ndarray<long, 2> b{ 1, 2 };
+    static_assert(b[0] == 1 && b[1] == 2);
+
+    constexpr auto c = array_type::filled(5);
+    static_assert(c == array_type{ 5, 5, 5 });
+
+    constexpr vt::fixed_ndarray<int, 1> d = { 5 };
+    static_assert(d[0] == 5);
+}
+
+
+TEST_CASE(
+    "A vt::fixed_ndarray can be viewed through a vt::ndview",
+    "[ndarray][fixed]"
+) {
+    static constexpr vt::fixed_ndarray<int, 2, 2, 2> a{
+        0, 1, 2, 3, 4, 5, 6, 7
+    };
+
+    // A view of a static constant is itself a constant
+    constexpr vt::ndview<const int, 3> v = a;
+    static_assert(v.data() == a.data());
+    static_assert(v[1][0][1] == 5);
+    static_assert(v.shape(2) == 2 && v.element_count() == 8);
+
+    auto b = vt::fixed_ndarray<int, 2, 3>::filled(7);
+    vt::ndview<int, 2> w = b.view();
+    w[0][1] = 1;
+    CHECK(b[0][1] == 1);
+    CHECK(b[1][1] == 7);
+
+    std::ostringstream os;
+    os << vt::fixed_ndarray<int, 2, 2>{ 1, 2, 3, 4 };
+    CHECK(os.str() == "[[1,2],[3,4]]");
+}
+
+
+TEST_CASE(
+    "A vt::fixed_ndarray can be iterated over",
+    "[ndarray][fixed]"
+) {
+    constexpr vt::fixed_ndarray<int, 4> a{ 1, 2, 3, 4 };
+
+    int forward = 0;
+    for (int x : a) forward = 10 * forward + x;
+    CHECK(forward == 1234);
+
+    int backward = 0;
+    for (auto it = a.rbegin(); it != a.rend(); ++it) {
+        backward = 10 * backward + *it;
+    }
+    CHECK(backward == 4321);
+
+    CHECK(a.cend() - a.cbegin() == 4);
+}
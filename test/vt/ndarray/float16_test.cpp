@@ -0,0 +1,172 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/float16.hpp>
+#include <vt/ndarray/container.hpp>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+
+
+TEST_CASE(
+    "vt::half converts exactly representable values without loss",
+    "[ndarray][float16]"
+) {
+    CHECK(vt::half{1.0f}.bits() == 0x3c00);
+    CHECK(vt::half{-2.0f}.bits() == 0xc000);
+    CHECK(vt::half{65504.0f}.bits() == 0x7bff);
+    CHECK(vt::half{0.0f}.bits() == 0x0000);
+    CHECK(vt::half{-0.0f}.bits() == 0x8000);
+    // Smallest subnormal
+    CHECK(vt::half{std::ldexp(1.0f, -24)}.bits() == 0x0001);
+    // Smallest normal
+    CHECK(vt::half{std::ldexp(1.0f, -14)}.bits() == 0x0400);
+
+    CHECK(
+        static_cast<float>(vt::half::from_bits(0x3555)) ==
+            Approx(0.333251953125f)
+    );
+}
+
+
+TEST_CASE(
+    "vt::half rounds to nearest even and saturates to infinity",
+    "[ndarray][float16]"
+) {
+    // 1 + 2^-11 lies halfway between 1 and the next half value
+    CHECK(vt::half{1.0f + std::ldexp(1.0f, -11)}.bits() == 0x3c00);
+    CHECK(vt::half{1.0f + 3 * std::ldexp(1.0f, -11)}.bits() == 0x3c02);
+    CHECK(vt::half{65519.0f}.bits() == 0x7bff);
+    CHECK(vt::half{65520.0f}.bits() == 0x7c00);
+    CHECK(vt::half{std::numeric_limits<float>::infinity()}.bits() == 0x7c00);
+    CHECK(vt::half{std::ldexp(1.0f, -25)}.bits() == 0x0000);
+    CHECK(vt::half{std::ldexp(1.5f, -25)}.bits() == 0x0001);
+    CHECK(std::isnan(static_cast<float>(
+        vt::half{std::numeric_limits<float>::quiet_NaN()}
+    )));
+}
+
+
+TEST_CASE(
+    "Every vt::half value survives a round trip through float",
+    "[ndarray][float16]"
+) {
+    for (std::uint32_t bits = 0; bits <= 0xffff; ++bits) {
+        const vt::half h =
+            vt::half::from_bits(static_cast<std::uint16_t>(bits));
+        const float f = h;
+
+        if (std::isnan(f)) continue;
+
+        REQUIRE(vt::half{f}.bits() == h.bits());
+    }
+}
+
+
+TEST_CASE(
+    "vt::bfloat16 keeps the upper half of a float, rounded to nearest even",
+    "[ndarray][float16]"
+) {
+    CHECK(vt::bfloat16{1.0f}.bits() == 0x3f80);
+    CHECK(vt::bfloat16{-2.0f}.bits() == 0xc000);
+    CHECK(vt::bfloat16{1.0f + std::ldexp(1.0f, -8)}.bits() == 0x3f80);
+    CHECK(vt::bfloat16{1.0f + 3 * std::ldexp(1.0f, -8)}.bits() == 0x3f82);
+    CHECK(
+        static_cast<float>(vt::bfloat16::from_bits(0x4049)) ==
+            Approx(3.140625f)
+    );
+    CHECK(std::isnan(static_cast<float>(
+        vt::bfloat16{std::numeric_limits<float>::quiet_NaN()}
+    )));
+}
+
+
+TEST_CASE(
+    "Bulk conversion between views of float and 16-bit floats matches "
+    "element-wise conversion",
+    "[ndarray][float16]"
+) {
+    vt::ndarray<float, 2> a{{ 37, 29 }};
+    std::mt19937 rng{1};
+    std::uniform_real_distribution<float> exponent{-30.0f, 18.0f};
+    for (auto& x : a) {
+        x = std::exp2(exponent(rng)) * (rng() % 2 ? 1.0f : -1.0f);
+    }
+
+    vt::ndarray<vt::half, 2> h{a.shape()};
+    vt::ndarray<vt::bfloat16, 2> b{a.shape()};
+    vt::convert(a.cview(), h.view());
+    vt::convert(a.cview(), b.view());
+
+    vt::ndarray<float, 2> from_h{a.shape()};
+    vt::ndarray<float, 2> from_b{a.shape()};
+    vt::convert(h.cview(), from_h.view());
+    vt::convert(b.cview(), from_b.view());
+
+    for (std::size_t i = 0; i < a.element_count(); ++i) {
+        const float x = a.data()[i];
+
+        REQUIRE(h.data()[i].bits() == vt::half{x}.bits());
+        REQUIRE(b.data()[i].bits() == vt::bfloat16{x}.bits());
+        REQUIRE(from_h.data()[i] == Approx(static_cast<float>(vt::half{x})));
+        REQUIRE(
+            from_b.data()[i] == Approx(static_cast<float>(vt::bfloat16{x}))
+        );
+    }
+}
+
+
+TEST_CASE(
+    "Reductions over 16-bit float views accumulate in single precision",
+    "[ndarray][float16]"
+) {
+    // 4097 ones: half precision accumulation would get stuck at 2048
+    const vt::ndarray<vt::half, 1> h{{ 4097 }, vt::half{1.0f}};
+    const vt::ndarray<vt::bfloat16, 2> b{{ 3, 1000 }, vt::bfloat16{0.5f}};
+
+    CHECK(vt::sum(h.view()) == Approx(4097.0f));
+    CHECK(vt::sum(b.view()) == Approx(1500.0f));
+
+    CHECK(vt::dot(h.view(), h.view()) == Approx(4097.0f));
+    CHECK(vt::dot(b.view(), b.view()) == Approx(750.0f));
+}
+
+
+TEST_CASE(
+    "vt::convert, vt::sum and vt::dot accept arrays and mutable views as "
+    "inputs",
+    "[ndarray][float16]"
+) {
+    vt::ndarray<float, 1> a{{ 37 }};
+    std::iota(a.begin(), a.end(), 0.0f);
+    vt::ndarray<vt::half, 1> h{a.shape()};
+    vt::ndarray<float, 1> f{a.shape()};
+
+    vt::convert(a, h.view());
+    vt::convert(h.view(), f.view());
+    CHECK(f == a);
+
+    CHECK(vt::sum(h.view()) == Approx(666.0f));
+    CHECK(vt::dot(h.view(), h) == Approx(16206.0f));
+}
@@ -0,0 +1,292 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/format.hpp>
+
+#include <catch2/catch.hpp>
+#include <array>
+#include <cstdint>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+TEST_CASE(
+    "Streaming a vt::ndview gives the same output as the stream would",
+    "[ndarray][format]"
+) {
+    const vt::ndarray<double, 2> a{{ 2, 2 }, { 0.1, 1.0 / 3.0, 2.5, -1e20 }};
+
+    std::ostringstream expected;
+    expected << '[' << '[' << 0.1 << ',' << 1.0 / 3.0 << ']' << ','
+        << '[' << 2.5 << ',' << -1e20 << ']' << ']';
+
+    std::ostringstream ss;
+    ss << a;
+    CHECK(ss.str() == expected.str());
+
+    std::ostringstream fixed;
+    fixed << std::fixed << std::setprecision(2) << a;
+    CHECK(fixed.str() == "[[0.10,0.33],[2.50,-100000000000000000000.00]]");
+
+    // Falls back to the stream for flags to_chars does not support
+    std::ostringstream hex;
+    hex << std::hex << std::showbase << vt::ndarray<int, 1>{{ 2 }, { 10, 255 }};
+    CHECK(hex.str() == "[0xa,0xff]");
+
+    std::ostringstream chars;
+    chars << vt::ndarray<char, 1>{{ 2 }, { 'a', 'b' }};
+    CHECK(chars.str() == "[a,b]");
+}
+
+
+TEST_CASE(
+    "A field width applies to a streamed vt::ndview as a whole",
+    "[ndarray][format]"
+) {
+    const vt::ndarray<int, 2> a{{ 2, 2 }, { 1, 2, 3, 4 }};
+
+    std::ostringstream right;
+    right << std::setw(16) << a << '|' << 5;
+    CHECK(right.str() == "   [[1,2],[3,4]]|5");
+
+    std::ostringstream left;
+    left << std::left << std::setfill('.') << std::setw(16) << a << '|';
+    CHECK(left.str() == "[[1,2],[3,4]]...|");
+
+    std::ostringstream narrow;
+    narrow << std::setw(4) << std::setprecision(2)
+        << vt::ndarray<double, 1>{{ 2 }, { 0.125, 2.0 }};
+    CHECK(narrow.str() == "[0.12,2]");
+}
+
+
+TEST_CASE(
+    "vt::to_string writes the shortest representation that round-trips",
+    "[ndarray][format]"
+) {
+    const vt::ndarray<double, 1> a{{ 3 }, { 0.1, 1.0 / 3.0, -2.0 }};
+
+    CHECK(vt::to_string(a) == "[0.1,0.3333333333333333,-2]");
+
+    vt::format_options options;
+    options.precision = 3;
+    CHECK(vt::to_string(a, options) == "[0.1,0.333,-2]");
+
+    const vt::ndarray<int, 3> empty{{ 2, 0, 3 }};
+    CHECK(vt::to_string(empty) == "[[],[]]");
+}
+
+
+TEST_CASE(
+    "vt::parse_text cannot recover the extents after a zero extent",
+    "[ndarray][format]"
+) {
+    const vt::ndarray<int, 3> empty{{ 2, 0, 3 }};
+    const vt::ndarray<int, 3> parsed =
+        vt::parse_text<int, 3>(vt::to_string(empty));
+
+    CHECK(parsed.shape() == std::array<std::size_t, 3>{ 2, 0, 0 });
+}
+
+
+TEST_CASE(
+    "vt::to_string summarizes large arrays",
+    "[ndarray][format]"
+) {
+    vt::ndarray<int, 2> a{{ 10, 10 }};
+    std::iota(a.begin(), a.end(), 0);
+
+    vt::format_options options;
+    options.threshold = 50;
+    options.edge_items = 2;
+
+    CHECK(
+        vt::to_string(a, options) ==
+        "[[0,1,...,8,9],[10,11,...,18,19],...,"
+        "[80,81,...,88,89],[90,91,...,98,99]]"
+    );
+
+    options.threshold = 100;
+    const std::string full = vt::to_string(a, options);
+    CHECK(full.find("...") == std::string::npos);
+    CHECK(vt::to_string(a.view(), options) == full);
+    CHECK(vt::to_string(a.cview(), options) == full);
+}
+
+
+TEST_CASE(
+    "vt::parse_text reads back formatted output",
+    "[ndarray][format]"
+) {
+    vt::ndarray<double, 3> a{{ 2, 3, 4 }};
+    for (std::size_t i = 0; i < a.element_count(); ++i) {
+        a.data()[i] = 1.0 / static_cast<double>(i + 1) - 0.25;
+    }
+
+    const std::string text = vt::to_string(a);
+    CHECK(vt::parse_text<double, 3>(text) == a);
+
+    const vt::ndarray<int, 2> b = vt::parse_text<int, 2>(
+        " [ [1, +2, -3] ,\n [4,5,6] ] "
+    );
+    CHECK(b == vt::ndarray<int, 2>{{ 2, 3 }, { 1, 2, -3, 4, 5, 6 }});
+
+    std::istringstream is{"[[7,8]] [9]"};
+    CHECK(vt::read_text<std::int64_t, 2>(is) ==
+        vt::ndarray<std::int64_t, 2>{{ 1, 2 }, { 7, 8 }});
+    CHECK(vt::read_text<std::int64_t, 1>(is) ==
+        vt::ndarray<std::int64_t, 1>{{ 1 }, { 9 }});
+
+    CHECK(vt::parse_text<float, 2>("[[],[]]").shape() ==
+        std::array<std::size_t, 2>{ 2, 0 });
+}
+
+
+TEST_CASE(
+    "vt::parse_text rejects malformed input",
+    "[ndarray][format]"
+) {
+    CHECK_THROWS_AS(
+        (vt::parse_text<int, 2>("[[1,2],[3]]")), std::invalid_argument
+    );
+    CHECK_THROWS_AS(
+        (vt::parse_text<int, 1>("[1,2")), std::invalid_argument
+    );
+    CHECK_THROWS_AS(
+        (vt::parse_text<int, 1>("[1,x]")), std::invalid_argument
+    );
+    CHECK_THROWS_AS(
+        (vt::parse_text<int, 1>("[1,...,3]")), std::invalid_argument
+    );
+    CHECK_THROWS_AS(
+        (vt::parse_text<int, 1>("[1] 2")), std::invalid_argument
+    );
+    CHECK_THROWS_AS(
+        (vt::parse_text<int, 2>("[1,2]")), std::invalid_argument
+    );
+    CHECK_THROWS_AS(
+        (vt::parse_text<unsigned, 1>("[-1]")), std::invalid_argument
+    );
+}
+
+
+TEST_CASE(
+    "vt::write_binary and vt::read_binary round-trip",
+    "[ndarray][format]"
+) {
+    vt::ndarray<float, 2> a{{ 3, 5 }};
+    std::iota(a.begin(), a.end(), -4.5f);
+
+    std::stringstream ss;
+    vt::write_binary(ss, a, 4096);
+    CHECK(ss.str().size() == 4096 + a.element_count() * sizeof(float));
+    CHECK(ss.str().compare(0, 4, "VTND") == 0);
+
+    CHECK(vt::read_binary<float, 2>(ss) == a);
+
+    std::stringstream wrong;
+    vt::write_binary(wrong, a);
+    CHECK_THROWS_AS((vt::read_binary<double, 2>(wrong)), std::runtime_error);
+
+    std::stringstream truncated{ss.str().substr(0, 4100)};
+    CHECK_THROWS_AS((vt::read_binary<float, 2>(truncated)), std::runtime_error);
+}
+
+
+TEST_CASE(
+    "vt::read_binary rejects corrupt headers",
+    "[ndarray][format]"
+) {
+    const vt::ndarray<std::uint16_t, 2> a{{ 2, 3 }, { 1, 2, 3, 4, 5, 6 }};
+
+    std::stringstream ss;
+    vt::write_binary(ss, a);
+    const std::string valid = ss.str();
+
+    // Little-endian 64-bit value at byte offset pos
+    const auto patch = [&valid](std::size_t pos, std::uint64_t value) {
+        std::string data = valid;
+        for (std::size_t i = 0; i < 8; ++i) {
+            data[pos + i] = static_cast<char>((value >> (8 * i)) & 0xff);
+        }
+        return std::stringstream{data};
+    };
+
+    std::stringstream huge_offset = patch(8, std::uint64_t{1} << 62);
+    CHECK_THROWS_AS(
+        (vt::read_binary<std::uint16_t, 2>(huge_offset)), std::runtime_error
+    );
+
+    std::stringstream short_offset = patch(8, 16);
+    CHECK_THROWS_AS(
+        (vt::read_binary<std::uint16_t, 2>(short_offset)), std::runtime_error
+    );
+
+    std::stringstream huge_shape = patch(24, std::uint64_t{1} << 62);
+    CHECK_THROWS_AS(
+        (vt::read_binary<std::uint16_t, 2>(huge_shape)), std::runtime_error
+    );
+
+    std::stringstream overflowing_shape = patch(16, std::uint64_t{1} << 32);
+    std::string overflowing = overflowing_shape.str();
+    overflowing.replace(24, 8, overflowing.substr(16, 8));
+    std::stringstream both_huge{overflowing};
+    CHECK_THROWS_AS(
+        (vt::read_binary<std::uint16_t, 2>(both_huge)), std::runtime_error
+    );
+
+    std::stringstream intact{valid};
+    CHECK(vt::read_binary<std::uint16_t, 2>(intact) == a);
+}
+
+
+TEST_CASE(
+    "Formatting large arrays with to_chars",
+    "[ndarray][format][!benchmark]"
+) {
+    vt::ndarray<double, 2> a{{ 1000, 1000 }};
+    for (std::size_t i = 0; i < a.element_count(); ++i) {
+        a.data()[i] = static_cast<double>(i) * 0.001;
+    }
+
+    vt::format_options options;
+    options.threshold = a.element_count();
+
+    BENCHMARK("operator<<") {
+        std::ostringstream ss;
+        ss << a;
+        return ss.str().size();
+    };
+
+    BENCHMARK("vt::write_text") {
+        std::ostringstream ss;
+        vt::write_text(ss, a, options);
+        return ss.str().size();
+    };
+
+    BENCHMARK("vt::write_binary") {
+        std::ostringstream ss;
+        vt::write_binary(ss, a);
+        return ss.str().size();
+    };
+}
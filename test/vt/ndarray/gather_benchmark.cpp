@@ -0,0 +1,95 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/gather.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <random>
+#include <string>
+
+
+TEST_CASE("Benchmark gather", "[ndarray][gather][!benchmark]") {
+    const std::size_t src_count = GENERATE(as<std::size_t>{}, 1 << 12, 1 << 24);
+    const std::size_t n = 1 << 20;
+    const std::string suffix = ", source = " + std::to_string(src_count);
+
+    const vt::ndarray<float, 1> src{{ src_count }, 1.0f};
+    vt::ndarray<std::int32_t, 1> indices{{ n }};
+    vt::ndarray<float, 1> dst{{ n }};
+    vt::ndarray<float, 1> bins{{ src_count }, 0.0f};
+
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<std::int32_t> dist{
+        0, static_cast<std::int32_t>(src_count - 1)
+    };
+    for (std::int32_t& idx : indices) {
+        idx = dist(rng);
+    }
+
+    BENCHMARK("Naive loop" + suffix) {
+        for (std::size_t i = 0; i < n; ++i) {
+            dst[i] = src[static_cast<std::size_t>(indices[i])];
+        }
+    };
+
+    BENCHMARK("gather" + suffix) {
+        vt::gather<float, std::int32_t>(src, indices, dst.view());
+    };
+
+    BENCHMARK("scatter add" + suffix) {
+        vt::scatter<float, std::int32_t>(
+            dst, indices, bins.view(), vt::scatter_op::add
+        );
+    };
+}
+
+
+TEST_CASE("Benchmark compress", "[ndarray][gather][!benchmark]") {
+    const double density = GENERATE(0.1, 0.5, 0.9);
+    const std::size_t n = 1 << 20;
+    const std::string suffix = ", density = " + std::to_string(density);
+
+    const vt::ndarray<float, 1> src{{ n }, 1.0f};
+    vt::ndarray<bool, 1> mask{{ n }};
+    vt::ndarray<float, 1> dst{{ n }};
+
+    std::mt19937 rng{42};
+    std::bernoulli_distribution dist{density};
+    for (bool& m : mask) {
+        m = dist(rng);
+    }
+
+    BENCHMARK("Naive loop" + suffix) {
+        std::size_t out = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (mask[i]) {
+                dst[out] = src[i];
+                ++out;
+            }
+        }
+        return out;
+    };
+
+    BENCHMARK("compress" + suffix) {
+        return vt::compress<float>(src, mask, dst.view());
+    };
+}
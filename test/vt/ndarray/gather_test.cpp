@@ -0,0 +1,287 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/gather.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+
+template<typename Index>
+static vt::ndarray<Index, 1> random_indices(
+    std::size_t count,
+    std::size_t bound
+) {
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<std::size_t> dist{0, bound - 1};
+
+    vt::ndarray<Index, 1> indices{{ count }};
+    for (Index& idx : indices) {
+        idx = static_cast<Index>(dist(rng));
+    }
+
+    return indices;
+}
+
+
+static vt::ndarray<bool, 1> random_mask(std::size_t count) {
+    std::mt19937 rng{7};
+    std::bernoulli_distribution dist{0.3};
+
+    vt::ndarray<bool, 1> mask{{ count }};
+    for (bool& m : mask) {
+        m = dist(rng);
+    }
+
+    return mask;
+}
+
+
+template<typename T, typename Index>
+static void check_gather(std::size_t count, std::size_t thread_count) {
+    vt::ndarray<T, 1> src{{ 300 }};
+    std::iota(src.begin(), src.end(), T{1});
+
+    const vt::ndarray<Index, 1> indices = random_indices<Index>(count, 300);
+    vt::ndarray<T, 1> dst{{ count }};
+
+    vt::gather<T, Index>(src, indices, dst.view(), thread_count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        CHECK(dst[i] == Approx(src[static_cast<std::size_t>(indices[i])]));
+    }
+}
+
+
+TEST_CASE(
+    "vt::gather copies the elements at a list of indices",
+    "[ndarray][gather]"
+) {
+    const std::size_t count = GENERATE(as<std::size_t>{}, 0, 5, 37, 1000);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    check_gather<float, std::int32_t>(count, thread_count);
+    check_gather<float, std::uint32_t>(count, thread_count);
+    check_gather<float, std::int64_t>(count, thread_count);
+    check_gather<double, std::int32_t>(count, thread_count);
+    check_gather<std::int64_t, std::size_t>(count, thread_count);
+    check_gather<std::int16_t, std::uint16_t>(count, thread_count);
+}
+
+
+TEST_CASE(
+    "vt::gather copies the sub-arrays at a list of indices",
+    "[ndarray][gather]"
+) {
+    vt::ndarray<int, 3> src{{ 4, 2, 3 }};
+    std::iota(src.begin(), src.end(), 0);
+
+    const vt::ndarray<std::size_t, 1> indices{{ 3 }, { 3, 0, 3 }};
+    vt::ndarray<int, 3> dst{{ 3, 2, 3 }};
+
+    vt::gather<int>(src, indices, dst.view());
+
+    CHECK(std::equal(dst[0].begin(), dst[0].end(), src[3].begin()));
+    CHECK(std::equal(dst[1].begin(), dst[1].end(), src[0].begin()));
+    CHECK(std::equal(dst[2].begin(), dst[2].end(), src[3].begin()));
+}
+
+
+TEST_CASE(
+    "vt::scatter combines the values of duplicate indices",
+    "[ndarray][gather]"
+) {
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 4);
+
+    const vt::ndarray<int, 1> src{{ 5 }, { 1, 2, 3, 4, 5 }};
+    const vt::ndarray<std::size_t, 1> indices{{ 5 }, { 2, 0, 2, 3, 0 }};
+
+    vt::ndarray<int, 1> dst{{ 4 }, 10};
+    vt::scatter<int>(src, indices, dst.view(), vt::scatter_op::assign,
+        thread_count);
+    CHECK(std::vector<int>(dst.begin(), dst.end()) ==
+        std::vector<int>{ 5, 10, 3, 4 });
+
+    std::fill(dst.begin(), dst.end(), 10);
+    vt::scatter<int>(src, indices, dst.view(), vt::scatter_op::add,
+        thread_count);
+    CHECK(std::vector<int>(dst.begin(), dst.end()) ==
+        std::vector<int>{ 17, 10, 14, 14 });
+
+    std::fill(dst.begin(), dst.end(), 3);
+    vt::scatter<int>(src, indices, dst.view(), vt::scatter_op::min,
+        thread_count);
+    CHECK(std::vector<int>(dst.begin(), dst.end()) ==
+        std::vector<int>{ 2, 3, 1, 3 });
+
+    std::fill(dst.begin(), dst.end(), 3);
+    vt::scatter<int>(src, indices, dst.view(), vt::scatter_op::max,
+        thread_count);
+    CHECK(std::vector<int>(dst.begin(), dst.end()) ==
+        std::vector<int>{ 5, 3, 3, 4 });
+}
+
+
+TEST_CASE(
+    "A parallel vt::scatter matches a serial vt::scatter",
+    "[ndarray][gather]"
+) {
+    const vt::scatter_op op = GENERATE(
+        vt::scatter_op::assign, vt::scatter_op::add,
+        vt::scatter_op::min, vt::scatter_op::max
+    );
+    // Fewer destination rows than source rows privatizes the destination;
+    // more destination rows partitions it between the threads.
+    const std::size_t dst_rows = GENERATE(as<std::size_t>{}, 16, 5000);
+
+    const std::size_t n = 2000;
+    vt::ndarray<std::int64_t, 2> src{{ n, 3 }};
+    std::iota(src.begin(), src.end(), std::int64_t{-3000});
+    std::shuffle(src.begin(), src.end(), std::mt19937{1});
+
+    const vt::ndarray<std::uint32_t, 1> indices =
+        random_indices<std::uint32_t>(n, dst_rows);
+
+    vt::ndarray<std::int64_t, 2> serial{{ dst_rows, 3 }, 1};
+    vt::ndarray<std::int64_t, 2> parallel{{ dst_rows, 3 }, 1};
+
+    vt::scatter<std::int64_t, std::uint32_t>(
+        src, indices, serial.view(), op, 1
+    );
+    vt::scatter<std::int64_t, std::uint32_t>(
+        src, indices, parallel.view(), op, 4
+    );
+
+    CHECK(std::equal(serial.begin(), serial.end(), parallel.begin()));
+}
+
+
+TEST_CASE(
+    "vt::take_along_axis picks elements along an axis",
+    "[ndarray][gather]"
+) {
+    const std::size_t axis = GENERATE(as<std::size_t>{}, 0, 1, 2);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    const std::array<std::size_t, 3> src_shape{ 3, 4, 21 };
+    std::array<std::size_t, 3> dst_shape = src_shape;
+    dst_shape[axis] = 7;
+
+    vt::ndarray<double, 3> src{src_shape};
+    std::iota(src.begin(), src.end(), 0.5);
+
+    vt::ndarray<std::int32_t, 3> indices{dst_shape};
+    const vt::ndarray<std::int32_t, 1> random = random_indices<std::int32_t>(
+        indices.element_count(), src_shape[axis]
+    );
+    std::copy(random.begin(), random.end(), indices.begin());
+
+    vt::ndarray<double, 3> dst{dst_shape};
+    vt::take_along_axis<double, std::int32_t>(
+        src, indices, dst.view(), axis, thread_count
+    );
+
+    for (std::size_t i = 0; i < dst_shape[0]; ++i) {
+        for (std::size_t j = 0; j < dst_shape[1]; ++j) {
+            for (std::size_t k = 0; k < dst_shape[2]; ++k) {
+                std::array<std::size_t, 3> idx{ i, j, k };
+                idx[axis] = static_cast<std::size_t>(indices[i][j][k]);
+                CHECK(dst[i][j][k] == Approx(src[idx[0]][idx[1]][idx[2]]));
+            }
+        }
+    }
+}
+
+
+TEST_CASE(
+    "vt::compress keeps the elements where a mask is true",
+    "[ndarray][gather]"
+) {
+    const std::size_t count = GENERATE(as<std::size_t>{}, 0, 7, 100, 1001);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 4);
+
+    const vt::ndarray<bool, 1> mask = random_mask(count);
+    const auto selected = static_cast<std::size_t>(
+        std::count(mask.begin(), mask.end(), true)
+    );
+
+    SECTION("32-bit elements") {
+        vt::ndarray<float, 1> src{{ count }};
+        std::iota(src.begin(), src.end(), 1.0f);
+        vt::ndarray<float, 1> dst{{ count }, -1.0f};
+
+        CHECK(vt::compress<float>(src, mask, dst.view(), thread_count) ==
+            selected);
+
+        std::size_t out = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (mask[i]) {
+                CHECK(dst[out] == Approx(src[i]));
+                ++out;
+            }
+        }
+        for (; out < count; ++out) {
+            CHECK(dst[out] == Approx(-1.0f));
+        }
+    }
+
+    SECTION("64-bit elements") {
+        vt::ndarray<std::int64_t, 1> src{{ count }};
+        std::iota(src.begin(), src.end(), std::int64_t{1});
+        vt::ndarray<std::int64_t, 1> dst{{ selected }};
+
+        CHECK(vt::compress<std::int64_t>(src, mask, dst.view(), thread_count)
+            == selected);
+
+        std::vector<std::int64_t> expected;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (mask[i]) expected.push_back(src[i]);
+        }
+        CHECK(std::vector<std::int64_t>(dst.begin(), dst.end()) == expected);
+    }
+
+    SECTION("Other elements") {
+        using rgb = std::array<std::uint8_t, 3>;
+        vt::ndarray<rgb, 1> src{{ count }};
+        for (std::size_t i = 0; i < count; ++i) {
+            src[i] = {
+                static_cast<std::uint8_t>(i),
+                static_cast<std::uint8_t>(i >> 8),
+                1
+            };
+        }
+        vt::ndarray<rgb, 1> dst{{ selected }};
+
+        CHECK(vt::compress<rgb>(src, mask, dst.view(), thread_count) ==
+            selected);
+
+        std::vector<rgb> expected;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (mask[i]) expected.push_back(src[i]);
+        }
+        CHECK(std::vector<rgb>(dst.begin(), dst.end()) == expected);
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/histogram.hpp>
+
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+
+TEST_CASE("Benchmark histogram", "[ndarray][histogram][!benchmark]") {
+    const std::size_t bin_count = GENERATE(as<std::size_t>{}, 256, 1 << 16);
+    const bool skewed = GENERATE(false, true);
+    const std::size_t n = 1 << 22;
+    const std::string suffix = ", bins = " + std::to_string(bin_count) +
+        (skewed ? ", skewed" : ", uniform");
+
+    vt::ndarray<float, 1> data{{ n }};
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<float> uniform{0.0f, 1.0f};
+    std::normal_distribution<float> normal{0.5f, 0.01f};
+    for (float& v : data) {
+        v = skewed ? normal(rng) : uniform(rng);
+    }
+
+    const vt::histogram_bins<float> bins{bin_count, 0.0f, 1.0f};
+    const float scale = static_cast<float>(bin_count);
+
+    BENCHMARK("Naive loop" + suffix) {
+        std::vector<std::size_t> counts(bin_count, 0);
+        for (float v : data) {
+            if (v >= 0.0f && v <= 1.0f) {
+                const auto bin = static_cast<std::size_t>(v * scale);
+                ++counts[std::min(bin, bin_count - 1)];
+            }
+        }
+        return counts;
+    };
+
+    BENCHMARK("histogram" + suffix) {
+        return vt::histogram(data.cview(), bins);
+    };
+}
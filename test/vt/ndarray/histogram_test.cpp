@@ -0,0 +1,264 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/histogram.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+static vt::ndarray<float, 1> random_values(
+    std::size_t count,
+    float low,
+    float high
+) {
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<float> dist{low, high};
+
+    vt::ndarray<float, 1> values{{ count }};
+    for (float& v : values) {
+        v = dist(rng);
+    }
+
+    return values;
+}
+
+
+static std::vector<std::size_t> naive_histogram(
+    const vt::ndarray<float, 1>& values,
+    const vt::histogram_bins<float>& bins
+) {
+    std::vector<std::size_t> counts(bins.bin_count(), 0);
+    for (float v : values) {
+        const std::size_t b = bins.bin(v);
+        if (b < bins.bin_count()) ++counts[b];
+    }
+
+    return counts;
+}
+
+
+TEST_CASE(
+    "vt::histogram_bins find the bin of a value",
+    "[ndarray][histogram]"
+) {
+    SECTION("uniform") {
+        const vt::histogram_bins<float> bins{4, 0.0f, 2.0f};
+
+        CHECK(bins.bin_count() == 4);
+        CHECK(bins.is_uniform());
+        CHECK(bins.edges()[1] == Approx(0.5f));
+        CHECK(bins.edges()[4] == Approx(2.0f));
+
+        CHECK(bins.bin(0.0f) == 0);
+        CHECK(bins.bin(0.49f) == 0);
+        CHECK(bins.bin(0.5f) == 1);
+        CHECK(bins.bin(1.99f) == 3);
+        CHECK(bins.bin(2.0f) == 3);
+        CHECK(bins.bin(-0.01f) == 4);
+        CHECK(bins.bin(2.01f) == 4);
+        CHECK(bins.bin(std::numeric_limits<float>::quiet_NaN()) == 4);
+    }
+
+    SECTION("edges") {
+        const vt::ndarray<int, 1> edges{{ 4 }, { -5, 0, 10, 100 }};
+        const vt::histogram_bins<int> bins{edges};
+
+        CHECK(bins.bin_count() == 3);
+        CHECK(!bins.is_uniform());
+
+        CHECK(bins.bin(-6) == 3);
+        CHECK(bins.bin(-5) == 0);
+        CHECK(bins.bin(-1) == 0);
+        CHECK(bins.bin(0) == 1);
+        CHECK(bins.bin(99) == 2);
+        CHECK(bins.bin(100) == 2);
+        CHECK(bins.bin(101) == 3);
+    }
+
+    SECTION("integer") {
+        CHECK(vt::histogram_bins<int>{5, 0, 10}.is_uniform());
+
+        const vt::histogram_bins<int> bins{3, 0, 10};
+        CHECK(!bins.is_uniform());
+        for (int v = 0; v <= 10; ++v) {
+            const std::size_t b = bins.bin(v);
+            CHECK(bins.edges()[b] <= v);
+            CHECK((v < bins.edges()[b + 1] || v == 10));
+        }
+    }
+}
+
+
+TEST_CASE(
+    "Uniform vt::histogram_bins put every edge in its own bin",
+    "[ndarray][histogram]"
+) {
+    const std::array<std::array<double, 2>, 4> ranges{{
+        { 0.0, 1.3 }, { -1.0, 1.0 }, { 0.1, 0.7 }, { 1000.0, 1007.3 }
+    }};
+
+    std::size_t mismatches = 0;
+    for (const std::array<double, 2>& range : ranges) {
+        for (std::size_t bin_count = 1; bin_count < 200; ++bin_count) {
+            const vt::histogram_bins<double> bins{
+                bin_count, range[0], range[1]
+            };
+            for (std::size_t i = 0; i < bin_count; ++i) {
+                mismatches += bins.bin(bins.edges()[i]) != i;
+            }
+            mismatches += bins.bin(bins.edges()[bin_count]) != bin_count - 1;
+        }
+    }
+    CHECK(mismatches == 0);
+
+    // A uniform histogram counts the same as a search of the same edges
+    const vt::histogram_bins<float> uniform{3, 0.0f, 1.3f};
+    const vt::histogram_bins<float> searched{uniform.edges()};
+    REQUIRE(!searched.is_uniform());
+
+    vt::ndarray<float, 1> values = random_values(1000, -0.1f, 1.4f);
+    std::copy(uniform.edges().begin(), uniform.edges().end(), values.begin());
+    const vt::ndarray<std::size_t, 1> uniform_counts =
+        vt::histogram(values.cview(), uniform);
+    const vt::ndarray<std::size_t, 1> searched_counts =
+        vt::histogram(values.cview(), searched);
+    CHECK(uniform_counts == searched_counts);
+}
+
+
+TEST_CASE(
+    "vt::histogram counts the values in each bin",
+    "[ndarray][histogram]"
+) {
+    const std::size_t count = GENERATE(as<std::size_t>{}, 0, 7, 1000, 5000);
+    const std::size_t bin_count = GENERATE(as<std::size_t>{}, 1, 10, 20000);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    const vt::ndarray<float, 1> values = random_values(count, -1.0f, 11.0f);
+
+    const vt::histogram_bins<float> uniform{bin_count, 0.0f, 10.0f};
+    const vt::ndarray<std::size_t, 1> counts =
+        vt::histogram(values.cview(), uniform, thread_count);
+    CHECK(std::vector<std::size_t>(counts.begin(), counts.end()) ==
+        naive_histogram(values, uniform));
+
+    vt::ndarray<float, 1> edges{{ bin_count + 1 }};
+    for (std::size_t i = 0; i <= bin_count; ++i) {
+        edges[i] = 10.0f * std::sqrt(
+            static_cast<float>(i) / static_cast<float>(bin_count)
+        );
+    }
+    const vt::histogram_bins<float> custom{edges.cview()};
+    const vt::ndarray<std::size_t, 1> custom_counts =
+        vt::histogram(values.cview(), custom, thread_count);
+    CHECK(
+        std::vector<std::size_t>(custom_counts.begin(), custom_counts.end()) ==
+            naive_histogram(values, custom)
+    );
+}
+
+
+TEST_CASE(
+    "vt::histogram counts the values of multi-dimensional data",
+    "[ndarray][histogram]"
+) {
+    const vt::ndarray<double, 2> data{{ 2, 3 }, {
+        0.5, 1.5, 1.5,
+        2.0, -1.0, std::numeric_limits<double>::quiet_NaN()
+    }};
+    const vt::histogram_bins<double> bins{2, 0.0, 2.0};
+
+    const vt::ndarray<std::size_t, 1> counts =
+        vt::histogram(data.cview(), bins);
+
+    CHECK(counts[0] == 1);
+    CHECK(counts[1] == 3);
+}
+
+
+TEST_CASE(
+    "vt::histogram adds up the weights of the values in each bin",
+    "[ndarray][histogram]"
+) {
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    const vt::ndarray<int, 1> data{{ 6 }, { 0, 1, 1, 5, 9, 3 }};
+    const vt::ndarray<std::int64_t, 1> weights{{ 6 }, { 1, 2, 4, 8, 16, 32 }};
+    const vt::histogram_bins<int> bins{2, 0, 4};
+
+    const vt::ndarray<std::int64_t, 1> sums =
+        vt::histogram(data.cview(), weights.cview(), bins, thread_count);
+
+    REQUIRE(sums.shape(0) == 2);
+    CHECK(sums[0] == 7);
+    CHECK(sums[1] == 32);
+}
+
+
+TEST_CASE(
+    "vt::histogram2d counts pairs of values in each bin",
+    "[ndarray][histogram]"
+) {
+    const std::size_t count = GENERATE(as<std::size_t>{}, 0, 1000);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    const vt::ndarray<float, 1> x = random_values(count, -1.0f, 11.0f);
+    vt::ndarray<float, 1> y = random_values(count, 0.0f, 5.0f);
+    std::reverse(y.begin(), y.end());
+    vt::ndarray<std::int32_t, 1> weights{{ count }};
+    for (std::size_t i = 0; i < count; ++i) {
+        weights[i] = static_cast<std::int32_t>(i % 7);
+    }
+
+    const vt::histogram_bins<float> x_bins{6, 0.0f, 10.0f};
+    const vt::histogram_bins<float> y_bins{4, 1.0f, 5.0f};
+
+    const vt::ndarray<std::size_t, 2> counts =
+        vt::histogram2d(x.cview(), y.cview(), x_bins, y_bins, thread_count);
+    const vt::ndarray<std::int32_t, 2> sums = vt::histogram2d(
+        x.cview(), y.cview(), weights.cview(), x_bins, y_bins, thread_count
+    );
+
+    std::vector<std::size_t> expected_counts(24, 0);
+    std::vector<std::int32_t> expected_sums(24, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t bx = x_bins.bin(x[i]);
+        const std::size_t by = y_bins.bin(y[i]);
+        if (bx < 6 && by < 4) {
+            ++expected_counts[bx * 4 + by];
+            expected_sums[bx * 4 + by] += weights[i];
+        }
+    }
+
+    REQUIRE(counts.shape() == std::array<std::size_t, 2>{ 6, 4 });
+    REQUIRE(sums.shape() == std::array<std::size_t, 2>{ 6, 4 });
+    CHECK(std::vector<std::size_t>(counts.begin(), counts.end()) ==
+        expected_counts);
+    CHECK(std::vector<std::int32_t>(sums.begin(), sums.end()) ==
+        expected_sums);
+}
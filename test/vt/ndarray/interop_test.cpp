@@ -0,0 +1,263 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/interop.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+
+// A tensor owned by another framework, which counts its deleter calls
+struct foreign_tensor {
+    std::array<float, 12> data{};
+    std::array<std::int64_t, 2> shape{{ 3, 4 }};
+    std::array<std::int64_t, 2> strides{{ 4, 1 }};
+    DLManagedTensor managed{};
+    int deleted = 0;
+
+    foreign_tensor() {
+        std::iota(data.begin(), data.end(), 0.0f);
+
+        DLTensor& tensor = managed.dl_tensor;
+        tensor.data = data.data();
+        tensor.device = { kDLCPU, 0 };
+        tensor.ndim = 2;
+        tensor.dtype = { static_cast<std::uint8_t>(kDLFloat), 32, 1 };
+        tensor.shape = shape.data();
+        tensor.strides = strides.data();
+        tensor.byte_offset = 0;
+
+        managed.manager_ctx = this;
+        managed.deleter = [](DLManagedTensor* self) {
+            ++static_cast<foreign_tensor*>(self->manager_ctx)->deleted;
+        };
+    }
+};
+
+
+TEST_CASE(
+    "vt::to_dlpack exports an array without copying",
+    "[ndarray][interop]"
+) {
+    vt::ndarray<std::int16_t, 3> a{{ 2, 3, 4 }};
+    std::iota(a.begin(), a.end(), std::int16_t{0});
+    const std::int16_t* data = a.data();
+
+    DLManagedTensor* managed = vt::to_dlpack(std::move(a));
+    const DLTensor& tensor = managed->dl_tensor;
+
+    CHECK(tensor.data == data);
+    CHECK(tensor.device.device_type == kDLCPU);
+    CHECK(tensor.ndim == 3);
+    CHECK(tensor.dtype.code == kDLInt);
+    CHECK(tensor.dtype.bits == 16);
+    CHECK(tensor.dtype.lanes == 1);
+    CHECK(tensor.shape[0] == 2);
+    CHECK(tensor.shape[2] == 4);
+    CHECK(tensor.strides[0] == 12);
+    CHECK(tensor.strides[1] == 4);
+    CHECK(tensor.strides[2] == 1);
+    CHECK(tensor.byte_offset == 0);
+
+    // Importing the tensor takes over ownership without copying
+    vt::dlpack_tensor<std::int16_t, 3> imported{managed};
+    CHECK(imported.shape() == std::array<std::size_t, 3>{ 2, 3, 4 });
+    CHECK(imported.view().data() == data);
+    CHECK(imported.view()[1][2][3] == 23);
+
+    vt::dlpack_tensor<std::int16_t, 3> moved{std::move(imported)};
+    CHECK(moved.view()[0][0][1] == 1);
+}
+
+
+TEST_CASE(
+    "vt::to_dlpack maps element types to DLPack data types",
+    "[ndarray][interop]"
+) {
+    const auto dtype_of = [](auto&& array) {
+        DLManagedTensor* managed = vt::to_dlpack(std::move(array));
+        const DLDataType dtype = managed->dl_tensor.dtype;
+        managed->deleter(managed);
+        return std::make_pair(
+            static_cast<int>(dtype.code), static_cast<int>(dtype.bits)
+        );
+    };
+
+    CHECK(dtype_of(vt::ndarray<bool, 1>{{ 1 }}) ==
+        std::make_pair(static_cast<int>(kDLBool), 8));
+    CHECK(dtype_of(vt::ndarray<std::uint64_t, 1>{{ 1 }}) ==
+        std::make_pair(static_cast<int>(kDLUInt), 64));
+    CHECK(dtype_of(vt::ndarray<double, 1>{{ 1 }}) ==
+        std::make_pair(static_cast<int>(kDLFloat), 64));
+    CHECK(dtype_of(vt::ndarray<vt::half, 1>{{ 1 }}) ==
+        std::make_pair(static_cast<int>(kDLFloat), 16));
+    CHECK(dtype_of(vt::ndarray<vt::bfloat16, 1>{{ 1 }}) ==
+        std::make_pair(static_cast<int>(kDLBfloat), 16));
+    CHECK(dtype_of(vt::ndarray<std::complex<float>, 1>{{ 1 }}) ==
+        std::make_pair(static_cast<int>(kDLComplex), 64));
+}
+
+
+TEST_CASE(
+    "A vt::dlpack_tensor can import a foreign DLPack tensor",
+    "[ndarray][interop]"
+) {
+    foreign_tensor foreign;
+
+    SECTION("row-major tensor") {
+        {
+            vt::dlpack_tensor<float, 2> tensor{&foreign.managed};
+            CHECK(tensor.view().data() == foreign.data.data());
+            CHECK(tensor.view()[2][1] == Approx(9.0f));
+        }
+        CHECK(foreign.deleted == 1);
+    }
+
+    SECTION("byte offset and missing strides") {
+        foreign.managed.dl_tensor.byte_offset = 4 * sizeof(float);
+        foreign.managed.dl_tensor.strides = nullptr;
+        foreign.shape = {{ 2, 4 }};
+
+        vt::dlpack_tensor<float, 2> tensor{&foreign.managed};
+        CHECK(tensor.view()[0][0] == Approx(4.0f));
+        CHECK(tensor.view()[1][3] == Approx(11.0f));
+
+        DLManagedTensor* released = tensor.release();
+        CHECK(released == &foreign.managed);
+    }
+
+    SECTION("mismatch") {
+        SECTION("element type") {
+            foreign.managed.dl_tensor.dtype.bits = 64;
+        }
+        SECTION("device") {
+            foreign.managed.dl_tensor.device.device_type = kDLCUDA;
+        }
+        SECTION("strides") {
+            foreign.strides = {{ 1, 3 }};
+        }
+
+        CHECK_THROWS_AS(
+            (vt::dlpack_tensor<float, 2>{&foreign.managed}),
+            std::invalid_argument
+        );
+        CHECK(foreign.deleted == 1);
+    }
+
+    SECTION("unit extents and empty tensors ignore strides") {
+        foreign.shape = {{ 1, 4 }};
+        foreign.strides = {{ 100, 1 }};
+        CHECK_NOTHROW(vt::dlpack_tensor<float, 2>{&foreign.managed});
+
+        foreign.shape = {{ 0, 4 }};
+        foreign.strides = {{ 3, 7 }};
+        CHECK_NOTHROW(vt::dlpack_tensor<float, 2>{&foreign.managed});
+        CHECK(foreign.deleted == 2);
+    }
+}
+
+
+TEST_CASE(
+    "vt::to_buffer and vt::from_buffer follow the buffer protocol",
+    "[ndarray][interop]"
+) {
+    vt::ndarray<std::int32_t, 2> a{{ 2, 3 }};
+    std::iota(a.begin(), a.end(), 0);
+
+    const vt::buffer_info<2> info = vt::to_buffer(a.view());
+    CHECK(info.buf == a.data());
+    CHECK(info.len == 24);
+    CHECK(info.itemsize == 4);
+    CHECK(!info.readonly);
+    CHECK(info.ndim == 2);
+    CHECK(std::string{info.format} == "i");
+    CHECK(info.shape == std::array<std::ptrdiff_t, 2>{ 2, 3 });
+    CHECK(info.strides == std::array<std::ptrdiff_t, 2>{ 12, 4 });
+
+    CHECK(vt::to_buffer(a.cview()).readonly);
+    CHECK(std::string{vt::to_buffer(vt::ndarray<double, 1>{{ 1 }}.view())
+        .format} == "d");
+    CHECK(std::string{vt::to_buffer(vt::ndarray<std::uint8_t, 1>{{ 1 }}
+        .view()).format} == "B");
+
+    const vt::ndview<std::int32_t, 2> view =
+        vt::from_buffer<std::int32_t>(info);
+    CHECK(view.data() == a.data());
+    CHECK(view.shape() == a.shape());
+
+    SECTION("formats with native and standard sizes") {
+        vt::buffer_info<2> other = info;
+        for (const char* format : { "@i", "=i", "<i", "=l" }) {
+            other.format = format;
+            CHECK_NOTHROW(vt::from_buffer<std::int32_t>(other));
+        }
+        for (const char* format : { ">i", "I", "f", "q", "ii" }) {
+            other.format = format;
+            CHECK_THROWS_AS(
+                vt::from_buffer<std::int32_t>(other), std::invalid_argument
+            );
+        }
+    }
+
+    SECTION("read-only buffers only convert to const views") {
+        const vt::buffer_info<2> readonly = vt::to_buffer(a.cview());
+        CHECK_NOTHROW(vt::from_buffer<const std::int32_t>(readonly));
+        CHECK_THROWS_AS(
+            vt::from_buffer<std::int32_t>(readonly), std::invalid_argument
+        );
+    }
+
+    SECTION("non-contiguous buffers are rejected") {
+        vt::buffer_info<2> transposed = info;
+        transposed.shape = {{ 3, 2 }};
+        transposed.strides = {{ 4, 12 }};
+        CHECK_THROWS_AS(
+            vt::from_buffer<std::int32_t>(transposed), std::invalid_argument
+        );
+    }
+}
+
+
+#if defined(__cpp_lib_mdspan)
+
+TEST_CASE(
+    "vt::to_mdspan and vt::from_mdspan convert between views and mdspans",
+    "[ndarray][interop]"
+) {
+    vt::ndarray<float, 2> a{{ 2, 3 }};
+    std::iota(a.begin(), a.end(), 0.0f);
+
+    const auto span = vt::to_mdspan(a.view());
+    CHECK(span.extent(0) == 2);
+    CHECK(span.extent(1) == 3);
+    CHECK(span[1, 2] == 5.0f);
+
+    const vt::ndview<float, 2> view = vt::from_mdspan(span);
+    CHECK(view.data() == a.data());
+    CHECK(view.shape() == a.shape());
+}
+
+#endif
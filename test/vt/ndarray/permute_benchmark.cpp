@@ -0,0 +1,78 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/permute.hpp>
+
+#include <catch2/catch.hpp>
+#include <string>
+
+
+TEST_CASE("Benchmark matrix transpose", "[ndarray][permute][!benchmark]") {
+    const std::size_t n = GENERATE(as<std::size_t>{}, 512, 2048);
+    const std::string suffix = ", n = " + std::to_string(n);
+
+    vt::ndarray<float, 2> a{{ n, n }, 1.0f};
+    vt::ndarray<float, 2> b{{ n, n }};
+
+    BENCHMARK("Naive loop" + suffix) {
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                b[j][i] = a[i][j];
+            }
+        }
+    };
+
+    BENCHMARK("permute_copy" + suffix) {
+        vt::permute_copy<float>(a, b.view(), { 1, 0 });
+    };
+
+    BENCHMARK("In place" + suffix) {
+        vt::transpose(a.view());
+    };
+}
+
+
+TEST_CASE("Benchmark NCHW to NHWC", "[ndarray][permute][!benchmark]") {
+    const std::size_t batch = 8;
+    const std::size_t channels = GENERATE(as<std::size_t>{}, 3, 64);
+    const std::size_t height = 128;
+    const std::size_t width = 128;
+    const std::string suffix = ", channels = " + std::to_string(channels);
+
+    const vt::ndarray<float, 4> a{{ batch, channels, height, width }, 1.0f};
+    vt::ndarray<float, 4> b{{ batch, height, width, channels }};
+
+    BENCHMARK("Naive loop" + suffix) {
+        for (std::size_t n = 0; n < batch; ++n) {
+            for (std::size_t c = 0; c < channels; ++c) {
+                for (std::size_t h = 0; h < height; ++h) {
+                    for (std::size_t w = 0; w < width; ++w) {
+                        b[n][h][w][c] = a[n][c][h][w];
+                    }
+                }
+            }
+        }
+    };
+
+    BENCHMARK("permute_copy" + suffix) {
+        vt::permute_copy<float>(a, b.view(), { 0, 2, 3, 1 });
+    };
+}
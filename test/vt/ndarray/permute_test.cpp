@@ -0,0 +1,171 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/permute.hpp>
+#include <vt/ndarray/container.hpp>
+
+#include <catch2/catch.hpp>
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+// Element-by-element reference: dst[i...] = src[j...] with j[axes[k]] = i[k]
+template<typename T, std::size_t N>
+static std::vector<T> naive_permute(
+    const vt::ndarray<T, N>& src,
+    const std::array<std::size_t, N>& axes
+) {
+    std::array<std::size_t, N> src_strides;
+    std::size_t stride = 1;
+    for (std::size_t i = N; i-- > 0;) {
+        src_strides[i] = stride;
+        stride *= src.shape(i);
+    }
+
+    std::vector<T> dst;
+    std::array<std::size_t, N> index{};
+    for (std::size_t n = 0; n < src.element_count(); ++n) {
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            offset += index[i] * src_strides[axes[i]];
+        }
+        dst.push_back(src.data()[offset]);
+
+        for (std::size_t i = N; i-- > 0;) {
+            if (++index[i] < src.shape(axes[i])) break;
+            index[i] = 0;
+        }
+    }
+
+    return dst;
+}
+
+
+template<typename T, std::size_t N>
+static vt::ndarray<T, N> iota_array(const std::array<std::size_t, N>& shape) {
+    vt::ndarray<T, N> a{shape};
+    std::size_t i = 0;
+    for (T& x : a) x = static_cast<T>(i++);
+
+    return a;
+}
+
+
+template<typename T, std::size_t N>
+static void check_permute(
+    const std::array<std::size_t, N>& shape,
+    const std::array<std::size_t, N>& axes
+) {
+    const vt::ndarray<T, N> src = iota_array<T>(shape);
+
+    std::array<std::size_t, N> dst_shape;
+    for (std::size_t i = 0; i < N; ++i) dst_shape[i] = shape[axes[i]];
+    vt::ndarray<T, N> dst{dst_shape};
+
+    vt::permute_copy<T>(src, dst.view(), axes);
+
+    const std::vector<T> expected = naive_permute(src, axes);
+    CHECK(std::equal(dst.begin(), dst.end(), expected.begin()));
+}
+
+
+TEMPLATE_TEST_CASE(
+    "vt::permute_copy transposes matrices",
+    "[ndarray][permute]",
+    std::uint8_t, std::int16_t, float, double, std::complex<double>
+) {
+    const std::size_t rows = GENERATE(as<std::size_t>{}, 1, 3, 8, 17, 64, 100);
+    const std::size_t cols = GENERATE(as<std::size_t>{}, 1, 4, 9, 33, 130);
+
+    check_permute<TestType, 2>({ rows, cols }, { 1, 0 });
+    check_permute<TestType, 2>({ rows, cols }, { 0, 1 });
+}
+
+
+TEMPLATE_TEST_CASE(
+    "vt::permute_copy permutes arbitrary axes",
+    "[ndarray][permute]",
+    std::int32_t, double
+) {
+    SECTION("NCHW to NHWC and back") {
+        check_permute<TestType, 4>({ 2, 3, 20, 21 }, { 0, 2, 3, 1 });
+        check_permute<TestType, 4>({ 2, 20, 21, 3 }, { 0, 3, 1, 2 });
+        check_permute<TestType, 4>({ 2, 16, 24, 40 }, { 0, 2, 3, 1 });
+    }
+
+    SECTION("all permutations of three axes") {
+        std::array<std::size_t, 3> axes{{ 0, 1, 2 }};
+        do {
+            check_permute<TestType, 3>({ 7, 12, 19 }, axes);
+            check_permute<TestType, 3>({ 1, 12, 19 }, axes);
+            check_permute<TestType, 3>({ 7, 12, 1 }, axes);
+        } while (std::next_permutation(axes.begin(), axes.end()));
+    }
+
+    SECTION("five axes") {
+        check_permute<TestType, 5>({ 3, 4, 5, 6, 7 }, { 4, 2, 0, 3, 1 });
+        check_permute<TestType, 5>({ 3, 4, 5, 6, 7 }, { 1, 2, 0, 3, 4 });
+    }
+
+    SECTION("empty and single element") {
+        check_permute<TestType, 3>({ 4, 0, 5 }, { 2, 0, 1 });
+        check_permute<TestType, 3>({ 1, 1, 1 }, { 2, 0, 1 });
+    }
+}
+
+
+TEST_CASE(
+    "vt::permute_copy copies elements that are not trivially copyable",
+    "[ndarray][permute]"
+) {
+    vt::ndarray<std::string, 2> src{{ 9, 10 }};
+    for (std::size_t i = 0; i < 9; ++i) {
+        for (std::size_t j = 0; j < 10; ++j) {
+            src[i][j] = std::to_string(i) + "," + std::to_string(j);
+        }
+    }
+
+    vt::ndarray<std::string, 2> dst{{ 10, 9 }};
+    vt::permute_copy<std::string>(src, dst.view(), { 1, 0 });
+
+    CHECK(dst[7][2] == "2,7");
+    CHECK(dst[9][8] == "8,9");
+}
+
+
+TEMPLATE_TEST_CASE(
+    "vt::transpose transposes square matrices in place",
+    "[ndarray][permute]",
+    std::uint8_t, float, double, std::complex<double>
+) {
+    const std::size_t n = GENERATE(as<std::size_t>{},
+        0, 1, 2, 5, 8, 15, 16, 31, 64, 67, 130
+    );
+
+    vt::ndarray<TestType, 2> a = iota_array<TestType, 2>({ n, n });
+    const std::vector<TestType> expected = naive_permute(a, { 1, 0 });
+
+    vt::transpose(a.view());
+
+    CHECK(std::equal(a.begin(), a.end(), expected.begin()));
+}
@@ -0,0 +1,224 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/pipeline.hpp>
+
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+TEST_CASE(
+    "A vt::ndarray_pool recycles arrays by shape",
+    "[ndarray][pipeline]"
+) {
+    vt::ndarray_pool<float, 2> pool{2};
+
+    const float* data;
+    {
+        vt::pooled_ndarray<float, 2> a = pool.acquire({{ 3, 4 }});
+        CHECK(a);
+        CHECK(a.shape() == std::array<std::size_t, 2>{{ 3, 4 }});
+        data = a.view().data();
+    }
+    CHECK(pool.idle_count() == 1);
+    CHECK(pool.allocation_count() == 1);
+
+    SECTION("an array of the same shape is reused") {
+        vt::pooled_ndarray<float, 2> b = pool.acquire({{ 3, 4 }});
+        CHECK(b.view().data() == data);
+        CHECK(pool.idle_count() == 0);
+        CHECK(pool.allocation_count() == 1);
+    }
+
+    SECTION("other shapes are allocated separately") {
+        vt::pooled_ndarray<float, 2> b = pool.acquire({{ 4, 3 }});
+        CHECK(pool.idle_count() == 1);
+        CHECK(pool.allocation_count() == 2);
+    }
+
+    SECTION("at most capacity arrays are kept per shape") {
+        {
+            vt::pooled_ndarray<float, 2> b = pool.acquire({{ 3, 4 }});
+            vt::pooled_ndarray<float, 2> c = pool.acquire({{ 3, 4 }});
+            vt::pooled_ndarray<float, 2> d = pool.acquire({{ 3, 4 }});
+            CHECK(pool.allocation_count() == 3);
+        }
+        CHECK(pool.idle_count() == 2);
+
+        pool.clear();
+        CHECK(pool.idle_count() == 0);
+    }
+
+    SECTION("reset hands the array back") {
+        vt::pooled_ndarray<float, 2> b = pool.acquire({{ 3, 4 }});
+        b.reset();
+        CHECK(!b);
+        CHECK(pool.idle_count() == 1);
+    }
+}
+
+
+TEST_CASE(
+    "A vt::pipeline runs frames through all stages in order",
+    "[ndarray][pipeline]"
+) {
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 4);
+    const std::size_t frame_count = 200;
+
+    vt::ndarray_pool<int, 2> pool{8};
+    vt::pipeline<int, 2> pipeline{pool, 2, thread_count};
+
+    std::vector<int> results;
+    pipeline
+        .add_stage("scale", {{ 4, 8 }}, [](auto in, auto out) {
+            for (std::size_t i = 0; i < in.element_count(); ++i) {
+                out.data()[i] = 2 * in.data()[i];
+            }
+        })
+        .add_stage("offset", {{ 4, 8 }}, [](auto in, auto out) {
+            for (std::size_t i = 0; i < in.element_count(); ++i) {
+                out.data()[i] = in.data()[i] + 1;
+            }
+        })
+        .add_stage("sum", {{ 1, 1 }}, [](auto in, auto out) {
+            int sum = 0;
+            for (int x : in) sum += x;
+            out[0][0] = sum;
+        })
+        .set_sink([&results](auto result) {
+            results.push_back(result[0][0]);
+        });
+
+    vt::ndarray<int, 2> frame{{ 4, 8 }};
+    for (std::size_t n = 0; n < frame_count; ++n) {
+        for (int& x : frame) x = static_cast<int>(n);
+        pipeline.push(frame);
+    }
+    pipeline.finish();
+
+    REQUIRE(results.size() == frame_count);
+    for (std::size_t n = 0; n < frame_count; ++n) {
+        CHECK(results[n] == 32 * (2 * static_cast<int>(n) + 1));
+    }
+
+    // Buffers in use are bounded by the queues, not by the number of frames:
+    // per stage a full queue, the frame being processed, its result and the
+    // result of the previous frame that is about to be handed back
+    CHECK(pool.allocation_count() <= 3 * (2 + 3) + 1);
+
+    const std::vector<vt::pipeline_stage_stats> stats = pipeline.stats();
+    REQUIRE(stats.size() == 3);
+    CHECK(stats[0].name == "scale");
+    CHECK(stats[2].name == "sum");
+    for (const vt::pipeline_stage_stats& s : stats) {
+        CHECK(s.frame_count == frame_count);
+        CHECK(s.min_time <= s.mean_time());
+        CHECK(s.mean_time() <= s.max_time);
+    }
+}
+
+
+TEST_CASE(
+    "A vt::pipeline holds back the producer",
+    "[ndarray][pipeline]"
+) {
+    vt::ndarray_pool<int, 1> pool{8};
+    vt::pipeline<int, 1> pipeline{pool, 1, 2};
+
+    std::atomic<std::size_t> processed{0};
+    pipeline.add_stage("slow", {{ 1 }}, [&processed](auto in, auto out) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        out[0] = in[0];
+        ++processed;
+    });
+
+    // With a queue of one frame, the producer can be at most two frames
+    // ahead of the stage
+    const vt::ndarray<int, 1> frame{{ 1 }, 0};
+    for (std::size_t n = 0; n < 20; ++n) {
+        pipeline.push(frame);
+        CHECK(n + 1 - processed <= 2);
+    }
+    pipeline.finish();
+
+    CHECK(processed == 20);
+    CHECK(pool.allocation_count() <= 4);
+}
+
+
+TEST_CASE(
+    "A vt::pipeline reports stage errors from finish",
+    "[ndarray][pipeline]"
+) {
+    vt::ndarray_pool<int, 1> pool{4};
+    vt::pipeline<int, 1> pipeline{pool, 2, 2};
+
+    std::atomic<std::size_t> sunk{0};
+    pipeline
+        .add_stage("check", {{ 1 }}, [](auto in, auto out) {
+            if (in[0] == 3) throw std::runtime_error{"bad frame"};
+            out[0] = in[0];
+        })
+        .set_sink([&sunk](auto) { ++sunk; });
+
+    vt::ndarray<int, 1> frame{{ 1 }};
+    for (int n = 0; n < 3; ++n) {
+        frame[0] = n;
+        pipeline.push(frame);
+    }
+    pipeline.finish();
+    CHECK(sunk == 3);
+
+    frame[0] = 3;
+    pipeline.push(frame);
+    CHECK_THROWS_AS(pipeline.finish(), std::runtime_error);
+
+    // The pipeline can be used again once the error has been reported
+    frame[0] = 4;
+    pipeline.push(frame);
+    CHECK_NOTHROW(pipeline.finish());
+    CHECK(sunk == 4);
+}
+
+
+TEST_CASE(
+    "A vt::pipeline accepts pooled frames without copying",
+    "[ndarray][pipeline]"
+) {
+    vt::ndarray_pool<double, 1> pool{4};
+    vt::pipeline<double, 1> pipeline{pool, 2, 1};
+
+    const double* seen = nullptr;
+    pipeline.add_stage("identity", {{ 3 }}, [&seen](auto in, auto out) {
+        seen = in.data();
+        std::copy(in.begin(), in.end(), out.begin());
+    });
+
+    vt::pooled_ndarray<double, 1> frame = pool.acquire({{ 3 }});
+    const double* data = frame.view().data();
+    pipeline.push(std::move(frame));
+    pipeline.finish();
+
+    CHECK(seen == data);
+}
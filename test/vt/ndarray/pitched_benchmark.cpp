@@ -0,0 +1,83 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/pitched.hpp>
+
+#include <catch2/catch.hpp>
+#include <string>
+
+
+// Naive matrix product whose inner loop walks down a column of `b`, which
+// with a power-of-two row length keeps hitting the same cache sets
+template<typename A, typename B, typename C>
+static void naive_matmul(const A& a, const B& b, C& c, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            float sum = 0.0f;
+            for (std::size_t k = 0; k < n; ++k) {
+                sum += a[i][k] * b[k][j];
+            }
+            c[i][j] = sum;
+        }
+    }
+}
+
+
+TEST_CASE("Benchmark dense vs pitched rows", "[ndarray][pitched][!benchmark]") {
+    const std::size_t n = GENERATE(as<std::size_t>{}, 512, 1024);
+    const std::string suffix = ", n = " + std::to_string(n);
+
+    const vt::ndarray<float, 2> dense_a{{ n, n }, 1.0f};
+    const vt::ndarray<float, 2> dense_b{{ n, n }, 1.0f};
+    vt::ndarray<float, 2> dense_c{{ n, n }};
+
+    const vt::pitched_ndarray<float, 2> pitched_a{dense_a};
+    const vt::pitched_ndarray<float, 2> pitched_b{dense_b};
+    vt::pitched_ndarray<float, 2> pitched_c{{ n, n }};
+
+    BENCHMARK("Column sum, dense" + suffix) {
+        float sum = 0.0f;
+        for (std::size_t j = 0; j < n; ++j) {
+            for (std::size_t i = 0; i < n; ++i) {
+                sum += dense_b[i][j];
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("Column sum, pitched" + suffix) {
+        float sum = 0.0f;
+        for (std::size_t j = 0; j < n; ++j) {
+            for (std::size_t i = 0; i < n; ++i) {
+                sum += pitched_b[i][j];
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("Naive matmul, dense" + suffix) {
+        naive_matmul(dense_a, dense_b, dense_c, n);
+    };
+
+    BENCHMARK("Naive matmul, pitched" + suffix) {
+        naive_matmul(pitched_a, pitched_b, pitched_c, n);
+    };
+}
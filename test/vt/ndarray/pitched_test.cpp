@@ -0,0 +1,147 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/pitched.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <numeric>
+
+
+TEST_CASE(
+    "vt::padded_pitch rounds rows up to an odd number of cache lines",
+    "[ndarray][pitched]"
+) {
+    const std::size_t line = vt::cpu_topology::get().cache_line_size;
+    const std::size_t line_floats = line / sizeof(float);
+
+    CHECK(vt::padded_pitch<float>(0) == 0);
+    CHECK(vt::padded_pitch<float>(1) == line_floats);
+    CHECK(vt::padded_pitch<float>(line_floats) == line_floats);
+    CHECK(vt::padded_pitch<float>(line_floats + 1) == 3 * line_floats);
+    CHECK(vt::padded_pitch<float>(3 * line_floats) == 3 * line_floats);
+
+    const std::size_t n = GENERATE(as<std::size_t>{}, 512, 1000, 1024);
+    const std::size_t pitch = vt::padded_pitch<float>(n);
+    CHECK(pitch >= n);
+    CHECK(pitch * sizeof(float) % line == 0);
+    CHECK(pitch * sizeof(float) / line % 2 == 1);
+}
+
+
+TEST_CASE(
+    "The rows of a vt::pitched_ndarray start on cache lines",
+    "[ndarray][pitched]"
+) {
+    const std::size_t line = vt::cpu_topology::get().cache_line_size;
+    vt::pitched_ndarray<std::int64_t, 2> a{{ 5, 100 }, 1};
+
+    CHECK(a.shape() == std::array<std::size_t, 2>{ 5, 100 });
+    CHECK(a.element_count() == 500);
+    CHECK(a.row_count() == 5);
+    CHECK(a.pitch() == vt::padded_pitch<std::int64_t>(100));
+
+    for (std::size_t i = 0; i < a.row_count(); ++i) {
+        const auto address = reinterpret_cast<std::uintptr_t>(a[i].data());
+        CHECK(address % line == 0);
+        CHECK(a[i].shape(0) == 100);
+        CHECK(a.row(i).data() == a[i].data());
+    }
+
+    for (std::size_t i = 0; i < 5; ++i) {
+        for (std::size_t j = 0; j < 100; ++j) {
+            CHECK(a[i][j] == 1);
+        }
+    }
+}
+
+
+TEST_CASE(
+    "A vt::pitched_ndarray can be copied from a dense vt::ndview",
+    "[ndarray][pitched]"
+) {
+    vt::ndarray<int, 3> dense{{ 2, 3, 17 }};
+    std::iota(dense.begin(), dense.end(), 0);
+
+    const vt::pitched_ndarray<int, 3> a{dense};
+    CHECK(a.row_count() == 6);
+
+    for (std::size_t i = 0; i < 2; ++i) {
+        const vt::pitched_ndview<const int, 2> plane = a[i];
+        CHECK(plane.pitch() == a.pitch());
+        for (std::size_t j = 0; j < 3; ++j) {
+            for (std::size_t k = 0; k < 17; ++k) {
+                CHECK(plane[j][k] == dense[i][j][k]);
+            }
+        }
+    }
+}
+
+
+TEST_CASE(
+    "A vt::pitched_ndview can be sliced along the first dimension",
+    "[ndarray][pitched]"
+) {
+    vt::pitched_ndarray<int, 3> a{{ 4, 2, 3 }, 0};
+    for (std::size_t r = 0; r < a.row_count(); ++r) {
+        std::iota(a.row(r).begin(), a.row(r).end(), static_cast<int>(r * 10));
+    }
+
+    const vt::pitched_ndview<int, 3> s = a.view().slice(1, 2);
+    CHECK(s.shape() == std::array<std::size_t, 3>{ 2, 2, 3 });
+    CHECK(s.row_count() == 4);
+    CHECK(s[0][0][0] == 20);
+    CHECK(s[1][1][2] == 52);
+    CHECK(a.view().slice(3)[0][1][0] == 70);
+
+    s[0][1][1] = -1;
+    CHECK(a[1][1][1] == -1);
+}
+
+
+TEST_CASE(
+    "A vt::pitched_ndview can wrap a dense vt::ndview",
+    "[ndarray][pitched]"
+) {
+    vt::ndarray<int, 2> dense{{ 3, 4 }, 2};
+    const vt::pitched_ndview<int, 2> v = dense.view();
+
+    CHECK(v.pitch() == 4);
+    CHECK(v.data() == dense.data());
+    CHECK(v[2].data() == dense[2].data());
+
+    v[1][3] = 5;
+    CHECK(dense[1][3] == 5);
+}
+
+
+TEST_CASE(
+    "An empty vt::pitched_ndarray has no elements",
+    "[ndarray][pitched]"
+) {
+    const vt::pitched_ndarray<float, 2> a;
+    CHECK(a.element_count() == 0);
+    CHECK(a.row_count() == 0);
+
+    const vt::pitched_ndarray<float, 2> b{{ 0, 8 }};
+    CHECK(b.element_count() == 0);
+    CHECK(b.row_count() == 0);
+}
@@ -0,0 +1,182 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/range.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+#include <vector>
+
+
+template<std::size_t N>
+static std::vector<std::array<std::size_t, N>> collect(
+    const vt::ndrange<N>& range
+) {
+    std::vector<std::array<std::size_t, N>> indices;
+    for (const vt::ndindex<N>& idx : range) {
+        indices.push_back(idx.index);
+    }
+
+    return indices;
+}
+
+
+static constexpr std::size_t weighted_sum(const vt::ndrange<2>& range) {
+    std::size_t sum = 0;
+    vt::for_each_index(range, [&sum](const vt::ndindex<2>& idx) {
+        sum += (idx[0] + 1) * 10 + idx[1] + idx.offset;
+    });
+
+    return sum;
+}
+
+
+TEST_CASE(
+    "A vt::ndrange visits indices in row-major order",
+    "[ndarray][range]"
+) {
+    const vt::ndrange<2> range{{ 2, 3 }};
+
+    CHECK(range.element_count() == 6);
+    CHECK(range.strides() == std::array<std::size_t, 2>{ 3, 1 });
+
+    using index = std::array<std::size_t, 2>;
+    CHECK(collect(range) == std::vector<index>{
+        { 0, 0 }, { 0, 1 }, { 0, 2 }, { 1, 0 }, { 1, 1 }, { 1, 2 }
+    });
+
+    std::size_t expected_offset = 0;
+    for (const vt::ndindex<2>& idx : range) {
+        CHECK(idx.offset == expected_offset);
+        ++expected_offset;
+    }
+    CHECK(expected_offset == 6);
+}
+
+
+TEST_CASE(
+    "A tiled vt::ndrange visits tiles in row-major order",
+    "[ndarray][range]"
+) {
+    // Partial tiles at the end of both dimensions
+    const vt::ndrange<2> range{{ 3, 5 }, { 2, 3 }};
+
+    using index = std::array<std::size_t, 2>;
+    CHECK(collect(range) == std::vector<index>{
+        { 0, 0 }, { 0, 1 }, { 0, 2 }, { 1, 0 }, { 1, 1 }, { 1, 2 },
+        { 0, 3 }, { 0, 4 }, { 1, 3 }, { 1, 4 },
+        { 2, 0 }, { 2, 1 }, { 2, 2 },
+        { 2, 3 }, { 2, 4 }
+    });
+
+    for (const vt::ndindex<2>& idx : range) {
+        CHECK(idx.offset == idx[0] * 5 + idx[1]);
+    }
+}
+
+
+TEST_CASE(
+    "The offsets of a vt::ndrange index into arrays",
+    "[ndarray][range]"
+) {
+    vt::ndarray<int, 3> a{{ 3, 4, 5 }};
+    for (const vt::ndindex<3>& idx : vt::ndrange<3>{a.shape(), { 2, 2, 2 }}) {
+        a.begin()[idx.offset] =
+            static_cast<int>(idx[0] * 100 + idx[1] * 10 + idx[2]);
+    }
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            for (std::size_t k = 0; k < 5; ++k) {
+                CHECK(a[i][j][k] == static_cast<int>(i * 100 + j * 10 + k));
+            }
+        }
+    }
+}
+
+
+TEST_CASE(
+    "A vt::ndrange over an empty shape is empty",
+    "[ndarray][range]"
+) {
+    const vt::ndrange<3> range{{ 2, 0, 3 }};
+
+    CHECK(range.begin() == range.end());
+
+    std::size_t calls = 0;
+    vt::for_each_index(range, [&calls](const vt::ndindex<3>&) { ++calls; });
+    CHECK(calls == 0);
+}
+
+
+TEST_CASE(
+    "vt::for_each_row yields contiguous rows",
+    "[ndarray][range]"
+) {
+    const std::size_t tile = GENERATE(as<std::size_t>{}, 1, 2, 4, 7);
+    const vt::ndrange<3> range{{ 3, 4, 7 }, { tile, tile, tile }};
+
+    std::vector<int> visits(range.element_count(), 0);
+    vt::for_each_row(range, [&](const vt::ndindex<3>& row, std::size_t count) {
+        CHECK(row.offset == (row[0] * 4 + row[1]) * 7 + row[2]);
+        CHECK(row[2] + count <= 7);
+        for (std::size_t j = 0; j < count; ++j) {
+            ++visits[row.offset + j];
+        }
+    });
+
+    CHECK(visits == std::vector<int>(visits.size(), 1));
+}
+
+
+TEST_CASE(
+    "vt::for_each_index visits the same indices as the iterator",
+    "[ndarray][range]"
+) {
+    const vt::ndrange<4> range{{ 3, 2, 4, 5 }, { 2, 2, 3, 2 }};
+
+    std::vector<std::size_t> from_iterator;
+    for (const vt::ndindex<4>& idx : range) {
+        from_iterator.push_back(idx.offset);
+    }
+
+    std::vector<std::size_t> from_for_each;
+    vt::for_each_index(range, [&](const vt::ndindex<4>& idx) {
+        CHECK(idx.offset == ((idx[0] * 2 + idx[1]) * 4 + idx[2]) * 5 + idx[3]);
+        from_for_each.push_back(idx.offset);
+    });
+
+    CHECK(from_for_each == from_iterator);
+}
+
+
+TEST_CASE(
+    "A vt::ndrange can be used in constant expressions",
+    "[ndarray][range]"
+) {
+    // Both orders visit 0..5 once
+    constexpr std::size_t untiled = weighted_sum(vt::ndrange<2>{{ 2, 3 }});
+    constexpr std::size_t tiled =
+        weighted_sum(vt::ndrange<2>{{ 2, 3 }, { 1, 2 }});
+    static_assert(untiled == 3 * 10 + 3 * 20 + 2 * 3 + 15);
+    static_assert(tiled == untiled);
+
+    CHECK(untiled == tiled);
+}
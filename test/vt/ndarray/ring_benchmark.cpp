@@ -0,0 +1,105 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/ring.hpp>
+
+#include <catch2/catch.hpp>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+
+TEST_CASE("Benchmark frame ring", "[ndarray][ring][!benchmark]") {
+    constexpr int frame_count = 2000;
+    const std::array<std::size_t, 2> frame_shape{ 64, 64 };
+
+    BENCHMARK("Mutex and deque of ndarrays") {
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::deque<vt::ndarray<float, 2>> queue;
+
+        std::thread producer{[&] {
+            for (int i = 0; i < frame_count; ++i) {
+                vt::ndarray<float, 2> frame{frame_shape, static_cast<float>(i)};
+                std::unique_lock<std::mutex> lock{mutex};
+                changed.wait(lock, [&] { return queue.size() < 8; });
+                queue.push_back(std::move(frame));
+                changed.notify_all();
+            }
+        }};
+
+        float sum = 0.0f;
+        for (int i = 0; i < frame_count; ++i) {
+            std::unique_lock<std::mutex> lock{mutex};
+            changed.wait(lock, [&] { return !queue.empty(); });
+            vt::ndarray<float, 2> frame = std::move(queue.front());
+            queue.pop_front();
+            changed.notify_all();
+            lock.unlock();
+            sum += frame[0][0];
+        }
+        producer.join();
+        return sum;
+    };
+
+    BENCHMARK("spsc_frame_ring") {
+        vt::spsc_frame_ring<float, 2> ring{frame_shape, 8};
+
+        std::thread producer{[&] {
+            for (int i = 0; i < frame_count; ++i) {
+                vt::ndview<float, 2> frame = ring.begin_write();
+                std::fill(frame.begin(), frame.end(), static_cast<float>(i));
+                ring.end_write();
+            }
+        }};
+
+        float sum = 0.0f;
+        for (int i = 0; i < frame_count; ++i) {
+            vt::ndview<const float, 2> frame = ring.begin_read();
+            sum += frame[0][0];
+            ring.end_read();
+        }
+        producer.join();
+        return sum;
+    };
+
+    BENCHMARK("mpmc_frame_ring") {
+        vt::mpmc_frame_ring<float, 2> ring{frame_shape, 8};
+
+        std::thread producer{[&] {
+            for (int i = 0; i < frame_count; ++i) {
+                const vt::ring_frame<float, 2> frame = ring.begin_write();
+                std::fill(frame.view().begin(), frame.view().end(),
+                    static_cast<float>(i));
+                ring.end_write(frame);
+            }
+        }};
+
+        float sum = 0.0f;
+        for (int i = 0; i < frame_count; ++i) {
+            const vt::ring_frame<const float, 2> frame = ring.begin_read();
+            sum += frame.view()[0][0];
+            ring.end_read(frame);
+        }
+        producer.join();
+        return sum;
+    };
+}
@@ -0,0 +1,214 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <vt/ndarray/ring.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <vector>
+
+
+TEST_CASE(
+    "A vt::spsc_frame_ring is first in, first out",
+    "[ndarray][ring]"
+) {
+    vt::spsc_frame_ring<int, 2> ring{{{ 2, 3 }}, 3};
+    CHECK(ring.capacity() == 3);
+    CHECK(ring.frame_shape() == std::array<std::size_t, 2>{ 2, 3 });
+    CHECK(!ring.try_begin_read());
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 3; ++i) {
+            const std::optional<vt::ndview<int, 2>> frame =
+                ring.try_begin_write();
+            REQUIRE(frame);
+            CHECK(frame->shape() == std::array<std::size_t, 2>{ 2, 3 });
+            std::fill(frame->begin(), frame->end(), 10 * round + i);
+            ring.end_write();
+        }
+        CHECK(!ring.try_begin_write());
+
+        for (int i = 0; i < 3; ++i) {
+            const std::optional<vt::ndview<const int, 2>> frame =
+                ring.try_begin_read();
+            REQUIRE(frame);
+            CHECK(std::all_of(frame->begin(), frame->end(), [&](int x) {
+                return x == 10 * round + i;
+            }));
+            ring.end_read();
+        }
+        CHECK(!ring.try_begin_read());
+    }
+}
+
+
+TEST_CASE(
+    "vt::spsc_frame_ring frames do not share cache lines",
+    "[ndarray][ring]"
+) {
+    vt::spsc_frame_ring<char, 1> ring{{{ 3 }}, 4};
+
+    const char* first = ring.begin_write().data();
+    ring.end_write();
+    const char* second = ring.begin_write().data();
+    ring.end_write();
+
+    CHECK(second - first >= 64);
+}
+
+
+TEST_CASE(
+    "vt::spsc_frame_ring frames start on whole 128-byte lines",
+    "[ndarray][ring]"
+) {
+    struct rgb { std::uint8_t r, g, b; };
+    vt::spsc_frame_ring<rgb, 1> ring{{{ 5 }}, 3};
+
+    for (int i = 0; i < 3; ++i) {
+        const auto address = reinterpret_cast<std::uintptr_t>(
+            ring.begin_write().data()
+        );
+        CHECK(address % 128 == 0);
+        ring.end_write();
+    }
+}
+
+
+TEST_CASE(
+    "A vt::spsc_frame_ring can pass frames between threads",
+    "[ndarray][ring]"
+) {
+    constexpr int frame_count = 10000;
+    vt::spsc_frame_ring<std::int64_t, 1> ring{{{ 16 }}, 8};
+
+    std::thread producer{[&] {
+        for (int i = 0; i < frame_count; ++i) {
+            vt::ndview<std::int64_t, 1> frame = ring.begin_write();
+            std::fill(frame.begin(), frame.end(), i);
+            ring.end_write();
+        }
+    }};
+
+    bool ordered = true;
+    for (int i = 0; i < frame_count; ++i) {
+        vt::ndview<const std::int64_t, 1> frame = ring.begin_read();
+        ordered = ordered && std::all_of(frame.begin(), frame.end(),
+            [&](std::int64_t x) { return x == i; });
+        ring.end_read();
+    }
+    producer.join();
+
+    CHECK(ordered);
+    CHECK(!ring.try_begin_read());
+}
+
+
+TEST_CASE(
+    "A vt::mpmc_frame_ring is first in, first out",
+    "[ndarray][ring]"
+) {
+    vt::mpmc_frame_ring<float, 1> ring{{{ 4 }}, 2};
+    CHECK(ring.capacity() == 2);
+    CHECK(ring.frame_shape() == std::array<std::size_t, 1>{ 4 });
+    CHECK(!ring.try_begin_read());
+
+    const std::optional<vt::ring_frame<float, 1>> a = ring.try_begin_write();
+    const std::optional<vt::ring_frame<float, 1>> b = ring.try_begin_write();
+    REQUIRE(a);
+    REQUIRE(b);
+    CHECK(!ring.try_begin_write());
+
+    // Frames are read in the order in which they were claimed, not the
+    // order in which they were finished
+    std::fill(b->view().begin(), b->view().end(), 2.0f);
+    ring.end_write(*b);
+    CHECK(!ring.try_begin_read());
+
+    std::fill(a->view().begin(), a->view().end(), 1.0f);
+    ring.end_write(*a);
+
+    const std::optional<vt::ring_frame<const float, 1>> c =
+        ring.try_begin_read();
+    REQUIRE(c);
+    CHECK(c->view()[0] == Approx(1.0f));
+    ring.end_read(*c);
+
+    const vt::ring_frame<float, 1> d = ring.begin_write();
+    ring.end_write(d);
+
+    const vt::ndview<const float, 1> e = ring.begin_read();
+    CHECK(e[3] == Approx(2.0f));
+}
+
+
+TEST_CASE(
+    "A vt::mpmc_frame_ring can pass frames between threads",
+    "[ndarray][ring]"
+) {
+    constexpr int producer_count = 3;
+    constexpr int consumer_count = 3;
+    constexpr int frames_per_producer = 3000;
+    constexpr int frame_count = producer_count * frames_per_producer;
+    vt::mpmc_frame_ring<int, 1> ring{{{ 8 }}, 4};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producer_count; ++p) {
+        threads.emplace_back([&ring, p] {
+            for (int i = 0; i < frames_per_producer; ++i) {
+                const vt::ring_frame<int, 1> frame = ring.begin_write();
+                std::fill(frame.view().begin(), frame.view().end(),
+                    p * frames_per_producer + i);
+                ring.end_write(frame);
+            }
+        });
+    }
+
+    // Every frame is read exactly once, and never while half written
+    std::vector<std::vector<int>> seen(consumer_count);
+    for (int c = 0; c < consumer_count; ++c) {
+        threads.emplace_back([&ring, &seen, c] {
+            for (int i = 0; i < frame_count / consumer_count; ++i) {
+                const vt::ring_frame<const int, 1> frame = ring.begin_read();
+                const vt::ndview<const int, 1> view = frame;
+                if (std::equal(view.begin() + 1, view.end(), view.begin())) {
+                    seen[static_cast<std::size_t>(c)].push_back(view[0]);
+                }
+                ring.end_read(frame);
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    std::vector<int> all;
+    for (const std::vector<int>& s : seen) {
+        all.insert(all.end(), s.begin(), s.end());
+    }
+    std::sort(all.begin(), all.end());
+    std::vector<int> expected(static_cast<std::size_t>(frame_count));
+    std::iota(expected.begin(), expected.end(), 0);
+    CHECK(all == expected);
+    CHECK(!ring.try_begin_read());
+}
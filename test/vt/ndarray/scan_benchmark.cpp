@@ -0,0 +1,81 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/scan.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <numeric>
+
+
+TEST_CASE("Benchmark scan", "[ndarray][scan][!benchmark]") {
+    const std::size_t n = 1 << 22;
+
+    const vt::ndarray<float, 1> src{{ n }, 1.0f};
+    vt::ndarray<float, 1> dst{{ n }};
+
+    BENCHMARK("std::partial_sum") {
+        std::partial_sum(src.begin(), src.end(), dst.begin());
+    };
+
+    BENCHMARK("inclusive_scan") {
+        vt::inclusive_scan<float>(src, dst.view());
+    };
+
+    const vt::ndarray<float, 2> rows{{ 2048, 2048 }, 1.0f};
+    vt::ndarray<float, 2> columns{{ 2048, 2048 }};
+
+    BENCHMARK("Naive loop, axis = 0") {
+        for (std::size_t j = 0; j < 2048; ++j) {
+            float sum = 0.0f;
+            for (std::size_t i = 0; i < 2048; ++i) {
+                sum += rows[i][j];
+                columns[i][j] = sum;
+            }
+        }
+    };
+
+    BENCHMARK("inclusive_scan, axis = 0") {
+        vt::inclusive_scan<float>(rows, columns.view(), 0);
+    };
+}
+
+
+TEST_CASE("Benchmark integral image", "[ndarray][scan][!benchmark]") {
+    const std::size_t n = 2048;
+
+    const vt::ndarray<std::int32_t, 2> image{{ n, n }, 1};
+    vt::ndarray<std::int32_t, 2> integral{{ n, n }};
+
+    BENCHMARK("Naive loop") {
+        for (std::size_t r = 0; r < n; ++r) {
+            std::int32_t row_sum = 0;
+            for (std::size_t c = 0; c < n; ++c) {
+                row_sum += image[r][c];
+                integral[r][c] = row_sum + (r > 0 ? integral[r - 1][c] : 0);
+            }
+        }
+    };
+
+    BENCHMARK("integral_image") {
+        vt::integral_image<std::int32_t>(image, integral.view());
+    };
+}
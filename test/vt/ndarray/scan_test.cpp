@@ -0,0 +1,215 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/scan.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+template<typename T>
+static vt::ndarray<T, 3> random_array(const std::array<std::size_t, 3>& shape) {
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> dist{-50, 50};
+
+    vt::ndarray<T, 3> a{shape};
+    for (T& x : a) {
+        x = static_cast<T>(dist(rng));
+    }
+
+    return a;
+}
+
+
+// Reference scan, by walking every lane in order
+template<typename T, typename Source>
+static vt::ndarray<T, 3> naive_scan(
+    const vt::ndarray<Source, 3>& src,
+    std::size_t axis,
+    bool exclusive,
+    T init
+) {
+    vt::ndarray<T, 3> dst{src.shape()};
+    std::array<std::size_t, 3> lane_shape = src.shape();
+    lane_shape[axis] = 1;
+
+    for (std::size_t i = 0; i < lane_shape[0]; ++i)
+    for (std::size_t j = 0; j < lane_shape[1]; ++j)
+    for (std::size_t k = 0; k < lane_shape[2]; ++k) {
+        T sum = init;
+        for (std::size_t n = 0; n < src.shape(axis); ++n) {
+            std::array<std::size_t, 3> idx{ i, j, k };
+            idx[axis] = n;
+            const Source x = src[idx[0]][idx[1]][idx[2]];
+            T& out = dst[idx[0]][idx[1]][idx[2]];
+            if (exclusive) {
+                out = sum;
+                sum += x;
+            } else {
+                sum += x;
+                out = sum;
+            }
+        }
+    }
+
+    return dst;
+}
+
+
+template<typename T, typename Source = T>
+static void check_scans(
+    const std::array<std::size_t, 3>& shape,
+    std::size_t axis,
+    std::size_t thread_count
+) {
+    const vt::ndarray<Source, 3> src = random_array<Source>(shape);
+    vt::ndarray<T, 3> dst{shape};
+
+    vt::inclusive_scan<T, Source>(src, dst.view(), axis, thread_count);
+    const vt::ndarray<T, 3> inclusive = naive_scan(src, axis, false, T{});
+    CHECK(std::vector<T>(dst.begin(), dst.end()) ==
+        std::vector<T>(inclusive.begin(), inclusive.end()));
+
+    vt::exclusive_scan<T, Source>(src, dst.view(), T{7}, axis, thread_count);
+    const vt::ndarray<T, 3> exclusive = naive_scan(src, axis, true, T{7});
+    CHECK(std::vector<T>(dst.begin(), dst.end()) ==
+        std::vector<T>(exclusive.begin(), exclusive.end()));
+}
+
+
+TEST_CASE(
+    "vt::inclusive_scan and vt::exclusive_scan scan along an axis",
+    "[ndarray][scan]"
+) {
+    const auto shape = GENERATE(
+        std::array<std::size_t, 3>{ 1, 1, 1 },
+        std::array<std::size_t, 3>{ 3, 5, 17 },
+        std::array<std::size_t, 3>{ 2, 70, 3 },
+        std::array<std::size_t, 3>{ 4, 3, 130 },
+        std::array<std::size_t, 3>{ 0, 3, 4 }
+    );
+    const std::size_t axis = GENERATE(as<std::size_t>{}, 0, 1, 2);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    check_scans<float>(shape, axis, thread_count);
+    check_scans<double>(shape, axis, thread_count);
+    check_scans<std::int32_t>(shape, axis, thread_count);
+    check_scans<std::uint64_t>(shape, axis, thread_count);
+    check_scans<std::int16_t>(shape, axis, thread_count);
+    check_scans<std::int64_t, std::int8_t>(shape, axis, thread_count);
+}
+
+
+TEST_CASE(
+    "Scans split long lanes over threads",
+    "[ndarray][scan]"
+) {
+    const auto shape = GENERATE(
+        std::array<std::size_t, 3>{ 1, 1, 300001 },
+        std::array<std::size_t, 3>{ 2, 100003, 3 }
+    );
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 4);
+
+    check_scans<std::int64_t>(shape, shape[2] == 3 ? 1 : 2, thread_count);
+    check_scans<std::int32_t, std::int8_t>(shape, 2, thread_count);
+}
+
+
+TEST_CASE(
+    "vt::inclusive_scan and vt::exclusive_scan can scan an array in place",
+    "[ndarray][scan]"
+) {
+    vt::ndarray<int, 1> a{{ 9 }, { 1, 2, 3, 4, 5, 6, 7, 8, 9 }};
+
+    vt::inclusive_scan<int>(a, a.view());
+    CHECK(std::vector<int>(a.begin(), a.end()) ==
+        std::vector<int>{ 1, 3, 6, 10, 15, 21, 28, 36, 45 });
+
+    vt::exclusive_scan<int>(a, a.view(), 100);
+    CHECK(std::vector<int>(a.begin(), a.end()) ==
+        std::vector<int>{ 100, 101, 104, 110, 120, 135, 156, 184, 220 });
+}
+
+
+TEST_CASE(
+    "vt::integral_image sums all elements above and to the left",
+    "[ndarray][scan]"
+) {
+    const std::size_t rows = GENERATE(as<std::size_t>{}, 0, 1, 7, 1000);
+    const std::size_t cols = GENERATE(as<std::size_t>{}, 1, 5, 300);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    vt::ndarray<std::uint8_t, 2> image{{ rows, cols }};
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> dist{0, 255};
+    for (std::uint8_t& pixel : image) {
+        pixel = static_cast<std::uint8_t>(dist(rng));
+    }
+
+    vt::ndarray<std::uint32_t, 2> integral{{ rows, cols }};
+    vt::integral_image<std::uint32_t, std::uint8_t>(
+        image, integral.view(), thread_count
+    );
+
+    vt::ndarray<std::uint32_t, 2> expected{{ rows, cols }};
+    for (std::size_t r = 0; r < rows; ++r) {
+        std::uint32_t row_sum = 0;
+        for (std::size_t c = 0; c < cols; ++c) {
+            row_sum += image[r][c];
+            expected[r][c] = row_sum + (r > 0 ? expected[r - 1][c] : 0);
+        }
+    }
+    CHECK(std::vector<std::uint32_t>(integral.begin(), integral.end()) ==
+        std::vector<std::uint32_t>(expected.begin(), expected.end()));
+
+    if (rows >= 7) {
+        std::uint32_t sum = 0;
+        for (std::size_t r = 2; r < 6; ++r) {
+            for (std::size_t c = 1; c < cols; ++c) {
+                sum += image[r][c];
+            }
+        }
+        CHECK(vt::box_sum<std::uint32_t>(integral, 2, 1, 6, cols) == sum);
+        CHECK(vt::box_sum<std::uint32_t>(integral, 3, 1, 3, cols) == 0);
+    }
+}
+
+
+TEST_CASE(
+    "vt::integral_image sums floating-point values",
+    "[ndarray][scan]"
+) {
+    vt::ndarray<float, 2> image{{ 3, 6 }, 0.5f};
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 2);
+
+    vt::integral_image<float>(image, image.view(), thread_count);
+
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 6; ++c) {
+            const auto area = static_cast<double>((r + 1) * (c + 1));
+            CHECK(image[r][c] == Approx(0.5 * area));
+        }
+    }
+    CHECK(vt::box_sum<float>(image, 1, 1, 3, 4) == Approx(3.0f));
+}
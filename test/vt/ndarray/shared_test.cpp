@@ -0,0 +1,167 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/shared.hpp>
+
+#include <catch2/catch.hpp>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+
+TEST_CASE(
+    "An empty vt::shared_ndarray can be default constructed without any "
+    "allocations",
+    "[ndarray][shared]"
+) {
+    const vt::shared_ndarray<int, 2> a;
+
+    REQUIRE(a.shape(0) == 0);
+    REQUIRE(a.data() == nullptr);
+    REQUIRE(a.use_count() == 0);
+}
+
+
+TEST_CASE(
+    "A vt::shared_ndarray can take ownership of a vt::ndarray without copying",
+    "[ndarray][shared]"
+) {
+    vt::ndarray<int, 2> a{{ 2, 2 }, { 3, 1, 4, 1 }};
+    const int* data = a.data();
+
+    const vt::shared_ndarray b{std::move(a)};
+
+    REQUIRE(b.data() == data);
+    REQUIRE(b.shape(0) == 2);
+    REQUIRE(b.shape(1) == 2);
+    REQUIRE(b.use_count() == 1);
+
+    CHECK(b[1][0] == 4);
+}
+
+
+TEST_CASE(
+    "Copying a vt::shared_ndarray shares the underlying buffer",
+    "[ndarray][shared]"
+) {
+    const vt::shared_ndarray<int, 1> a{{ 4 }, { 3, 1, 4, 1 }};
+    const vt::shared_ndarray<int, 1> b = a;
+
+    REQUIRE(a.data() == b.data());
+    REQUIRE(a.use_count() == 2);
+    REQUIRE(b.use_count() == 2);
+    REQUIRE(a == b);
+}
+
+
+TEST_CASE(
+    "A vt::shared_ndarray only copies its buffer on first mutable access when "
+    "it is shared",
+    "[ndarray][shared]"
+) {
+    vt::shared_ndarray<int, 1> a{{ 4 }, { 3, 1, 4, 1 }};
+    const int* data = a.cview().data();
+
+    SECTION("unshared") {
+        a[0] = 2;
+
+        CHECK(a.cview().data() == data);
+        CHECK(a[0] == 2);
+    }
+
+    SECTION("shared") {
+        const vt::shared_ndarray<int, 1> b = a;
+
+        a[0] = 2;
+
+        CHECK(a.cview().data() != data);
+        CHECK(b.data() == data);
+        CHECK(a.use_count() == 1);
+        CHECK(b.use_count() == 1);
+        CHECK(a[0] == 2);
+        CHECK(b[0] == 3);
+
+        a[1] = 5;
+
+        CHECK(b[1] == 1);
+    }
+}
+
+
+TEST_CASE(
+    "A vt::shared_ndarray converts to a const vt::ndview without detaching",
+    "[ndarray][shared]"
+) {
+    vt::shared_ndarray<int, 2> a{{ 2, 2 }, { 3, 1, 4, 1 }};
+    const vt::shared_ndarray<int, 2> b = a;
+
+    const vt::ndview<const int, 2> view = a;
+
+    REQUIRE(view.data() == b.data());
+    REQUIRE(a.use_count() == 2);
+}
+
+
+TEST_CASE(
+    "A vt::shared_ndarray can be copied into an independent vt::ndarray",
+    "[ndarray][shared]"
+) {
+    const vt::shared_ndarray<int, 1> a{{ 3 }, 7};
+
+    vt::ndarray<int, 1> b = a.to_ndarray();
+
+    REQUIRE(b.data() != a.data());
+    REQUIRE(b == vt::ndarray<int, 1>{{ 3 }, 7});
+}
+
+
+TEST_CASE(
+    "Reference counting of vt::shared_ndarray is thread-safe",
+    "[ndarray][shared]"
+) {
+    const vt::shared_ndarray<int, 1> a{{ 16 }, 1};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&a]() {
+            for (int i = 0; i < 1000; ++i) {
+                vt::shared_ndarray<int, 1> b = a;
+                if (i % 2 == 0) b[0] = i;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    REQUIRE(a.use_count() == 1);
+    REQUIRE(a[0] == 1);
+}
+
+
+TEST_CASE(
+    "A vt::shared_ndarray can be streamed",
+    "[ndarray][shared]"
+) {
+    const vt::shared_ndarray<int, 2> a{{ 2, 2 }, { 3, 1, 4, 1 }};
+
+    std::ostringstream ss;
+    ss << a;
+
+    REQUIRE(ss.str() == "[[3,1],[4,1]]");
+}
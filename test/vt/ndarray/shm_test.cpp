@@ -0,0 +1,216 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/shm.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+
+#if VT_NDARRAY_POSIX
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+static std::string unique_name(const char* suffix) {
+    return "/vt-ndarray-test-" + std::to_string(::getpid()) + "-" + suffix;
+}
+
+
+TEST_CASE(
+    "A vt::shm_ndarray can be shared between a creator and an opener",
+    "[ndarray][shm]"
+) {
+    const std::string name = unique_name("array");
+
+    auto a = vt::shm_ndarray<float, 2>::create(name, {{ 3, 5 }});
+    CHECK(a.shape() == std::array<std::size_t, 2>{ 3, 5 });
+    CHECK(a.name() == name);
+    std::iota(a.view().begin(), a.view().end(), 0.0f);
+
+    // A second mapping of the same memory, as another process would see it
+    const auto b = vt::shm_ndarray<const float, 2>::open(name);
+    CHECK(b.shape() == a.shape());
+    CHECK(b.data() != a.data());
+    CHECK(b.view()[2][4] == Approx(14.0f));
+
+    a.view()[1][1] = -1.0f;
+    CHECK(b.view()[1][1] == Approx(-1.0f));
+
+    CHECK_THROWS_AS(
+        (vt::shm_ndarray<float, 2>::create(name, {{ 1, 1 }})),
+        std::system_error
+    );
+    CHECK_THROWS_AS(
+        (vt::shm_ndarray<double, 2>::open(name)), std::runtime_error
+    );
+    CHECK_THROWS_AS(
+        (vt::shm_ndarray<float, 3>::open(name)), std::runtime_error
+    );
+    CHECK_THROWS_AS(
+        (vt::shm_frame_ring<float, 2>::open(name)), std::runtime_error
+    );
+}
+
+
+TEST_CASE(
+    "A vt::shm_ndarray name is removed by its creator",
+    "[ndarray][shm]"
+) {
+    const std::string name = unique_name("lifetime");
+
+    {
+        auto a = vt::shm_ndarray<std::int32_t, 1>::create(name, {{ 4 }});
+        a.view()[3] = 42;
+
+        const auto b = vt::shm_ndarray<std::int32_t, 1>::open(name);
+        auto moved = std::move(a);
+        CHECK(b.view()[3] == 42);
+    }
+
+    CHECK_THROWS_AS(
+        (vt::shm_ndarray<std::int32_t, 1>::open(name)), std::system_error
+    );
+    CHECK(!vt::remove_shm(name));
+}
+
+
+TEST_CASE(
+    "A vt::shm_frame_ring with a corrupt header is rejected",
+    "[ndarray][shm]"
+) {
+    const std::string name = unique_name("corrupt");
+    auto ring = vt::shm_frame_ring<std::int32_t, 1>::create(name, {{ 4 }}, 2);
+
+    // The capacity and the shape follow the first 16 bytes of the header
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    REQUIRE(fd >= 0);
+    void* base = ::mmap(nullptr, 32, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    REQUIRE(base != MAP_FAILED);
+    unsigned char* header = static_cast<unsigned char*>(base);
+
+    const std::uint64_t capacity = std::uint64_t{1} << 62;
+    std::memcpy(header + 16, &capacity, sizeof(capacity));
+    CHECK_THROWS_AS(
+        (vt::shm_frame_ring<std::int32_t, 1>::open(name)), std::runtime_error
+    );
+
+    const std::uint64_t extent = std::uint64_t{1} << 62;
+    const std::uint64_t two = 2;
+    std::memcpy(header + 16, &two, sizeof(two));
+    std::memcpy(header + 24, &extent, sizeof(extent));
+    CHECK_THROWS_AS(
+        (vt::shm_frame_ring<std::int32_t, 1>::open(name)), std::runtime_error
+    );
+
+    ::munmap(base, 32);
+}
+
+
+TEST_CASE(
+    "A vt::shm_frame_ring is first in, first out",
+    "[ndarray][shm]"
+) {
+    const std::string name = unique_name("ring");
+
+    auto producer = vt::shm_frame_ring<std::int32_t, 2>::create(
+        name, {{ 2, 3 }}, 3
+    );
+    auto consumer = vt::shm_frame_ring<std::int32_t, 2>::open(name);
+    CHECK(consumer.capacity() == 3);
+    CHECK(consumer.frame_shape() == std::array<std::size_t, 2>{ 2, 3 });
+
+    CHECK(!consumer.try_begin_read());
+
+    for (std::int32_t i = 0; i < 3; ++i) {
+        auto frame = producer.try_begin_write();
+        REQUIRE(frame);
+        CHECK(reinterpret_cast<std::uintptr_t>(frame->data()) % 128 == 0);
+        std::fill(frame->begin(), frame->end(), i);
+        producer.end_write();
+    }
+    CHECK(!producer.try_begin_write());
+
+    for (std::int32_t i = 0; i < 5; ++i) {
+        auto frame = consumer.try_begin_read();
+        REQUIRE(frame);
+        CHECK((*frame)[1][2] == i);
+        consumer.end_read();
+
+        auto next = producer.try_begin_write();
+        REQUIRE(next);
+        std::fill(next->begin(), next->end(), i + 3);
+        producer.end_write();
+    }
+}
+
+
+TEST_CASE(
+    "A vt::shm_frame_ring can pass frames between processes",
+    "[ndarray][shm]"
+) {
+    const std::string name = unique_name("processes");
+    constexpr std::int64_t frame_count = 2000;
+
+    auto consumer = vt::shm_frame_ring<std::int64_t, 1>::create(
+        name, {{ 64 }}, 4
+    );
+
+    const pid_t child = ::fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        auto producer = vt::shm_frame_ring<std::int64_t, 1>::open(name);
+        for (std::int64_t i = 0; i < frame_count; ++i) {
+            std::optional<vt::ndview<std::int64_t, 1>> frame;
+            while (!(frame = producer.try_begin_write())) {}
+            std::iota(frame->begin(), frame->end(), i);
+            producer.end_write();
+        }
+        ::_exit(0);
+    }
+
+    bool ordered = true;
+    for (std::int64_t i = 0; i < frame_count; ++i) {
+        std::optional<vt::ndview<const std::int64_t, 1>> frame;
+        while (!(frame = consumer.try_begin_read())) {}
+        ordered = ordered && (*frame)[0] == i && (*frame)[63] == i + 63;
+        consumer.end_read();
+    }
+    CHECK(ordered);
+
+    int status = 0;
+    CHECK(::waitpid(child, &status, 0) == child);
+    CHECK(WIFEXITED(status));
+}
+
+#endif
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/soa.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+
+
+struct particle {
+    float x;
+    float y;
+    std::int32_t id;
+};
+
+
+template<>
+struct vt::soa_traits<particle> {
+    static constexpr auto members =
+        std::make_tuple(&particle::x, &particle::y, &particle::id);
+};
+
+
+TEST_CASE(
+    "A vt::soa_ndarray stores each field in its own aligned buffer",
+    "[ndarray][soa]"
+) {
+    const vt::soa_ndarray<particle, 1> a{{ 4 }};
+
+    REQUIRE(a.field_count == 3);
+    REQUIRE(a.shape(0) == 4);
+    REQUIRE(a.element_count() == 4);
+
+    const vt::ndview<const float, 1> x = a.field<&particle::x>();
+    const vt::ndview<const float, 1> y = a.field<1>();
+    const vt::ndview<const std::int32_t, 1> id = a.field<&particle::id>();
+
+    CHECK(x.shape(0) == 4);
+    CHECK(y.shape(0) == 4);
+    CHECK(id.shape(0) == 4);
+    CHECK(x.data() != y.data());
+    const std::size_t line_size = vt::detail::cache_line_size;
+    CHECK(reinterpret_cast<std::uintptr_t>(x.data()) % line_size == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(y.data()) % line_size == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(id.data()) % line_size == 0);
+}
+
+
+TEST_CASE(
+    "A vt::soa_ndarray can be constructed with an initial record",
+    "[ndarray][soa]"
+) {
+    const vt::soa_ndarray<particle, 2> a{{ 2, 3 }, particle{ 1, 2, 3 }};
+
+    for (std::int32_t id : a.field<&particle::id>()) {
+        CHECK(id == 3);
+    }
+
+    const particle p = a[1][2];
+
+    CHECK(p.id == 3);
+}
+
+
+TEST_CASE(
+    "Records in a vt::soa_ndarray can be accessed through proxy references",
+    "[ndarray][soa]"
+) {
+    vt::soa_ndarray<particle, 2> a{{ 2, 2 }, particle{ 0, 0, 0 }};
+
+    a[1][0] = particle{ 3, 1, 4 };
+    a[0][1].get<&particle::id>() = 5;
+
+    CHECK(a.field<&particle::id>()[1][0] == 4);
+    CHECK(a.field<&particle::id>()[0][1] == 5);
+
+    a[0][0] = a[1][0];
+
+    const particle p = a[0][0];
+
+    CHECK(p.id == 4);
+    CHECK(a.cview()[1][0].get<2>() == 4);
+}
+
+
+TEST_CASE(
+    "A vt::soa_ndview can be sliced in the first dimension",
+    "[ndarray][soa]"
+) {
+    vt::soa_ndarray<particle, 2> a{{ 3, 2 }, particle{ 0, 0, 0 }};
+
+    auto ids = a.field<&particle::id>();
+    for (std::size_t i = 0; i < ids.element_count(); ++i) {
+        ids.data()[i] = static_cast<std::int32_t>(i);
+    }
+
+    const vt::soa_ndview<const particle, 2> slice = a.cview().slice(1, 2);
+
+    REQUIRE(slice.shape(0) == 2);
+    REQUIRE(slice.shape(1) == 2);
+
+    CHECK(slice[0][0].get<&particle::id>() == 2);
+    CHECK(slice.field<&particle::id>()[1][1] == 5);
+}
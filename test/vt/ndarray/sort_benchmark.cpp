@@ -0,0 +1,74 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/sort.hpp>
+
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+
+TEST_CASE("Benchmark sorting rows", "[ndarray][sort][!benchmark]") {
+    const std::size_t cols = GENERATE(as<std::size_t>{}, 8, 128, 4096, 1 << 20);
+    const std::size_t rows = (std::size_t{1} << 20) / cols;
+    const std::string suffix = ", " + std::to_string(rows) + " x " +
+        std::to_string(cols);
+
+    vt::ndarray<float, 2> source{{ rows, cols }};
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+    for (float& x : source) {
+        x = dist(rng);
+    }
+
+    vt::ndarray<float, 2> a{source.shape()};
+    vt::ndarray<std::size_t, 2> indices{source.shape()};
+
+    // Both include copying the unsorted data
+    BENCHMARK("std::sort" + suffix) {
+        std::copy(source.begin(), source.end(), a.begin());
+        for (std::size_t i = 0; i < rows; ++i) {
+            std::sort(a[i].begin(), a[i].end());
+        }
+    };
+
+    BENCHMARK("vt::sort" + suffix) {
+        std::copy(source.begin(), source.end(), a.begin());
+        vt::sort(a.view());
+    };
+
+    BENCHMARK("std::stable_sort of indices" + suffix) {
+        for (std::size_t i = 0; i < rows; ++i) {
+            const vt::ndview<const float, 1> row = source[i];
+            std::iota(indices[i].begin(), indices[i].end(), std::size_t{0});
+            std::stable_sort(indices[i].begin(), indices[i].end(),
+                [&](std::size_t x, std::size_t y) { return row[x] < row[y]; }
+            );
+        }
+    };
+
+    BENCHMARK("vt::argsort" + suffix) {
+        vt::argsort<float>(source, indices.view());
+    };
+}
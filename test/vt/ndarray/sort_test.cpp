@@ -0,0 +1,382 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/sort.hpp>
+#include <vt/ndarray.hpp>
+
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+
+template<typename T>
+static vt::ndarray<T, 2> random_rows(
+    std::size_t rows,
+    std::size_t cols,
+    unsigned seed
+) {
+    std::mt19937 rng{seed};
+    vt::ndarray<T, 2> a{{ rows, cols }};
+
+    for (T& x : a) {
+        if constexpr (std::is_floating_point_v<T>) {
+            x = std::uniform_real_distribution<T>{-100, 100}(rng);
+        } else {
+            // Few distinct values, so that there are many duplicates
+            std::uniform_int_distribution<int> value{-50, 50};
+            x = static_cast<T>(value(rng));
+        }
+    }
+
+    return a;
+}
+
+
+// Sorted copy of every lane along axis 1 of a three-dimensional array
+template<typename T>
+static std::vector<std::vector<T>> sorted_lanes(const vt::ndarray<T, 3>& a) {
+    std::vector<std::vector<T>> lanes;
+    for (std::size_t i = 0; i < a.shape(0); ++i) {
+        for (std::size_t k = 0; k < a.shape(2); ++k) {
+            std::vector<T> lane;
+            for (std::size_t j = 0; j < a.shape(1); ++j) {
+                lane.push_back(a[i][j][k]);
+            }
+            std::sort(lane.begin(), lane.end());
+            lanes.push_back(lane);
+        }
+    }
+
+    return lanes;
+}
+
+
+template<typename T>
+static void check_sort_rows(std::size_t length, std::size_t thread_count) {
+    vt::ndarray<T, 2> a = random_rows<T>(37, length, 1);
+    vt::ndarray<T, 2> expected = a;
+    for (std::size_t i = 0; i < 37; ++i) {
+        std::sort(expected[i].begin(), expected[i].end());
+    }
+
+    vt::sort(a.view(), 1, thread_count);
+
+    CHECK(std::equal(a.begin(), a.end(), expected.begin()));
+}
+
+
+template<typename T, typename Index>
+static void check_argsort_rows(std::size_t length, std::size_t thread_count) {
+    const vt::ndarray<T, 2> a = random_rows<T>(23, length, 2);
+    vt::ndarray<Index, 2> indices{{ 23, length }};
+
+    vt::argsort<T>(a, indices.view(), 1, thread_count);
+
+    for (std::size_t i = 0; i < 23; ++i) {
+        std::vector<Index> expected(length);
+        std::iota(expected.begin(), expected.end(), Index{0});
+        std::stable_sort(expected.begin(), expected.end(),
+            [&](Index x, Index y) {
+                return a[i][static_cast<std::size_t>(x)] <
+                    a[i][static_cast<std::size_t>(y)];
+            }
+        );
+
+        CHECK(std::equal(
+            indices[i].begin(), indices[i].end(), expected.begin()
+        ));
+    }
+}
+
+
+TEST_CASE(
+    "vt::sort sorts all sequences of zeros and ones of up to 16 elements",
+    "[ndarray][sort]"
+) {
+    // A sorting network that sorts all sequences of zeros and ones sorts
+    // all sequences.
+    const std::size_t n = GENERATE(range(std::size_t{1}, std::size_t{17}));
+    const std::size_t count = std::size_t{1} << n;
+
+    vt::ndarray<std::uint8_t, 2> a{{ count, n }};
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            a[i][j] = static_cast<std::uint8_t>((i >> j) & 1);
+        }
+    }
+
+    vt::sort(a.view());
+
+    for (std::size_t i = 0; i < count; ++i) {
+        REQUIRE(std::is_sorted(a[i].begin(), a[i].end()));
+    }
+}
+
+
+TEST_CASE(
+    "vt::sort sorts the rows of an array",
+    "[ndarray][sort]"
+) {
+    const std::size_t length = GENERATE(as<std::size_t>{},
+        0, 1, 5, 16, 17, 300, 1000
+    );
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    check_sort_rows<float>(length, thread_count);
+    check_sort_rows<double>(length, thread_count);
+    check_sort_rows<std::int8_t>(length, thread_count);
+    check_sort_rows<std::int16_t>(length, thread_count);
+    check_sort_rows<std::int32_t>(length, thread_count);
+    check_sort_rows<std::uint64_t>(length, thread_count);
+}
+
+
+TEST_CASE(
+    "vt::sort sorts along a leading axis",
+    "[ndarray][sort]"
+) {
+    const std::size_t length = GENERATE(as<std::size_t>{}, 9, 400);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 2);
+
+    const vt::ndarray<float, 2> rows = random_rows<float>(3, length * 5, 3);
+    vt::ndarray<float, 3> a{{ 3, length, 5 }, rows.begin(), rows.end()};
+    const std::vector<std::vector<float>> expected = sorted_lanes(a);
+
+    vt::sort(a.view(), 1, thread_count);
+
+    CHECK(sorted_lanes(a) == expected);
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t k = 0; k < 5; ++k) {
+            for (std::size_t j = 1; j < length; ++j) {
+                REQUIRE(a[i][j - 1][k] <= a[i][j][k]);
+            }
+        }
+    }
+}
+
+
+TEST_CASE(
+    "vt::sort orders special floating-point values",
+    "[ndarray][sort]"
+) {
+    const float inf = std::numeric_limits<float>::infinity();
+    const float denorm = std::numeric_limits<float>::denorm_min();
+
+    const float values[] = { inf, -1.5f, denorm, 0.0f, -inf, 2.0f, -denorm };
+
+    vt::ndarray<float, 1> a{{ 300 }};
+    for (std::size_t i = 0; i < 300; ++i) {
+        a[i] = values[i % 7];
+    }
+    vt::ndarray<float, 1> expected = a;
+    std::sort(expected.begin(), expected.end());
+
+    vt::sort(a.view());
+
+    CHECK(std::equal(a.begin(), a.end(), expected.begin()));
+}
+
+
+TEST_CASE(
+    "vt::sort and vt::argsort keep the order of -0 and +0",
+    "[ndarray][sort]"
+) {
+    const float values[] = { 0.0f, -0.0f, 1.0f, -0.0f, 0.0f, -1.0f };
+
+    vt::ndarray<float, 1> a{{ 300 }};
+    for (std::size_t i = 0; i < 300; ++i) {
+        a[i] = values[i % 6];
+    }
+
+    vt::ndarray<std::uint32_t, 1> indices{{ 300 }};
+    vt::argsort<float>(a, indices.view());
+    for (std::size_t i = 1; i < 300; ++i) {
+        const float x = a[indices[i - 1]];
+        const float y = a[indices[i]];
+        REQUIRE(x <= y);
+        if (!(x < y)) REQUIRE(indices[i - 1] < indices[i]);
+    }
+
+    vt::ndarray<float, 1> top{{ 300 }};
+    vt::ndarray<std::uint32_t, 1> top_indices{{ 300 }};
+    vt::top_k<float>(a, top.view(), top_indices.view());
+    for (std::size_t i = 0; i < 300; ++i) {
+        REQUIRE(std::signbit(top[i]) == std::signbit(a[top_indices[i]]));
+    }
+    CHECK(std::vector<std::uint32_t>(
+        top_indices.begin() + 50, top_indices.begin() + 54
+    ) == std::vector<std::uint32_t>{ 0, 1, 3, 4 });
+
+    // The sign of each zero moves along with it
+    std::vector<bool> zero_signs;
+    for (const float x : a) {
+        if (!(x < 0.0f) && !(x > 0.0f)) zero_signs.push_back(std::signbit(x));
+    }
+
+    vt::sort(a.view());
+
+    std::vector<bool> sorted_zero_signs;
+    for (std::size_t i = 0; i < 300; ++i) {
+        REQUIRE(a[i] <= a[std::min<std::size_t>(i + 1, 299)]);
+        if (!(a[i] < 0.0f) && !(a[i] > 0.0f)) {
+            sorted_zero_signs.push_back(std::signbit(a[i]));
+        }
+    }
+    CHECK(sorted_zero_signs == zero_signs);
+}
+
+
+TEST_CASE(
+    "vt::sort sorts a single large lane with several threads",
+    "[ndarray][sort]"
+) {
+    vt::ndarray<std::int32_t, 2> a = random_rows<std::int32_t>(1, 1 << 17, 4);
+    std::mt19937 rng{5};
+    for (std::int32_t& x : a) {
+        x = static_cast<std::int32_t>(rng());
+    }
+    vt::ndarray<std::int32_t, 2> expected = a;
+    std::sort(expected.begin(), expected.end());
+
+    const vt::ndarray<std::int32_t, 2> original = a;
+    vt::sort(a.view(), 1, 4);
+    CHECK(std::equal(a.begin(), a.end(), expected.begin()));
+
+    vt::ndarray<std::uint32_t, 2> indices{{ 1, 1 << 17 }};
+    vt::argsort<std::int32_t>(original, indices.view(), 1, 4);
+    for (std::size_t i = 0; i < a.shape(1); ++i) {
+        REQUIRE(original[0][indices[0][i]] == expected[0][i]);
+    }
+}
+
+
+TEST_CASE(
+    "vt::argsort is stable",
+    "[ndarray][sort]"
+) {
+    const std::size_t length = GENERATE(as<std::size_t>{}, 1, 7, 16, 40, 500);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    check_argsort_rows<float, std::size_t>(length, thread_count);
+    check_argsort_rows<std::int16_t, std::int32_t>(length, thread_count);
+    check_argsort_rows<std::int64_t, std::uint32_t>(length, thread_count);
+}
+
+
+TEST_CASE(
+    "vt::argsort sorts along a leading axis",
+    "[ndarray][sort]"
+) {
+    const vt::ndarray<int, 2> a{{ 3, 2 }, { 5, 1, 2, 1, 2, 0 }};
+    vt::ndarray<std::size_t, 2> indices{{ 3, 2 }};
+
+    vt::argsort<int>(a, indices.view(), 0);
+
+    CHECK(std::vector<std::size_t>(indices.begin(), indices.end()) ==
+        std::vector<std::size_t>{ 1, 2, 2, 0, 0, 1 });
+}
+
+
+TEST_CASE(
+    "vt::sort and vt::argsort sort other element types",
+    "[ndarray][sort]"
+) {
+    vt::ndarray<std::string, 2> a{{ 2, 4 }};
+    const char* words[] = { "pear", "fig", "apple", "fig",
+        "kiwi", "date", "plum", "banana" };
+    std::copy(std::begin(words), std::end(words), a.begin());
+
+    vt::ndarray<int, 2> indices{{ 2, 4 }};
+    vt::argsort<std::string>(a, indices.view());
+    CHECK(std::vector<int>(indices.begin(), indices.end()) ==
+        std::vector<int>{ 2, 1, 3, 0, 3, 1, 0, 2 });
+
+    vt::sort(a.view());
+    CHECK(a[0][0] == "apple");
+    CHECK(a[1][3] == "plum");
+}
+
+
+TEST_CASE(
+    "vt::partial_sort puts the smallest elements first in order",
+    "[ndarray][sort]"
+) {
+    const std::size_t axis = GENERATE(as<std::size_t>{}, 0, 1);
+    const std::size_t k = GENERATE(as<std::size_t>{}, 0, 3, 50);
+
+    vt::ndarray<double, 2> a = random_rows<double>(50, 50, 6);
+    const vt::ndarray<double, 2> original = a;
+
+    vt::partial_sort(a.view(), k, axis, 2);
+
+    for (std::size_t lane = 0; lane < 50; ++lane) {
+        std::vector<double> before;
+        std::vector<double> after;
+        for (std::size_t i = 0; i < 50; ++i) {
+            before.push_back(axis == 1 ? original[lane][i] : original[i][lane]);
+            after.push_back(axis == 1 ? a[lane][i] : a[i][lane]);
+        }
+
+        std::sort(before.begin(), before.end());
+        const auto k_first = after.begin() + static_cast<std::ptrdiff_t>(k);
+        CHECK(std::equal(after.begin(), k_first, before.begin()));
+
+        std::sort(after.begin(), after.end());
+        CHECK(after == before);
+    }
+}
+
+
+TEST_CASE(
+    "vt::top_k returns the largest elements and their indices",
+    "[ndarray][sort]"
+) {
+    const std::size_t k = GENERATE(as<std::size_t>{}, 0, 1, 4, 30);
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3);
+
+    const vt::ndarray<std::int32_t, 2> a = random_rows<std::int32_t>(
+        8, 30, 7
+    );
+    vt::ndarray<std::int32_t, 2> values{{ 8, k }};
+    vt::ndarray<std::uint16_t, 2> indices{{ 8, k }};
+
+    vt::top_k<std::int32_t>(a, values, indices.view(), 1, thread_count);
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        std::vector<std::uint16_t> expected(30);
+        std::iota(expected.begin(), expected.end(), std::uint16_t{0});
+        std::stable_sort(expected.begin(), expected.end(),
+            [&](std::uint16_t x, std::uint16_t y) {
+                return a[i][y] < a[i][x];
+            }
+        );
+
+        for (std::size_t j = 0; j < k; ++j) {
+            CHECK(indices[i][j] == expected[j]);
+            CHECK(values[i][j] == a[i][expected[j]]);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray.hpp>
+#include <vt/ndarray/sparse.hpp>
+
+#include <catch2/catch.hpp>
+#include <random>
+
+
+static void mul(
+    vt::ndview<const float, 2> A,
+    vt::ndview<const float, 2> B,
+    vt::ndview<float, 2> C
+) {
+    assert(A.shape(0) == C.shape(0));
+    assert(A.shape(1) == B.shape(0));
+    assert(B.shape(1) == C.shape(1));
+
+    const std::size_t n = A.shape(0);
+    const std::size_t m = A.shape(1);
+    const std::size_t p = B.shape(1);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < p; ++j) {
+            C[i][j] = 0.0f;
+            for (std::size_t k = 0; k < m; ++k) {
+                C[i][j] += A[i][k] * B[k][j];
+            }
+        }
+    }
+}
+
+
+static vt::ndarray<float, 2> random_sparse(std::size_t n, double density) {
+    std::mt19937 engine{42};
+    std::uniform_real_distribution<float> value{-1.0f, 1.0f};
+    std::bernoulli_distribution nonzero{density};
+
+    vt::ndarray<float, 2> A{{ n, n }, 0.0f};
+    for (float& x : A) {
+        if (nonzero(engine)) x = value(engine);
+    }
+
+    return A;
+}
+
+
+TEST_CASE(
+    "Benchmark sparse against dense matrix multiplication",
+    "[ndarray][sparse][!benchmark]"
+) {
+    const std::size_t n = GENERATE(as<std::size_t>{}, 64, 512, 1024);
+
+    const vt::ndarray<float, 2> A = random_sparse(n, 0.01);
+    const vt::ndarray<float, 2> B{{ n, n }, 1.0f};
+    vt::ndarray<float, 2> C{{ n, n }};
+
+    const vt::csr_matrix<float, std::uint32_t> csr{A.view()};
+
+    BENCHMARK("Dense, n = " + std::to_string(n)) {
+        mul(A, B, C);
+    };
+
+    BENCHMARK("CSR, n = " + std::to_string(n)) {
+        vt::mul(csr, B, C);
+    };
+
+    BENCHMARK("CSR, all threads, n = " + std::to_string(n)) {
+        vt::mul(csr, B, C, 0);
+    };
+}
+
+
+TEST_CASE(
+    "Benchmark sparse matrix-vector multiplication",
+    "[ndarray][sparse][!benchmark]"
+) {
+    const std::size_t n = GENERATE(as<std::size_t>{}, 1024, 16384);
+
+    vt::coo_matrix<float, std::uint32_t> coo{{ n, n }};
+    coo.reserve(5 * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        coo.insert(i, i, 4.0f);
+        if (i > 0) coo.insert(i, i - 1, -1.0f);
+        if (i + 1 < n) coo.insert(i, i + 1, -1.0f);
+        if (i >= 64) coo.insert(i, i - 64, -1.0f);
+        if (i + 64 < n) coo.insert(i, i + 64, -1.0f);
+    }
+    const vt::csr_matrix<float, std::uint32_t> csr{coo};
+
+    const vt::ndarray<float, 1> x{{ n }, 1.0f};
+    vt::ndarray<float, 1> y{{ n }};
+
+    BENCHMARK("COO, n = " + std::to_string(n)) {
+        vt::mul(coo, x, y);
+    };
+
+    BENCHMARK("CSR, n = " + std::to_string(n)) {
+        vt::mul(csr, x, y);
+    };
+
+    BENCHMARK("CSR, all threads, n = " + std::to_string(n)) {
+        vt::mul(csr, x, y, 0);
+    };
+}
@@ -0,0 +1,169 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/sparse.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+template<typename T>
+static std::vector<T> to_vector(vt::ndview<const T, 1> a) {
+    return {a.begin(), a.end()};
+}
+
+
+static vt::ndarray<double, 2> random_sparse(
+    std::size_t m,
+    std::size_t n,
+    double density,
+    unsigned seed
+) {
+    std::mt19937 engine{seed};
+    std::uniform_real_distribution<double> value{-1.0, 1.0};
+    std::bernoulli_distribution nonzero{density};
+
+    vt::ndarray<double, 2> a{{ m, n }, 0.0};
+    for (double& x : a) {
+        if (nonzero(engine)) x = value(engine);
+    }
+
+    return a;
+}
+
+
+TEST_CASE(
+    "vt::csr_matrix and vt::coo_matrix convert from and to dense arrays",
+    "[ndarray][sparse]"
+) {
+    const vt::ndarray<int, 2> dense{{ 3, 4 }, {
+        0, 2, 0, 0,
+        0, 0, 0, 0,
+        5, 0, 0, 7
+    }};
+
+    const vt::csr_matrix<int> csr{dense.view()};
+    CHECK(csr.shape() == dense.shape());
+    CHECK(csr.nonzero_count() == 3);
+    CHECK(to_vector(csr.row_offsets()) ==
+        std::vector<std::size_t>{ 0, 1, 1, 3 });
+    CHECK(to_vector(csr.col_indices()) == std::vector<std::size_t>{ 1, 0, 3 });
+    CHECK(to_vector(csr.values()) == std::vector<int>{ 2, 5, 7 });
+    CHECK(csr.to_ndarray() == dense);
+
+    const vt::coo_matrix<int, std::uint32_t> coo{dense.view()};
+    CHECK(coo.nonzero_count() == 3);
+    CHECK(coo.to_ndarray() == dense);
+
+    const vt::csr_matrix<int> empty;
+    CHECK(empty.nonzero_count() == 0);
+    CHECK(empty.row_offsets().element_count() == 1);
+}
+
+
+TEST_CASE(
+    "Converting a vt::coo_matrix to a vt::csr_matrix sorts and sums entries",
+    "[ndarray][sparse]"
+) {
+    vt::coo_matrix<double, std::uint32_t> coo{{ 3, 3 }};
+    coo.insert(2, 1, 1.0);
+    coo.insert(0, 2, 2.0);
+    coo.insert(2, 0, 3.0);
+    coo.insert(0, 2, 4.0);
+    coo.insert(0, 0, 5.0);
+
+    const vt::csr_matrix<double, std::uint32_t> csr{coo};
+    CHECK(csr.nonzero_count() == 4);
+    CHECK(to_vector(csr.row_offsets()) ==
+        std::vector<std::uint32_t>{ 0, 2, 2, 4 });
+    CHECK(to_vector(csr.col_indices()) ==
+        std::vector<std::uint32_t>{ 0, 2, 0, 1 });
+    CHECK(to_vector(csr.values()) == std::vector<double>{ 5.0, 6.0, 3.0, 1.0 });
+
+    CHECK(csr.to_ndarray() == coo.to_ndarray());
+}
+
+
+TEST_CASE(
+    "Sparse matrix-vector products match the dense product",
+    "[ndarray][sparse]"
+) {
+    const std::size_t m = 97;
+    const std::size_t n = 61;
+    const vt::ndarray<double, 2> dense = random_sparse(m, n, 0.1, 1);
+    const vt::csr_matrix<double> csr{dense.view()};
+    const vt::coo_matrix<double> coo{dense.view()};
+
+    vt::ndarray<double, 1> x{{ n }};
+    for (std::size_t j = 0; j < n; ++j) {
+        x[j] = static_cast<double>(j) * 0.5 - 7.0;
+    }
+
+    vt::ndarray<double, 1> expected{{ m }, 0.0};
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            expected[i] += dense[i][j] * x[j];
+        }
+    }
+
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 3, 0);
+
+    vt::ndarray<double, 1> y{{ m }, -1.0};
+    vt::mul(csr, x, y, thread_count);
+    for (std::size_t i = 0; i < m; ++i) {
+        CHECK(y[i] == Approx(expected[i]).margin(1e-12));
+    }
+
+    vt::ndarray<double, 1> z{{ m }, -1.0};
+    vt::mul(coo, x, z);
+    for (std::size_t i = 0; i < m; ++i) {
+        CHECK(z[i] == Approx(expected[i]).margin(1e-12));
+    }
+}
+
+
+TEST_CASE(
+    "Sparse matrix-matrix products match the dense product",
+    "[ndarray][sparse]"
+) {
+    const std::size_t m = 50;
+    const std::size_t n = 40;
+    const std::size_t p = 13;
+    const vt::ndarray<double, 2> dense = random_sparse(m, n, 0.2, 2);
+    const vt::ndarray<double, 2> B = random_sparse(n, p, 1.0, 3);
+    const vt::csr_matrix<double, std::uint32_t> csr{dense.view()};
+
+    const std::size_t thread_count = GENERATE(as<std::size_t>{}, 1, 4);
+
+    vt::ndarray<double, 2> C{{ m, p }, -1.0};
+    vt::mul(csr, B, C, thread_count);
+
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < p; ++j) {
+            double expected = 0.0;
+            for (std::size_t k = 0; k < n; ++k) {
+                expected += dense[i][k] * B[k][j];
+            }
+            CHECK(C[i][j] == Approx(expected).margin(1e-12));
+        }
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2026 VORtech b.v.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vt/ndarray/topology.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+
+static const char* test_environment(const char* name) {
+    if (std::strcmp(name, "VT_NDARRAY_CACHE_LINE_SIZE") == 0) return "128";
+    if (std::strcmp(name, "VT_NDARRAY_L2_CACHE_SIZE") == 0) return "4M";
+    if (std::strcmp(name, "VT_NDARRAY_THREAD_COUNT") == 0) return "3";
+
+    return nullptr;
+}
+
+
+TEST_CASE(
+    "vt::cpu_topology describes the machine",
+    "[ndarray][topology]"
+) {
+    const vt::cpu_topology& topology = vt::cpu_topology::get();
+
+    CHECK(topology.cache_line_size >= 16);
+    CHECK((topology.cache_line_size & (topology.cache_line_size - 1)) == 0);
+    CHECK(topology.l1d_cache_size > 0);
+    CHECK(topology.l2_cache_size > 0);
+    CHECK(topology.l3_cache_size > 0);
+    CHECK(topology.thread_count > 0);
+    CHECK(topology.core_count > 0);
+    CHECK(topology.core_count <= topology.thread_count);
+
+    CHECK(&vt::cpu_topology::get() == &topology);
+}
+
+
+TEST_CASE(
+    "Cache sizes are parsed as in sysfs",
+    "[ndarray][topology]"
+) {
+    CHECK(vt::detail::parse_size("4096") == 4096);
+    CHECK(vt::detail::parse_size("48K\n") == 48 * 1024);
+    CHECK(vt::detail::parse_size("2M") == 2 * 1024 * 1024);
+    CHECK(vt::detail::parse_size("1G") == 1024 * 1024 * 1024);
+
+    CHECK(vt::detail::parse_size(nullptr) == 0);
+    CHECK(vt::detail::parse_size("") == 0);
+    CHECK(vt::detail::parse_size("K") == 0);
+    CHECK(vt::detail::parse_size("12 cores") == 0);
+
+    CHECK(vt::detail::parse_size("99999999999999999999999") == 0);
+    CHECK(vt::detail::parse_size("18446744073709551615G") == 0);
+    CHECK(vt::detail::parse_size("17179869184G") == 0);
+}
+
+
+TEST_CASE(
+    "CPU lists are parsed as in sysfs",
+    "[ndarray][topology]"
+) {
+    std::vector<std::size_t> cpus;
+    const auto add = [&](std::size_t cpu) { cpus.push_back(cpu); };
+
+    CHECK(vt::detail::for_each_cpu("0-2,5,7-8\n", add));
+    CHECK(cpus == std::vector<std::size_t>{ 0, 1, 2, 5, 7, 8 });
+
+    cpus.clear();
+    CHECK(vt::detail::for_each_cpu("3", add));
+    CHECK(cpus == std::vector<std::size_t>{ 3 });
+
+    CHECK(!vt::detail::for_each_cpu("", add));
+    CHECK(!vt::detail::for_each_cpu("0-", add));
+    CHECK(!vt::detail::for_each_cpu("4-2", add));
+    CHECK(!vt::detail::for_each_cpu("0,,1", add));
+}
+
+
+TEST_CASE(
+    "Environment variables override the probed vt::cpu_topology",
+    "[ndarray][topology]"
+) {
+    vt::cpu_topology topology{64, 32768, 1048576, 8388608, 4, 8};
+    vt::detail::finish_topology(topology, test_environment);
+
+    CHECK(topology.cache_line_size == 128);
+    CHECK(topology.l1d_cache_size == 32768);
+    CHECK(topology.l2_cache_size == 4 * 1024 * 1024);
+    CHECK(topology.l3_cache_size == 8388608);
+    CHECK(topology.thread_count == 3);
+    CHECK(topology.core_count == 3);
+}
+
+
+TEST_CASE(
+    "Unknown vt::cpu_topology values fall back to defaults",
+    "[ndarray][topology]"
+) {
+    // 96 is not a valid alignment
+    vt::cpu_topology topology{96, 0, 0, 0, 0, 0};
+    vt::detail::finish_topology(topology, [](const char*) {
+        return static_cast<const char*>(nullptr);
+    });
+
+    CHECK(topology.cache_line_size == vt::detail::cache_line_size);
+    CHECK(topology.l1d_cache_size == vt::detail::default_l1d_cache_size);
+    CHECK(topology.l2_cache_size == vt::detail::default_l2_cache_size);
+    CHECK(topology.l3_cache_size == vt::detail::default_l3_cache_size);
+    CHECK(topology.thread_count == 1);
+    CHECK(topology.core_count == 1);
+}